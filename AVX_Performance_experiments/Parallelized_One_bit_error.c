@@ -78,6 +78,17 @@ involved in the multiplication. In all the intermediate computes are evaluated t
 #include <emmintrin.h>
 #include <immintrin.h>
 #endif
+
+#ifdef __linux__
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <pthread.h>
+#endif
 /* ==============================================================================================================
 * 										DEFINE
 * ============================================================================================================== */
@@ -106,6 +117,11 @@ involved in the multiplication. In all the intermediate computes are evaluated t
 	 Square_mtrx = FALSE  	=> unbalanced_matrix  */
 #define Square_mtrx boolean NULL;
 
+#if defined __linux__ && defined Square_mtrx
+#define FI_CAMPAIGN_QUEUE  /*!< Resumable campaign with a queue file and local worker processes */
+#endif
+#define FI_QUEUE_HOST_LEN  64u  /*!< Host name of the owner of a chunk of the campaign queue */
+
 #define SINGLETABLE_CRC32_UI32(ui32_crc, ui32_data, u) \
     u.ui32 = ui32_data; \
 	ui32_crc = kaui32_crc_table[(ui32_crc ^ u.ui8[0u]) & 0x00ffu] ^ (ui32_crc >> 8u); \
@@ -229,9 +245,185 @@ typedef enum
 	e_FI_VAR_A,
 	e_FI_VAR_B,
 	e_FI_VAR_C,
+	e_FI_VAR_ACC,                /*!< Accumulator (register) of an element of C */
 	e_FI_VAR_MAX
 } e_fi_var;
 
+typedef enum
+{
+	e_FI_IDX_BIN = 0u,           /*!< Undetected faults as bitmaps (<tech>_fi_idx.bin) */
+	e_FI_IDX_CSV,                /*!< Undetected faults as "%u," text (<tech>_fi_idx.csv) */
+	e_FI_IDX_MAX
+} e_fi_idx_format;
+
+/*! Header of each experiment (technique and size) of a <tech>_fi_idx.bin file, followed by
+**  the bitmap of A ((ui32_bits_a + 7) / 8 bytes) and the bitmap of B ((ui32_bits_b + 7) / 8 bytes) */
+typedef struct
+{
+	uint32_t ui32_magic;
+	uint32_t ui32_interleaved;   /*!< 1: CSV with A and B interleaved per bit, 0: all A, new line, all B */
+	uint32_t ui32_m;
+	uint32_t ui32_n;
+	uint32_t ui32_k;
+	uint32_t ui32_bit_first;
+	uint32_t ui32_bits_a;
+	uint32_t ui32_bits_b;
+} st_fi_idx_hdr_t;
+
+typedef enum
+{
+	e_FI_SAMPLE_NONE = 0u,       /*!< Exhaustive campaign */
+	e_FI_SAMPLE_UNIFORM,         /*!< Fault sites drawn uniformly among the bits of A and B */
+	e_FI_SAMPLE_STRATIFIED,      /*!< Same number of sites in the sign, exponent and mantissa bits */
+	e_FI_SAMPLE_MAX
+} e_fi_sample;
+
+typedef enum
+{
+	e_FI_STRAT_SIGN = 0u,
+	e_FI_STRAT_EXPONENT,
+	e_FI_STRAT_MANTISSA,
+	e_FI_STRAT_MAX
+} e_fi_stratum;
+
+/*! Statistical campaign configuration (-sample=mode -margin=percent -conf=percent -samples_max=N) */
+typedef struct
+{
+	e_fi_sample e_mode;
+	float64_t f64_margin;        /*!< Half width of the DC interval to reach [%] */
+	float64_t f64_confidence;    /*!< Confidence level [%] */
+	float64_t f64_z;             /*!< Normal quantile of the confidence level */
+	uint32_t ui32_samples_max;   /*!< Maximum number of samples per technique and size */
+} st_fi_sample_cfg_t;
+
+typedef enum
+{
+	e_FI_SCALAR_NONE = 0u,       /*!< Campaign over the AVX techniques (TECH_INTEL_*) */
+	e_FI_SCALAR_RUNS,            /*!< Campaign over the scalar techniques, one execution per fault */
+	e_FI_SCALAR_LANES,           /*!< Campaign over the scalar techniques, FI_LANES faults per execution */
+	e_FI_SCALAR_MAX
+} e_fi_scalar;
+
+/*! Checksum of the scalar techniques TECH_XOR_EXTERNAL ... TECH_CRC_INTERNAL (3 placements per checksum) */
+typedef enum
+{
+	e_FI_LANES_XOR = 0u,
+	e_FI_LANES_ONES,
+	e_FI_LANES_TWOS,
+	e_FI_LANES_FLETCHER,
+	e_FI_LANES_CRC,
+	e_FI_LANES_MAX
+} e_fi_lanes_sum;
+
+typedef enum
+{
+	e_FI_LANES_EXTERNAL = 0u,    /*!< Checksum updated per row of C */
+	e_FI_LANES_INTERMEDIATE,     /*!< Checksum updated per element of A */
+	e_FI_LANES_INTERNAL          /*!< Checksum updated per element of A and per product */
+} e_fi_lanes_place;
+
+/*! Checksum state of FI_LANES experiments, one 32 bit lane per experiment. The 64 bit state
+**  of the one's complement checksum is split in the low and the high words */
+typedef struct
+{
+	__m256i m256i_lo;
+	__m256i m256i_hi;
+} st_fi_lanes_sig_t;
+
+/*! Faults in C / in the accumulators of the AVX techniques (-fi_var=c|acc -fi_at=i,k) */
+typedef struct
+{
+	e_fi_var e_var;              /*!< e_FI_VAR_NONE: campaign in A and B, e_FI_VAR_C, e_FI_VAR_ACC */
+	uint32_t ui32_i;             /*!< Iteration i of the faults in C (FI_HOOK_AT_MIDDLE: M / 2) */
+	uint32_t ui32_k;             /*!< Iteration k of the faults (FI_HOOK_AT_MIDDLE: K / 2) */
+} st_fi_hook_cfg_t;
+
+/*! Fault armed in the injection hook of the AVX techniques (FI_HOOK_IK / FI_HOOK_ACC) */
+typedef struct
+{
+	e_fi_var e_var;              /*!< e_FI_VAR_NONE: disarmed, e_FI_VAR_C: C in memory, e_FI_VAR_ACC: accumulator */
+	uint32_t ui32_i;             /*!< Iteration i of the fault */
+	uint32_t ui32_k;             /*!< Iteration k of the fault */
+	uint32_t ui32_c;             /*!< Element of C */
+	uint32_t ui32_flip;          /*!< Mask of the flipped bit */
+} st_fi_hook_t;
+
+/*! xoshiro128** generator (rng_u32) */
+typedef struct
+{
+	uint32_t aui32_s[4u];
+} st_rng_t;
+
+/*! RNG_LANES xoshiro128** generators in the lanes of AVX2 registers (rng_u32_x8, matrix2rand) */
+typedef struct
+{
+	__m256i am256i_s[4u];
+} st_rng_x8_t;
+
+typedef enum
+{
+	e_FI_CHUNK_TODO = 0u,
+	e_FI_CHUNK_CLAIMED,
+	e_FI_CHUNK_DONE,
+	e_FI_CHUNK_MAX
+} e_fi_chunk_state;
+
+/*! Campaign queue configuration (-queue=file -workers=N -chunk=bits -lease=sec) */
+typedef struct
+{
+	const char *pstr_queue;    /*!< Queue file, NULL -> campaign without queue */
+	uint32_t ui32_workers;     /*!< Number of local worker processes */
+	uint32_t ui32_chunk_bits;  /*!< Bits per chunk when the queue is created */
+	uint32_t ui32_lease_sec;   /*!< Lease of a claimed chunk, renewed by the heartbeat of its worker */
+} st_fi_queue_cfg_t;
+
+/*! Header of the campaign queue file, followed by ui32_chunks st_fi_chunk_t records */
+typedef struct
+{
+	uint32_t ui32_magic;
+	uint32_t ui32_chunks;
+	uint32_t ui32_chunk_bits;
+	uint32_t ui32_size_max;
+} st_fi_queue_hdr_t;
+
+/*! Chunk of the campaign: faults in A and B of the bits [ui32_bit_first, ui32_bit_end) of one technique and size */
+typedef struct
+{
+	uint32_t ui32_tech;
+	uint32_t ui32_size;
+	uint32_t ui32_bit_first;
+	uint32_t ui32_bit_end;
+	uint32_t ui32_state;       /*!< e_fi_chunk_state */
+	int32_t i32_owner_pid;     /*!< Worker that claimed the chunk */
+	char str_owner_host[FI_QUEUE_HOST_LEN]; /*!< gethostname() of the worker */
+	int64_t i64_lease_end;     /*!< Claim valid until this time (seconds since the epoch), renewed by the worker */
+	uint32_t ui32_detected;
+	uint32_t ui32_undetected;
+} st_fi_chunk_t;
+
+/*! Transport between a worker and the campaign queue. The local transport works on the
+**  queue file (fcntl locks); a remote transport only has to provide the same two calls */
+typedef struct
+{
+	void_t *p_ctx;
+	/*! Claim the next chunk: 1 claimed, 0 no chunk left, -1 error */
+	int32_t(*pfn_claim)(void_t *p_ctx, uint32_t *pui32_chunk, st_fi_chunk_t *pst_chunk);
+	/*! Renew the lease of a claimed chunk (heartbeat): 0 renewed, -1 the claim was lost */
+	int32_t(*pfn_renew)(void_t *p_ctx, uint32_t ui32_chunk);
+	/*! Store the result of a claimed chunk (undetected flags of its bits) and mark it done */
+	int32_t(*pfn_complete)(void_t *p_ctx, uint32_t ui32_chunk, const st_fi_chunk_t *pst_chunk, const uint8_t *pau8_undetected);
+	uint32_t ui32_lease_sec;   /*!< Lease of the claims: the worker renews it every ui32_lease_sec / FI_QUEUE_HEARTBEATS */
+} st_fi_transport_t;
+
+/*! Context of the local (queue file) transport */
+typedef struct
+{
+	int32_t i32_fd;
+	const char *pstr_queue;
+	uint32_t ui32_lease_sec;
+	char str_host[FI_QUEUE_HOST_LEN];  /*!< Host of the workers (gethostname) */
+} st_fi_queue_file_t;
+
 #ifndef __STDC_LIB_EXT1__
 typedef int errno_t;
 #endif
@@ -244,6 +436,40 @@ typedef int errno_t;
 #define TIME_MEASUREMENT_LOOPS  ((uint32_t) 100u)  /*!< Number of measurements to measure time */
 
 #define MEASUREMENT_LOOPS_DC   ((uint32_t) 1u)  /*!< Number of measurement test loops */
+#define FI_UNDETECTED_A        ((uint8_t) 0x01u)  /*!< Fault in A not detected */
+#define FI_UNDETECTED_B        ((uint8_t) 0x02u)  /*!< Fault in B not detected */
+#define FI_F32_SIGN            ((uint32_t) 0x80000000u)  /*!< Sign bit of a float32_t (-0.0f) */
+#define FI_F32_EXPONENT        ((uint32_t) 0x7F800000u)  /*!< Exponent bits of a float32_t (all set: Inf / NaN) */
+/* A faulty Inf / NaN operand turns C into NaN (Inf * 0): the copy of C of the thread is restored so the next faults start from the golden C */
+#define FI_RESTORE_C_NON_FINITE(paf32_m_fi, ui32_bit, paf32_mc_t, paf32_mc, size_c) \
+	if ((((const uint32_t*)(paf32_m_fi))[(ui32_bit) / 32u] & FI_F32_EXPONENT) == FI_F32_EXPONENT) { memcpy((paf32_mc_t), (paf32_mc), (size_c)); }
+#define FI_QUEUE_MAGIC         ((uint32_t) 0x32514946u)  /*!< "FIQ2" (chunks with host and lease) */
+#define FI_IDX_MAGIC           ((uint32_t) 0x31424946u)  /*!< "FIB1" */
+#define FI_QUEUE_CHUNK_BITS    ((uint32_t) 16384u)  /*!< Default bits per chunk of the campaign queue */
+#define FI_QUEUE_LEASE_SEC     ((uint32_t) 300u)  /*!< Default lease of a claimed chunk [s] */
+#define FI_QUEUE_HEARTBEATS    ((uint32_t) 4u)  /*!< Renewals of the lease per lease period */
+#define FI_SAMPLE_BATCH        ((uint32_t) 256u)  /*!< Samples between two checks of the DC interval */
+#define FI_SAMPLE_MARGIN       (1.0)  /*!< Default half width of the DC interval [%] */
+#define FI_SAMPLE_MAX          ((uint32_t) 100000u)  /*!< Default maximum number of samples */
+#define FI_LANES               ((uint32_t) 8u)  /*!< Faults per execution of the lanes campaign (32 bit lanes of __m256i) */
+#define FI_LANES_NO_SITE       ((uint32_t) 0xFFFFFFFFu)  /*!< Site of the lanes without fault in A / B */
+#define FI_HOOK_AT_MIDDLE      ((uint32_t) 0xFFFFFFFFu)  /*!< Default iteration of the faults in C: i = M / 2, k = K / 2 */
+#define RNG_SEED_DEFAULT       ((uint64_t) 1u)           /*!< Seed of the random numbers without -seed= */
+#define RNG_LANES              8u                        /*!< Generators of rng_u32_x8 */
+#define RNG_STREAM_MATRIX      ((uint32_t) 0x80000000u)  /*!< First stream of matrix2rand (streams below: OpenMP threads) */
+#define RNG_ROTL(ui32_x, ui32_r) (((ui32_x) << (ui32_r)) | ((ui32_x) >> (32u - (ui32_r))))
+
+/* Injection hook of the AVX techniques (faults in C and in the accumulators, -fi_var=). Only with -DFI_HOOK:
+** without it the hooks are empty and the techniques are the same code */
+#ifdef FI_HOOK
+#define FI_HOOK_IK(ui32_i, ui32_k, paf32_c)  const bool32_t b32_fi_hook_ik = fi_hook_ik((ui32_i), (ui32_k), (paf32_c))
+#define FI_HOOK_ACC(ui32_c, m256_acc)        if (b32_fi_hook_ik) { (m256_acc) = fi_hook_acc((ui32_c), (m256_acc)); }
+#define FI_HOOK_ACC_TAIL(ui32_c, paf32_c)    if (b32_fi_hook_ik) { fi_hook_acc_tail((ui32_c), (paf32_c)); }
+#else
+#define FI_HOOK_IK(ui32_i, ui32_k, paf32_c)
+#define FI_HOOK_ACC(ui32_c, m256_acc)
+#define FI_HOOK_ACC_TAIL(ui32_c, paf32_c)
+#endif
 
 #define MAX_DIM             ((uint32_t) 640u)
 #define M                   ((uint32_t) 18u)//128u) /*!< TBD DESCRIPTION */
@@ -261,6 +487,18 @@ typedef int errno_t;
 #endif
 
 typedef uint32_t bool32_t;
+
+#ifdef FI_CAMPAIGN_QUEUE
+/*! Heartbeat of a worker (fi_queue_heartbeat): renews the lease of its chunk until it is done */
+typedef struct
+{
+	const st_fi_transport_t *pst_transport;
+	uint32_t ui32_chunk;
+	bool32_t b32_stop;
+	pthread_mutex_t st_mutex;
+	pthread_cond_t st_cond;
+} st_fi_heartbeat_t;
+#endif
 /* ==============================================================================================================
 * 										CONSTS
 * ============================================================================================================== */
@@ -333,6 +571,19 @@ static const uint32_t kaui32_crc_table[256u] = /*! CRC Look-Up Table; See: web.m
 };
 
 
+static const char *kapstr_fi_idx_ext[e_FI_IDX_MAX] = { "bin", "csv" };  /*!< Extension of the undetected faults file */
+static const char *kapstr_fi_idx_mode[e_FI_IDX_MAX] = { "wb", "w+" };  /*!< fopen mode of the undetected faults file */
+
+#ifdef FI_HOOK
+static st_fi_hook_t st_fi_hook = { e_FI_VAR_NONE, 0u, 0u, 0u, 0u };  /*!< Fault of the injection hook, one per thread */
+#pragma omp threadprivate(st_fi_hook)
+#endif
+
+static uint64_t ui64_rng_seed = RNG_SEED_DEFAULT;  /*!< Seed of the random numbers (-seed=), written in the CSV files */
+static st_rng_t st_rng;                            /*!< Generator of each thread (stream = thread number), see rng_init */
+#pragma omp threadprivate(st_rng)
+static st_rng_x8_t st_rng_matrix;                  /*!< Generators of matrix2rand */
+
 static const uint32_t kaui32_matrix_size[eSIZE_MAX] =
 {
 	/* eSIZE_MIN     */ 20,
@@ -370,13 +621,25 @@ static const uint32_t kaui32_matrix_size[eSIZE_MAX] =
 	*				 */
 };
 
-static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_time_exp, bool32_t *pb32_dc_exp, bool32_t *pb32_ut_exp, bool32_t *pab32_selected_tech);
+static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_time_exp, bool32_t *pb32_dc_exp, bool32_t *pb32_ut_exp, bool32_t *pab32_selected_tech,
+	st_fi_queue_cfg_t *pst_queue_cfg, st_fi_sample_cfg_t *pst_sample_cfg, e_fi_idx_format *pe_idx_format, e_fi_scalar *pe_scalar,
+	st_fi_hook_cfg_t *pst_hook_cfg, uint64_t *pui64_seed, bool32_t *pb32_prune);
 static bool32_t execute_unit_test(bool32_t ab32_selected_tech[TECH_MAX], float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc, float32_t* const paf32_mc_ref);
 static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc);
 static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], bool32_t b32_double_error,
 	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc,
 	float32_t* const paf32_ma_fi, float32_t* const paf32_mb_fi,
-	char *argv[]);
+	e_fi_idx_format e_idx_format, e_fi_scalar e_scalar, bool32_t b32_prune, char *argv[]);
+static int32_t measure_dc__error_bit_sampled(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], const st_fi_sample_cfg_t *pst_sample_cfg,
+	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc);
+#ifdef FI_CAMPAIGN_QUEUE
+static int32_t measure_dc__error_bit_queue(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], const st_fi_queue_cfg_t *pst_queue_cfg,
+	e_fi_idx_format e_idx_format, float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc);
+#endif
+#ifdef FI_HOOK
+static int32_t measure_dc__error_bit_hook(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], const st_fi_hook_cfg_t *pst_hook_cfg,
+	e_fi_idx_format e_idx_format, float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc);
+#endif
 static int32_t measure_dc__error_random_values(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], bool32_t b32_consecutive, uint32_t ui32_n_length, uint32_t ui32_n_iterations,
 	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc,
 	float32_t* const paf32_ma_fi, float32_t* const paf32_mb_fi,
@@ -391,9 +654,54 @@ static void_t print_help_commands(const char *pstr_exec_name);
 * 										PROTOTYPES OF LOCAL FUNCTIONS
 * ============================================================================================================== */
 static void_t mem_fi(float32_t* const paf32_m, uint32_t ui32_bit_idx);
+static uint32_t mem_fi_bits_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	uint32_t ui32_bit_first, uint32_t ui32_bit_end, bool32_t b32_fi_a, bool32_t b32_fi_b, uint8_t* const pau8_undetected);
+static uint32_t mem_fi_bits_lanes_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	uint32_t ui32_bit_first, uint32_t ui32_bit_end, bool32_t b32_fi_a, bool32_t b32_fi_b, uint8_t* const pau8_undetected);
+static uint32_t mem_fi_bits_prune_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	uint32_t ui32_bit_first, uint32_t ui32_bit_end, bool32_t b32_fi_a, bool32_t b32_fi_b, uint8_t* const pau8_undetected);
+static bool32_t fi_prune_a_proven(e_enum_technique e_tech);
+static __m256i smm_lanes_fi(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc_lanes,
+	__m256i m256i_site_a, __m256i m256i_site_b, __m256i m256i_flip);
+static inline void_t fi_lanes_sig_update(e_fi_lanes_sum e_sum, st_fi_lanes_sig_t *pst_sig, __m256i m256i_data);
+static inline void_t fi_lanes_ones_add(st_fi_lanes_sig_t *pst_sig, __m256i m256i_lo, __m256i m256i_hi);
+#ifdef FI_HOOK
+static uint32_t mem_fi_hook_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	e_fi_var e_var, uint32_t ui32_at_i, uint32_t ui32_at_k, uint32_t ui32_faults, uint8_t* const pau8_undetected);
+static inline bool32_t fi_hook_ik(uint32_t ui32_i, uint32_t ui32_k, float32_t* const paf32_mc);
+static inline __m256 fi_hook_acc(uint32_t ui32_c, __m256 m256_acc);
+static inline void_t fi_hook_acc_tail(uint32_t ui32_c, float32_t* const paf32_mc);
+#endif
+static void_t mem_fi_sites_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	uint64_t ui64_bits_a, const uint64_t* const paui64_site, uint32_t ui32_sites, uint8_t* const pau8_detected);
+static int32_t fi_idx_write(FILE *p_file, e_fi_idx_format e_format, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k,
+	uint32_t ui32_bit_first, uint32_t ui32_bits_a, uint32_t ui32_bits_b, bool32_t b32_interleaved,
+	const uint8_t* const pau8_undetected_a, const uint8_t* const pau8_undetected_b);
+#ifdef FI_CAMPAIGN_QUEUE
+static int32_t fi_queue_lock(int32_t i32_fd, bool32_t b32_lock);
+static int32_t fi_queue_open(const char *pstr_queue, e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], uint32_t ui32_chunk_bits, st_fi_queue_hdr_t *pst_hdr);
+static int32_t fi_queue_file_claim(void_t *p_ctx, uint32_t *pui32_chunk, st_fi_chunk_t *pst_chunk);
+static int32_t fi_queue_file_renew(void_t *p_ctx, uint32_t ui32_chunk);
+static int32_t fi_queue_file_complete(void_t *p_ctx, uint32_t ui32_chunk, const st_fi_chunk_t *pst_chunk, const uint8_t *pau8_undetected);
+static void_t *fi_queue_heartbeat(void_t *p_arg);
+static uint32_t fi_queue_worker(const st_fi_transport_t *pst_transport, float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc);
+static int32_t fi_queue_merge(int32_t i32_fd, const char *pstr_queue, e_fi_idx_format e_idx_format);
+#endif
 static void_t mem_fi_random_value(float32_t* const paf32_m, uint32_t ui32_max_dim, uint32_t ui32_n_length, bool32_t b32_consecutive);
 static void_t matrix2zeros(float32_t  * paf32_matrix, uint32_t ui32_max_rows, uint32_t ui32_max_columns);
 static void_t matrix2rand(float32_t  * paf32_matrix, uint32_t ui32_max_rows, uint32_t ui32_max_columns);
+static void_t rng_init(uint64_t ui64_seed);
+static void_t rng_seed(st_rng_t *pst_rng, uint64_t ui64_seed, uint32_t ui32_stream);
+static void_t rng_seed_x8(st_rng_x8_t *pst_rng, uint64_t ui64_seed, uint32_t ui32_stream_first);
+static inline uint32_t rng_u32(st_rng_t *pst_rng);
+static inline uint32_t rng_range(st_rng_t *pst_rng, uint32_t ui32_range);
+static inline __m256i rng_u32_x8(st_rng_x8_t *pst_rng);
 
 /* ==============================================================================================================
 * 											Experiment 0 : optimization
@@ -683,6 +991,13 @@ int32_t main(void)
 	e_enum_size_2d e_size_max;
 	uint32_t ui32_fi_max_variables = 10u,
 		ui32_fi_iterations = 10u;
+	st_fi_queue_cfg_t st_queue_cfg = { NULL, 1u, FI_QUEUE_CHUNK_BITS, FI_QUEUE_LEASE_SEC };
+	st_fi_sample_cfg_t st_sample_cfg = { e_FI_SAMPLE_NONE, FI_SAMPLE_MARGIN, 95.0, 1.959964, FI_SAMPLE_MAX };
+	e_fi_idx_format e_idx_format = e_FI_IDX_BIN;
+	e_fi_scalar e_scalar = e_FI_SCALAR_NONE;
+	st_fi_hook_cfg_t st_hook_cfg = { e_FI_VAR_NONE, FI_HOOK_AT_MIDDLE, FI_HOOK_AT_MIDDLE };
+	uint64_t ui64_seed = RNG_SEED_DEFAULT;
+	bool32_t b32_prune = FALSE;
 
 	/***********************************************************************************************************************
 	*| STEP 0: Remainder of the commands
@@ -693,7 +1008,9 @@ int32_t main(void)
 	*| STEP 1: Process configuration arguments
 	***********************************************************************************************************************/
 	printf("\n [1] Process configuration arguments");
-	e_size_max = process_args(argc, argv, &b32_time_exp, &b32_dc_exp, &b32_ut_exp, &ab32_selected_tech[0u]);
+	e_size_max = process_args(argc, argv, &b32_time_exp, &b32_dc_exp, &b32_ut_exp, &ab32_selected_tech[0u], &st_queue_cfg, &st_sample_cfg, &e_idx_format, &e_scalar, &st_hook_cfg, &ui64_seed, &b32_prune);
+	rng_init(ui64_seed);
+	printf("\n  Seed of the random numbers = %llu", (unsigned long long)ui64_seed);
 
 	/***********************************************************************************************************************
 	*| STEP 2: UNIT TESTS
@@ -735,11 +1052,41 @@ int32_t main(void)
 		&af32_matrix_a_fi[0u], &af32_matrix_b_fi[0u],
 		&af32_matrix_a_rand[0u], &af32_matrix_b_rand[0u], &af32_matrix_c_rand[0u]);*/
 
-		printf("\n\n\t EXHAUSTIVE - SINGLE BIT ERROR");
-		measure_dc__error_bit_parallelized(e_size_max, ab32_selected_tech, FALSE,
-			&af32_matrix_a[0u], &af32_matrix_b[0u], &af32_matrix_c[0u],
-			&af32_matrix_a_fi[0u], &af32_matrix_b_fi[0u],
-			argv);
+		if (st_hook_cfg.e_var != e_FI_VAR_NONE)
+		{
+			printf("\n\n\t EXHAUSTIVE - SINGLE BIT ERROR IN %s", (st_hook_cfg.e_var == e_FI_VAR_C) ? "C" : "THE ACCUMULATORS");
+#ifdef FI_HOOK
+			measure_dc__error_bit_hook(e_size_max, ab32_selected_tech, &st_hook_cfg, e_idx_format,
+				&af32_matrix_a[0u], &af32_matrix_b[0u], &af32_matrix_c[0u]);
+#else
+			printf("\n ---> -fi_var needs the injection hook of the techniques (build with -DFI_HOOK)");
+#endif
+		}
+		else if (st_sample_cfg.e_mode != e_FI_SAMPLE_NONE)
+		{
+			printf("\n\n\t SAMPLED - SINGLE BIT ERROR (margin %.3f %%, confidence %.1f %%)", st_sample_cfg.f64_margin, st_sample_cfg.f64_confidence);
+			measure_dc__error_bit_sampled(e_size_max, ab32_selected_tech, &st_sample_cfg,
+				&af32_matrix_a[0u], &af32_matrix_b[0u], &af32_matrix_c[0u]);
+		}
+		else if (st_queue_cfg.pstr_queue != NULL)
+		{
+			printf("\n\n\t EXHAUSTIVE - SINGLE BIT ERROR");
+#ifdef FI_CAMPAIGN_QUEUE
+			measure_dc__error_bit_queue(e_size_max, ab32_selected_tech, &st_queue_cfg, e_idx_format,
+				&af32_matrix_a[0u], &af32_matrix_b[0u], &af32_matrix_c[0u]);
+#else
+			printf("\n ---> -queue is only available for the square campaign on Linux");
+#endif
+		}
+		else
+		{
+			printf("\n\n\t EXHAUSTIVE - SINGLE BIT ERROR%s%s", (e_scalar == e_FI_SCALAR_LANES) ? " (scalar techniques, lanes)" : ((e_scalar == e_FI_SCALAR_RUNS) ? " (scalar techniques)" : ""),
+				b32_prune ? " (equivalent faults in A executed once)" : "");
+			measure_dc__error_bit_parallelized(e_size_max, ab32_selected_tech, FALSE,
+				&af32_matrix_a[0u], &af32_matrix_b[0u], &af32_matrix_c[0u],
+				&af32_matrix_a_fi[0u], &af32_matrix_b_fi[0u],
+				e_idx_format, e_scalar, b32_prune, argv);
+		}
 
 		/*printf("\n\n\t EXHAUSTIVE - DOUBLE BIT ERROR");
 		measure_dc__error_bit(e_size_max, ab32_selected_tech, TRUE,
@@ -780,11 +1127,20 @@ int32_t main(void)
 ** @param[in]     argv           Array of argument strings
 ** @param[in,out] pb32_time_exp  Execute time measurement experiments boolean option
 ** @param[in,out] pb32_dc_exp    Execute DC measurement experiments boolean option
+** @param[in,out] pst_queue_cfg  Campaign queue options (-queue=, -workers=, -chunk=, -lease=)
+** @param[in,out] pst_sample_cfg Statistical campaign options (-sample=, -margin=, -conf=, -samples_max=)
+** @param[in,out] pe_idx_format  Format of the undetected faults files (-idx=)
+** @param[in,out] pe_scalar      Campaign over the scalar techniques (-fi_scalar=)
+** @param[in,out] pst_hook_cfg   Campaign in C / in the accumulators (-fi_var=, -fi_at=)
+** @param[in,out] pui64_seed     Seed of the random numbers (-seed=)
+** @param[in,out] pb32_prune     Equivalent faults executed once in the exhaustive campaign (-fi_prune)
 **
 ** @return  e_enum_size_2d Maximum matrix size
 **
 ******************************************************************************/
-static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_time_exp, bool32_t *pb32_dc_exp, bool32_t *pb32_ut_exp, bool32_t *pab32_selected_tech)
+static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_time_exp, bool32_t *pb32_dc_exp, bool32_t *pb32_ut_exp, bool32_t *pab32_selected_tech,
+	st_fi_queue_cfg_t *pst_queue_cfg, st_fi_sample_cfg_t *pst_sample_cfg, e_fi_idx_format *pe_idx_format, e_fi_scalar *pe_scalar,
+	st_fi_hook_cfg_t *pst_hook_cfg, uint64_t *pui64_seed, bool32_t *pb32_prune)
 {
 	uint32_t ui32_idx,
 		ui32_matrix_size;
@@ -863,7 +1219,7 @@ static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_ti
 				if (isdigit(*pstr_arg_size))
 				{
 					ui32_matrix_size = (uint32_t)strtoul(pstr_arg_size, NULL, 10u);
-					for (e_size_idx = eSIZE_MIN; e_size_idx <= eSIZE_MAX; e_size_idx++)
+					for (e_size_idx = eSIZE_MIN; e_size_idx < eSIZE_MAX; e_size_idx++)
 					{
 						if (kaui32_matrix_size[e_size_idx] == ui32_matrix_size)
 						{
@@ -879,6 +1235,97 @@ static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_ti
 				}
 			}
 
+			if (strncmp(pstr_arg, "-queue=", 7u) == 0)
+			{
+				pst_queue_cfg->pstr_queue = &pstr_arg[7u];
+			}
+			else if ((strncmp(pstr_arg, "-workers=", 9u) == 0) && isdigit(pstr_arg[9u]))
+			{
+				pst_queue_cfg->ui32_workers = (uint32_t)strtoul(&pstr_arg[9u], NULL, 10u);
+				pst_queue_cfg->ui32_workers = (pst_queue_cfg->ui32_workers > 0u) ? pst_queue_cfg->ui32_workers : 1u;
+			}
+			else if ((strncmp(pstr_arg, "-chunk=", 7u) == 0) && isdigit(pstr_arg[7u]))
+			{
+				pst_queue_cfg->ui32_chunk_bits = (uint32_t)strtoul(&pstr_arg[7u], NULL, 10u);
+				pst_queue_cfg->ui32_chunk_bits = (pst_queue_cfg->ui32_chunk_bits > 0u) ? pst_queue_cfg->ui32_chunk_bits : FI_QUEUE_CHUNK_BITS;
+			}
+			else if ((strncmp(pstr_arg, "-lease=", 7u) == 0) && isdigit(pstr_arg[7u]))
+			{
+				pst_queue_cfg->ui32_lease_sec = (uint32_t)strtoul(&pstr_arg[7u], NULL, 10u);
+				pst_queue_cfg->ui32_lease_sec = (pst_queue_cfg->ui32_lease_sec >= FI_QUEUE_HEARTBEATS) ? pst_queue_cfg->ui32_lease_sec : FI_QUEUE_HEARTBEATS;
+			}
+			else if (strcmp(pstr_arg, "-idx=bin") == 0)
+			{
+				*pe_idx_format = e_FI_IDX_BIN;
+			}
+			else if (strcmp(pstr_arg, "-idx=csv") == 0)
+			{
+				*pe_idx_format = e_FI_IDX_CSV;
+			}
+			else if (strcmp(pstr_arg, "-fi_scalar=runs") == 0)
+			{
+				*pe_scalar = e_FI_SCALAR_RUNS;
+			}
+			else if (strcmp(pstr_arg, "-fi_scalar=lanes") == 0)
+			{
+				*pe_scalar = e_FI_SCALAR_LANES;
+			}
+			else if (strcmp(pstr_arg, "-fi_var=c") == 0)
+			{
+				pst_hook_cfg->e_var = e_FI_VAR_C;
+			}
+			else if (strcmp(pstr_arg, "-fi_var=acc") == 0)
+			{
+				pst_hook_cfg->e_var = e_FI_VAR_ACC;
+			}
+			else if (strncmp(pstr_arg, "-fi_at=", 7u) == 0)
+			{
+				/* -fi_at=i,k; an empty value keeps the middle of the loop */
+				pstr_arg_size = (char*)&pstr_arg[7u];
+				pst_hook_cfg->ui32_i = isdigit(*pstr_arg_size) ? (uint32_t)strtoul(pstr_arg_size, &pstr_arg_size, 10u) : FI_HOOK_AT_MIDDLE;
+				pstr_arg_size = strchr(pstr_arg_size, ',');
+				pst_hook_cfg->ui32_k = ((pstr_arg_size != NULL) && isdigit(pstr_arg_size[1u])) ? (uint32_t)strtoul(&pstr_arg_size[1u], NULL, 10u) : FI_HOOK_AT_MIDDLE;
+			}
+			else if (strcmp(pstr_arg, "-fi_prune") == 0)
+			{
+				*pb32_prune = TRUE;
+			}
+			else if (strncmp(pstr_arg, "-seed=", 6u) == 0)
+			{
+				*pui64_seed = (uint64_t)strtoull(&pstr_arg[6u], NULL, 0);
+			}
+			else if (strcmp(pstr_arg, "-sample=uniform") == 0)
+			{
+				pst_sample_cfg->e_mode = e_FI_SAMPLE_UNIFORM;
+			}
+			else if (strcmp(pstr_arg, "-sample=stratified") == 0)
+			{
+				pst_sample_cfg->e_mode = e_FI_SAMPLE_STRATIFIED;
+			}
+			else if ((strncmp(pstr_arg, "-margin=", 8u) == 0) && (strtod(&pstr_arg[8u], NULL) > 0.0))
+			{
+				pst_sample_cfg->f64_margin = strtod(&pstr_arg[8u], NULL);
+			}
+			else if ((strncmp(pstr_arg, "-samples_max=", 13u) == 0) && isdigit(pstr_arg[13u]))
+			{
+				pst_sample_cfg->ui32_samples_max = (uint32_t)strtoul(&pstr_arg[13u], NULL, 10u);
+			}
+			else if (strcmp(pstr_arg, "-conf=90") == 0)
+			{
+				pst_sample_cfg->f64_confidence = 90.0;
+				pst_sample_cfg->f64_z = 1.644854;
+			}
+			else if (strcmp(pstr_arg, "-conf=95") == 0)
+			{
+				pst_sample_cfg->f64_confidence = 95.0;
+				pst_sample_cfg->f64_z = 1.959964;
+			}
+			else if (strcmp(pstr_arg, "-conf=99") == 0)
+			{
+				pst_sample_cfg->f64_confidence = 99.0;
+				pst_sample_cfg->f64_z = 2.575829;
+			}
+
 			if (strcmp(pstr_arg, "-f=all") == 0)
 			{
 				memcpy(pab32_selected_tech, &ab32_b_tech_all[0], TECH_MAX * sizeof(bool32_t));
@@ -935,6 +1382,20 @@ static void_t print_help_commands(const char *pstr_exec_name)
 	printf("\n\t -dc \t Execute Diagnostic Coverage (DC) measurement experiments");
 	printf("\n\t -s=size \t Maximum size of images. Size can be one of those values: 20, 40, 80, 160, 320, 640");
 	printf("\n\t -f=selection \t Filter techniques to the given selection: all, best, best_dc, best_dc_time");
+	printf("\n\t -queue=file \t Single bit campaign (-dc) through a resumable queue file of chunks (Linux, square matrices)");
+	printf("\n\t -workers=N \t Number of local worker processes of the -queue campaign (default 1)");
+	printf("\n\t -chunk=bits \t Bits per chunk when the -queue file is created (default %u)", FI_QUEUE_CHUNK_BITS);
+	printf("\n\t -lease=sec \t Lease of a claimed chunk, renewed while it runs; expired chunks are claimed again by any host (default %u)", FI_QUEUE_LEASE_SEC);
+	printf("\n\t -idx=format \t Undetected faults of the -dc campaign: bin (bitmaps, default, see fi_idx_reader.c), csv");
+	printf("\n\t -fi_scalar=mode \t Exhaustive single bit campaign (-dc) of the scalar techniques instead of the AVX ones: runs (one execution per fault), lanes (%u faults per execution)", FI_LANES);
+	printf("\n\t -fi_prune \t Exhaustive single bit campaign (-dc) with the equivalent faults in A executed once (XOR, TWOS and CRC AVX techniques, B = 0), same DC");
+	printf("\n\t -fi_var=var \t Single bit campaign (-dc) of the AVX techniques in c (C in memory) or acc (accumulators) instead of A and B (build with -DFI_HOOK)");
+	printf("\n\t -fi_at=i,k \t Iteration of the -fi_var faults: C before the iteration (i, k), accumulators after the iteration k (default: middle of the loops)");
+	printf("\n\t -seed=N \t Seed of the random numbers (matrices, sampled sites, random values), written in the CSV files (default %llu)", (unsigned long long)RNG_SEED_DEFAULT);
+	printf("\n\t -sample=mode \t Sampled single bit campaign (-dc) instead of the exhaustive one: uniform, stratified (sign / exponent / mantissa)");
+	printf("\n\t -margin=m \t Stop the sampled campaign when the DC interval is DC +- m %% (default %.1f)", FI_SAMPLE_MARGIN);
+	printf("\n\t -conf=c \t Confidence level of the DC interval: 90, 95 (default), 99");
+	printf("\n\t -samples_max=N \t Maximum number of samples per technique and size (default %u)", FI_SAMPLE_MAX);
 	printf("\n\t Note: No argument means all experiments");
 	printf("\n\t Example:");
 	printf("\n\t\t %s -t -s=320 -f=best_dc", pstr_exec_name);
@@ -1025,7 +1486,119 @@ static bool32_t execute_unit_test(bool32_t ab32_selected_tech[TECH_MAX], float32
 		}
 	}
 
+	/* 4. Lanes execution of the scalar techniques (-fi_scalar=lanes): the signature of each lane has to be the one
+	**    of the technique executed with the fault of the lane (20 x 20 x 20 blocks of A and B) */
+	{
+		static const uint32_t kaui32_lane_element[FI_LANES] = { 0u, 5u, 210u, 399u, 0u, 19u, 200u, 399u },  /* A: lanes 0-3, B: lanes 4-7 */
+			kaui32_lane_bit[FI_LANES] = { 31u, 30u, 22u, 3u, 31u, 25u, 0u, 29u };
+		const uint32_t ui32_dim = kaui32_matrix_size[eSIZE_MIN];
+		uint32_t aui32_site_a[FI_LANES],
+			aui32_site_b[FI_LANES],
+			aui32_flip[FI_LANES],
+			aui32_sig[FI_LANES],
+			ui32_lane,
+			ui32_bit;
+		float32_t *paf32_m_fi,
+			*paf32_mc_lanes = (float32_t*)malloc((size_t)ui32_dim * ui32_dim * FI_LANES * sizeof(float32_t));
+
+		assert(paf32_mc_lanes != NULL);
+		for (ui32_lane = 0u; ui32_lane < FI_LANES; ui32_lane++)
+		{
+			aui32_site_a[ui32_lane] = (ui32_lane < (FI_LANES / 2u)) ? kaui32_lane_element[ui32_lane] : FI_LANES_NO_SITE;
+			aui32_site_b[ui32_lane] = (ui32_lane < (FI_LANES / 2u)) ? FI_LANES_NO_SITE : kaui32_lane_element[ui32_lane];
+			aui32_flip[ui32_lane] = 1u << kaui32_lane_bit[ui32_lane];
+		}
+		for (e_tech = TECH_XOR_EXTERNAL; e_tech < TECH_XOR_FLET; e_tech++)
+		{
+			if (ab32_selected_tech[e_tech])
+			{
+				matrix2zeros(&paf32_mc_lanes[0], ui32_dim * FI_LANES, ui32_dim);
+				_mm256_storeu_si256((__m256i*)&aui32_sig[0u], smm_lanes_fi(e_tech, ui32_dim, ui32_dim, ui32_dim, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc_lanes[0],
+					_mm256_loadu_si256((const __m256i*)&aui32_site_a[0u]), _mm256_loadu_si256((const __m256i*)&aui32_site_b[0u]),
+					_mm256_loadu_si256((const __m256i*)&aui32_flip[0u])));
+
+				b32_cmp = TRUE;
+				for (ui32_lane = 0u; ui32_lane < FI_LANES; ui32_lane++)
+				{
+					paf32_m_fi = (ui32_lane < (FI_LANES / 2u)) ? paf32_ma : paf32_mb;
+					ui32_bit = (kaui32_lane_element[ui32_lane] * 32u) + kaui32_lane_bit[ui32_lane];
+					mem_fi(&paf32_m_fi[0], ui32_bit);
+					matrix2zeros(&paf32_mc[0], ui32_dim, ui32_dim);
+					b32_cmp = b32_cmp && (ptr_fn_smm_technique[e_tech](ui32_dim, ui32_dim, ui32_dim, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc[0]) == aui32_sig[ui32_lane]);
+					mem_fi(&paf32_m_fi[0], ui32_bit);
+				}
+				printf("\n\t Unit Test lanes   (%25s): %4s", pstr_technique[e_tech], b32_cmp ? "OK" : "FAIL");
+			}
+		}
+		free(paf32_mc_lanes);
+	}
+
+	/* 5. Random numbers: lane l of rng_u32_x8 (matrix2rand) is the stream RNG_STREAM_MATRIX + l of rng_u32 */
+	{
+		st_rng_x8_t st_rng_x8;
+		st_rng_t ast_rng_lane[RNG_LANES];
+		uint32_t aui32_x8[RNG_LANES],
+			ui32_lane;
+
+		rng_seed_x8(&st_rng_x8, ui64_rng_seed, RNG_STREAM_MATRIX);
+		for (ui32_lane = 0u; ui32_lane < RNG_LANES; ui32_lane++)
+		{
+			rng_seed(&ast_rng_lane[ui32_lane], ui64_rng_seed, RNG_STREAM_MATRIX + ui32_lane);
+		}
+		b32_cmp = TRUE;
+		for (ui32_idx = 0u; ui32_idx < 1000u; ui32_idx++)
+		{
+			_mm256_storeu_si256((__m256i*)&aui32_x8[0u], rng_u32_x8(&st_rng_x8));
+			for (ui32_lane = 0u; ui32_lane < RNG_LANES; ui32_lane++)
+			{
+				b32_cmp = b32_cmp && (aui32_x8[ui32_lane] == rng_u32(&ast_rng_lane[ui32_lane]));
+			}
+		}
+		printf("\n\t Unit Test random numbers (seed %llu): %4s", (unsigned long long)ui64_rng_seed, b32_cmp ? "OK" : "FAIL");
+		b_result = b_result && b32_cmp;
+	}
+
+	/* 6. Pruned campaign (-fi_prune): same detected faults and flags in A as fault by fault, with nonzero values
+	**    repeated in the columns of A (1.0f: the fault of bit 30 is Inf and is not grouped) and B = 0. Only the faults
+	**    in A are compared: with A != 0 a fault in B changes the copy of C of the thread for the next faults */
+	{
+		const uint32_t ui32_dim = kaui32_matrix_size[eSIZE_MIN],
+			ui32_bits = ui32_dim * ui32_dim * sizeof(float32_t) * CHAR_BIT;
+		float32_t *paf32_ma_p = (float32_t*)malloc(ui32_dim * ui32_dim * sizeof(float32_t)),
+			*paf32_mb_p = (float32_t*)malloc(ui32_dim * ui32_dim * sizeof(float32_t)),
+			*paf32_mc_p = (float32_t*)malloc(ui32_dim * ui32_dim * sizeof(float32_t));
+		uint8_t *pau8_full = (uint8_t*)malloc(ui32_bits),
+			*pau8_prune = (uint8_t*)malloc(ui32_bits);
+		uint32_t ui32_dc_golden;
+
+		assert((paf32_ma_p != NULL) && (paf32_mb_p != NULL) && (paf32_mc_p != NULL) && (pau8_full != NULL) && (pau8_prune != NULL));
+		for (ui32_idx = 0u; ui32_idx < (ui32_dim * ui32_dim); ui32_idx++)
+		{
+			paf32_ma_p[ui32_idx] = ((ui32_idx % ui32_dim) < 4u) ? 0.0f : ((ui32_idx % 3u) == 0u) ? 1.0f : -0.375f * (float32_t)(ui32_idx % 5u);
+		}
+		matrix2zeros(&paf32_mb_p[0], ui32_dim, ui32_dim);
+		for (e_tech = TECH_INTEL_XOR_EXTERNAL; e_tech < TECH_INTEL_COMB; e_tech++)
+		{
+			if (ab32_selected_tech[e_tech] && fi_prune_a_proven(e_tech))
+			{
+				matrix2zeros(&paf32_mc_p[0], ui32_dim, ui32_dim);
+				ui32_dc_golden = ptr_fn_smm_technique[e_tech](ui32_dim, ui32_dim, ui32_dim, 1.0f, paf32_ma_p, paf32_mb_p, paf32_mc_p);
+				b32_cmp = (mem_fi_bits_omp(e_tech, ui32_dim, ui32_dim, ui32_dim, 1.0f, paf32_ma_p, paf32_mb_p, paf32_mc_p, ui32_dc_golden, 0u, ui32_bits, TRUE, FALSE, pau8_full) ==
+					mem_fi_bits_prune_omp(e_tech, ui32_dim, ui32_dim, ui32_dim, 1.0f, paf32_ma_p, paf32_mb_p, paf32_mc_p, ui32_dc_golden, 0u, ui32_bits, TRUE, FALSE, pau8_prune));
+				b32_cmp = b32_cmp && (memcmp(pau8_full, pau8_prune, ui32_bits) == 0);
+				printf("\n\t Unit Test prune   (%25s): %4s", pstr_technique[e_tech], b32_cmp ? "OK" : "FAIL");
+				b_result = b_result && b32_cmp;
+			}
+		}
+		free(paf32_ma_p);
+		free(paf32_mb_p);
+		free(paf32_mc_p);
+		free(pau8_full);
+		free(pau8_prune);
+	}
+
 	return b_result;
+
 }
 
 static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc)
@@ -1080,7 +1653,7 @@ static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_te
 		perror("File opening failed");
 		return EXIT_FAILURE;
 	}
-	fprintf(p_file, "Technique, Size, Time");
+	fprintf(p_file, "Technique, Size, Seed, Time");
 #endif
 
 
@@ -1099,7 +1672,7 @@ static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_te
 		perror("File opening failed");
 		return EXIT_FAILURE;
 	}
-	fprintf(p_file, "Technique, Size, Time");
+	fprintf(p_file, "Technique, Size, Seed, Time");
 #endif
 
 
@@ -1122,7 +1695,7 @@ static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_te
 				f32_time_max = 0.0f;
 				f32_time_avg = 0.0f;
 #if defined __linux__ || defined _WIN32
-				fprintf(p_file, "\n%s,%u,", pstr_technique[e_tech], kaui32_matrix_size[e_size]);
+				fprintf(p_file, "\n%s,%u,%llu,", pstr_technique[e_tech], kaui32_matrix_size[e_size], (unsigned long long)ui64_rng_seed);
 #endif
 				for (ui32_idx = 0u; ui32_idx < MEASUREMENT_LOOPS; ui32_idx++)
 				{
@@ -1184,7 +1757,7 @@ static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_te
 static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], bool32_t b32_double_error,
 	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc,
 	float32_t* const paf32_ma_fi, float32_t* const paf32_mb_fi,
-	char *argv[])
+	e_fi_idx_format e_idx_format, e_fi_scalar e_scalar, bool32_t b32_prune, char *argv[])
 {
 
 #if defined Square_mtrx
@@ -1192,7 +1765,8 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 	e_enum_size_2d e_size;
 #else
 	uint32_t ui32_combinations_a, ui32_combinations_b, ui32_idx_bit_aux, launch_number;
-	ui32_combinations_a = (uint32_t)strtoul(ar	gv[5], NULL, 10);
+	uint8_t *pau8_undetected_b;
+	ui32_combinations_a = (uint32_t)strtoul(argv[5], NULL, 10);
 	ui32_combinations_b = (uint32_t)strtoul(argv[6], NULL, 10);
 	ui32_idx_bit_aux = (uint32_t)strtoul(argv[7], NULL, 10);
 	launch_number = (uint32_t)strtoul(argv[8], NULL, 10);
@@ -1207,7 +1781,15 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 		ui32_dc_cnt_all = 0u,
 		ui32_dc_cnt = 0u,
 		aui32_dc_value[e_FI_VAR_MAX];
+	uint8_t *pau8_undetected;
 	float32_t f32_alpha = 1.0f;
+	/* Techniques of the campaign and execution of the faults */
+	const e_enum_technique e_tech_first = (e_scalar == e_FI_SCALAR_NONE) ? TECH_INTEL_XOR_EXTERNAL : TECH_XOR_EXTERNAL,
+		e_tech_end = (e_scalar == e_FI_SCALAR_NONE) ? TECH_INTEL_COMB : TECH_XOR_FLET;
+	uint32_t(*pfn_fi_bits)(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+		const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+		uint32_t ui32_bit_first, uint32_t ui32_bit_end, bool32_t b32_fi_a, bool32_t b32_fi_b, uint8_t* const pau8_undetected) =
+		(e_scalar == e_FI_SCALAR_LANES) ? mem_fi_bits_lanes_omp : (b32_prune ? mem_fi_bits_prune_omp : mem_fi_bits_omp);
 	//f32_dc;
 //DEF_TIME_VAR(tmr_start);
 //DEF_TIME_VAR(tmr_end);
@@ -1248,7 +1830,7 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 #endif
 
 	//TECH_INTEL_XOR_CRC TECH_INTEL_ONES_INTERNAL TECH_INTEL_XOR_EXTERNAL TECH_INTEL_COMB
-	for (e_tech = TECH_INTEL_XOR_EXTERNAL; e_tech < TECH_INTEL_COMB; e_tech++)
+	for (e_tech = e_tech_first; e_tech < e_tech_end; e_tech++)
 	{
 		if (ab32_selected_tech[e_tech])
 		{
@@ -1277,10 +1859,10 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 
 #ifdef Square_mtrx
 			snprintf(str_file_name, 200u, "%s_fi.csv", pstr_technique[e_tech]);
-			snprintf(str_file_name_idx_fi, 200u, "%s_fi_idx.csv", pstr_technique[e_tech]);
+			snprintf(str_file_name_idx_fi, 200u, "%s_fi_idx.%s", pstr_technique[e_tech], kapstr_fi_idx_ext[e_idx_format]);
 #else
 			snprintf(str_file_name, 200u, "%s_fi_%u.csv", pstr_technique[e_tech], launch_number);
-			snprintf(str_file_name_idx_fi, 200u, "%s_fi_%u_idx.csv", pstr_technique[e_tech], launch_number);
+			snprintf(str_file_name_idx_fi, 200u, "%s_fi_%u_idx.%s", pstr_technique[e_tech], launch_number, kapstr_fi_idx_ext[e_idx_format]);
 #endif
 
 
@@ -1290,7 +1872,7 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 				return EXIT_FAILURE;
 			}
 
-			if ((err = fopen_s(&p_file_idx_fi, str_file_name_idx_fi, "w+")) != 0)
+			if ((err = fopen_s(&p_file_idx_fi, str_file_name_idx_fi, kapstr_fi_idx_mode[e_idx_format])) != 0)
 			{
 				fprintf(stderr, "cannot open file '%s': %u\n", str_file_name_idx_fi, err);
 				return EXIT_FAILURE;
@@ -1324,10 +1906,10 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 
 #ifdef Square_mtrx
 			snprintf(str_file_name, 200u, "%s_fi.csv", pstr_technique[e_tech]);
-			snprintf(str_file_name_idx_fi, 200u, "%s_fi_idx.csv", pstr_technique[e_tech]);
+			snprintf(str_file_name_idx_fi, 200u, "%s_fi_idx.%s", pstr_technique[e_tech], kapstr_fi_idx_ext[e_idx_format]);
 #else
 			snprintf(str_file_name, 200u, "%s_fi_%u.csv", pstr_technique[e_tech], launch_number);
-			snprintf(str_file_name_idx_fi, 200u, "%s_fi_%u_idx.csv", pstr_technique[e_tech], launch_number);
+			snprintf(str_file_name_idx_fi, 200u, "%s_fi_%u_idx.%s", pstr_technique[e_tech], launch_number, kapstr_fi_idx_ext[e_idx_format]);
 #endif
 
 
@@ -1337,7 +1919,7 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 				return EXIT_FAILURE;
 			}
 
-			if ((p_file_idx_fi = fopen(str_file_name_idx_fi, "w+")) == NULL)
+			if ((p_file_idx_fi = fopen(str_file_name_idx_fi, kapstr_fi_idx_mode[e_idx_format])) == NULL)
 			{
 				fprintf(stderr, "cannot open file '%s'\n", str_file_name_idx_fi);
 				return EXIT_FAILURE;
@@ -1360,68 +1942,38 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 
 				/* 1. Store the Execution Signature (ES) for comparing with the value obtained after the fault injection*/
 				aui32_dc_value[e_FI_VAR_NONE] = ptr_fn_smm_technique[e_tech](kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-				for (ui32_idx_bit = 0u; ui32_idx_bit < ui32_combinations; ui32_idx_bit++) {
-					mem_fi(&paf32_ma_fi[0], ui32_idx_bit);
-					mem_fi(&paf32_mb_fi[0], ui32_idx_bit);
-
-					aui32_dc_value[e_FI_VAR_A] = ptr_fn_smm_technique[e_tech](kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-					aui32_dc_value[e_FI_VAR_B] = ptr_fn_smm_technique[e_tech](kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
-
-					ui32_dc_cnt_all += 2u;
-					//ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
-					//ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
 
-					if (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) {
-						ui32_dc_cnt += 1u;
-					}
-					else {
-						fprintf(p_file_idx_fi, "%u,", ui32_idx_bit);
-					}
-					if (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) {
-						ui32_dc_cnt += 1u;
-					}
-					else {
-						fprintf(p_file_idx_fi, "%u,", ui32_idx_bit);
-					}
-
-					mem_fi(&paf32_ma_fi[0], ui32_idx_bit);
-					mem_fi(&paf32_mb_fi[0], ui32_idx_bit);
-				}
-				fprintf(p_file, "\n%s, %u, %u, %u", pstr_technique[e_tech], kaui32_matrix_size[e_size], ui32_dc_cnt_all, ui32_dc_cnt);
+				/* 2. Fault injection in A and B for every bit, split between the threads (see mem_fi_bits_omp / mem_fi_bits_lanes_omp) */
+				pau8_undetected = (uint8_t*)calloc(ui32_combinations, sizeof(uint8_t));
+				assert(pau8_undetected != NULL);
+				ui32_dc_cnt = pfn_fi_bits(e_tech, kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], f32_alpha, paf32_ma, paf32_mb, paf32_mc,
+					aui32_dc_value[e_FI_VAR_NONE], 0u, ui32_combinations, TRUE, TRUE, pau8_undetected);
+				ui32_dc_cnt_all = 2u * ui32_combinations;
+
+				/* 3. Undetected faults in bit order (A before B), independent of the number of threads */
+				fi_idx_write(p_file_idx_fi, e_idx_format, kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], kaui32_matrix_size[e_size],
+					0u, ui32_combinations, ui32_combinations, TRUE, pau8_undetected, pau8_undetected);
+				free(pau8_undetected);
+				fprintf(p_file, "\n%s, %u, %u, %u, %llu", pstr_technique[e_tech], kaui32_matrix_size[e_size], ui32_dc_cnt_all, ui32_dc_cnt, (unsigned long long)ui64_rng_seed);
 			}
 #else
 			// 1. Store the Execution Signature (ES) for comparing with the value obtained after the fault injection
 			aui32_dc_value[e_FI_VAR_NONE] = ptr_fn_smm_technique[e_tech](M, N, K, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-			fprintf(p_file, "diagnostic_technique,detected_errors_a,total_detected_errors,number_of_fi,M, N, K,idx_fi_initial,idx_fi_final_a,idx_fi_final_b,launch number,");
+			fprintf(p_file, "diagnostic_technique,detected_errors_a,total_detected_errors,number_of_fi,M, N, K,idx_fi_initial,idx_fi_final_a,idx_fi_final_b,launch number,seed,");
 			fprintf(p_file, "\n%s, ", pstr_technique[e_tech]);
-			for (ui32_idx_bit = ui32_idx_bit_aux; ui32_idx_bit < ui32_comb_a_max; ui32_idx_bit++) {
-				mem_fi(&paf32_ma_fi[0], ui32_idx_bit);
-				aui32_dc_value[e_FI_VAR_A] = ptr_fn_smm_technique[e_tech](M, N, K, f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-				if (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) {
-					ui32_dc_cnt += 1u;
-				}
-				else {
-					fprintf(p_file_idx_fi, "%u,", ui32_idx_bit);
-
-				}
-				mem_fi(&paf32_ma_fi[0], ui32_idx_bit);
-			}
-
+			pau8_undetected = (uint8_t*)calloc(ui32_combinations_a, sizeof(uint8_t));
+			pau8_undetected_b = (uint8_t*)calloc(ui32_combinations_b, sizeof(uint8_t));
+			assert((pau8_undetected != NULL) && (pau8_undetected_b != NULL));
+			ui32_dc_cnt = pfn_fi_bits(e_tech, M, N, K, f32_alpha, paf32_ma, paf32_mb, paf32_mc,
+				aui32_dc_value[e_FI_VAR_NONE], ui32_idx_bit_aux, ui32_comb_a_max, TRUE, FALSE, pau8_undetected);
 			fprintf(p_file, "%u,", ui32_dc_cnt);
-			fprintf(p_file_idx_fi, "\n");
-			for (ui32_idx_bit = ui32_idx_bit_aux; ui32_idx_bit < ui32_comb_b_max; ui32_idx_bit++)
-			{
-				mem_fi(&paf32_mb_fi[0], ui32_idx_bit);
-				aui32_dc_value[e_FI_VAR_B] = ptr_fn_smm_technique[e_tech](M, N, K, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
-				if (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) {
-					ui32_dc_cnt += 1u;
-				}
-				else {
-					fprintf(p_file_idx_fi, "%u,", ui32_idx_bit);
-				}
-				mem_fi(&paf32_mb_fi[0], ui32_idx_bit);
-			}
+			ui32_dc_cnt += pfn_fi_bits(e_tech, M, N, K, f32_alpha, paf32_ma, paf32_mb, paf32_mc,
+				aui32_dc_value[e_FI_VAR_NONE], ui32_idx_bit_aux, ui32_comb_b_max, FALSE, TRUE, pau8_undetected_b);
+			fi_idx_write(p_file_idx_fi, e_idx_format, M, N, K, ui32_idx_bit_aux, ui32_combinations_a, ui32_combinations_b, FALSE, pau8_undetected, pau8_undetected_b);
+			free(pau8_undetected);
+			free(pau8_undetected_b);
 			fprintf(p_file, "%u,%u,%d,%d,%d,%u,%u,%u,%u", ui32_dc_cnt, (ui32_combinations_a + ui32_combinations_b), M, N, K, ui32_idx_bit_aux, ui32_comb_a_max, ui32_comb_b_max, launch_number);
+			fprintf(p_file, ",%llu", (unsigned long long)ui64_rng_seed);
 
 #endif
 			// Close the file where the result are been stored
@@ -1437,72 +1989,1042 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 	return EXIT_SUCCESS;
 }
 
-static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX],
-	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc,
-	float32_t* const paf32_ma_fi, float32_t* const paf32_mb_fi,
-	float32_t* const paf32_ma_rand, float32_t* const paf32_mb_rand, float32_t* const paf32_mc_rand)
+/******************************************************************************
+**				Name:    measure_dc__error_bit_sampled
+******************************************************************************/
+/*!
+** @brief  Statistical single bit campaign (A = B = 0): instead of all the bits of A and B,
+**         batches of FI_SAMPLE_BATCH fault sites are drawn (uniformly, or stratified by
+**         sign / exponent / mantissa bit with the same number of samples per stratum) until
+**         the half width of the confidence interval of the DC is not larger than the requested
+**         margin or the maximum number of samples is reached.
+**         The interval is the Agresti-Coull one (stratified: per stratum, weighted with the
+**         share of the stratum bits 1/32, 8/32 and 23/32), which stays meaningful when all
+**         the sampled faults are detected. The reported DC is the sampled one.
+**         Results per technique in <tech>_fi_sample.csv and undetected sites in
+**         <tech>_fi_sample_idx.csv (A<bit> / B<bit>).
+**
+** @param[in] e_size_max          Maximum matrix size (square matrices)
+** @param[in] ab32_selected_tech  Selected techniques
+** @param[in] pst_sample_cfg      Sampling mode, margin, confidence and maximum number of samples
+** @param[in] paf32_ma            Pointer to matrix A
+** @param[in] paf32_mb            Pointer to matrix B
+** @param[in] paf32_mc            Pointer to matrix C
+**
+** @return  int32_t EXIT_SUCCESS / EXIT_FAILURE
+**
+******************************************************************************/
+static int32_t measure_dc__error_bit_sampled(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], const st_fi_sample_cfg_t *pst_sample_cfg,
+	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc)
 {
+	static const uint32_t kaui32_strat_first[e_FI_STRAT_MAX] = { 31u, 23u, 0u },  /* First bit of each stratum */
+		kaui32_strat_bits[e_FI_STRAT_MAX] = { 1u, 8u, 23u };                     /* Bits of each stratum */
 	e_enum_technique e_tech;
-	e_enum_size_2d e_size;
-	size_t size_a;
-	size_t size_b;
-
-	uint32_t ui32_idx_value,
-		ui32_matrix_size,
-		ui32_dc_cnt_all = 0u,
-		ui32_dc_cnt = 0u,
-		ui32_combinations_a = 0u,
-		ui32_combinations_b = 0u,
-		aui32_dc_value[e_FI_VAR_MAX];
-	uint32_t *pui32_a,
-		*pui32_b;
-	float32_t f32_alpha = 1.0f,
-		f32_dc;
-	DEF_TIME_VAR(tmr_start);
-	DEF_TIME_VAR(tmr_end);
+	e_fi_stratum e_strat;
+	FILE *p_file,
+		*p_file_idx_fi;
+	char str_file_name[200u];
+	uint64_t aui64_site[FI_SAMPLE_BATCH],
+		ui64_bits_a,
+		ui64_elements;
+	uint8_t aui8_detected[FI_SAMPLE_BATCH];
+	uint32_t ui32_m, ui32_n, ui32_k,
+		ui32_idx,
+		ui32_bit,
+		ui32_dc_golden,
+		ui32_samples,
+		ui32_detected,
+		aui32_strat_samples[e_FI_STRAT_MAX],
+		aui32_strat_detected[e_FI_STRAT_MAX];
+	float64_t f64_z2 = pst_sample_cfg->f64_z * pst_sample_cfg->f64_z,
+		f64_dc,
+		f64_center,
+		f64_half,
+		f64_var,
+		f64_p;
+	float32_t f32_alpha = 1.0f;
 	DEF_TIME_VAR(tmr_start_exp);
 	DEF_TIME_VAR(tmr_end_exp);
 	float64_t time_interval;
-#ifdef _WIN32
-	FILE *p_file;
-	char str_file_name[200u];
-	errno_t err;
-	time_t time_now = time(NULL);
-	struct tm time_info;
+#ifdef Square_mtrx
+	e_enum_size_2d e_size;
+#endif
 
-	/* 1. Open output file (csv) */
-	localtime_s(&time_info, &time_now);
-	strftime(str_file_name, sizeof(str_file_name), "dc_random_value_csv_%y_%m_%d__%A__%H_%M_%S.csv", &time_info);
-	if ((err = fopen_s(&p_file, str_file_name, "w+")) != 0)
-	{
-		fprintf(stderr, "cannot open file '%s': %u\n", str_file_name, err);
-		return EXIT_FAILURE;
-	}
-	fprintf(p_file, "Technique, Size, DC");
+	GET_TIME(tmr_start_exp);
+#ifdef Square_mtrx
+	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
+	matrix2zeros(&paf32_ma[0u], MAX_DIM, MAX_DIM);
+	matrix2zeros(&paf32_mb[0u], MAX_DIM, MAX_DIM);
+	matrix2zeros(&paf32_mc[0u], MAX_DIM, MAX_DIM);
+#else
+	matrix2zeros(&paf32_ma[0u], M, K);
+	matrix2zeros(&paf32_mb[0u], K, N);
+	matrix2zeros(&paf32_mc[0u], M, N);
 #endif
 
-	/* 1. Initialize matrixes */
-	matrix2rand(&paf32_ma[0], MAX_DIM, MAX_DIM);
-	matrix2rand(&paf32_mb[0], MAX_DIM, MAX_DIM);
-	matrix2zeros(&paf32_mc[0], MAX_DIM, MAX_DIM);
+	for (e_tech = TECH_INTEL_XOR_EXTERNAL; e_tech < TECH_INTEL_COMB; e_tech++)
+	{
+		if (!ab32_selected_tech[e_tech])
+		{
+			continue;
+		}
 
-	matrix2rand(&paf32_ma_rand[0], MAX_DIM, MAX_DIM);
-	matrix2rand(&paf32_mb_rand[0], MAX_DIM, MAX_DIM);
-	matrix2zeros(&paf32_mc_rand[0], MAX_DIM, MAX_DIM);
+		/* 1. Open output files (csv) */
+		snprintf(str_file_name, sizeof(str_file_name), "%s_fi_sample.csv", pstr_technique[e_tech]);
+		if ((p_file = fopen(str_file_name, "w+")) == NULL)
+		{
+			fprintf(stderr, "cannot open file '%s'\n", str_file_name);
+			return EXIT_FAILURE;
+		}
+		snprintf(str_file_name, sizeof(str_file_name), "%s_fi_sample_idx.csv", pstr_technique[e_tech]);
+		if ((p_file_idx_fi = fopen(str_file_name, "w+")) == NULL)
+		{
+			fprintf(stderr, "cannot open file '%s'\n", str_file_name);
+			fclose(p_file);
+			return EXIT_FAILURE;
+		}
+		fprintf(p_file, "diagnostic_technique,M,N,K,sampling,number_of_fi,detected_errors,dc,dc_low,dc_high,confidence,dc_sign,dc_exponent,dc_mantissa,seed");
 
-	/* 3. Execute DC measurement */
-	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
-	GET_TIME(tmr_start_exp);
-	for (e_tech = TECH_NONE; e_tech < TECH_MAX; e_tech++)
-	{
-		if (ab32_selected_tech[e_tech])
+#ifdef Square_mtrx
+		for (e_size = eSIZE_MIN; e_size <= e_size_max; e_size++)
 		{
-			printf("\n\t Experiment %2u / %2u (%25s): ", (e_tech + 1u), (TECH_MAX + 1u), pstr_technique[e_tech]);
-			for (e_size = eSIZE_MIN; e_size <= e_size_max; e_size++)
+			ui32_m = kaui32_matrix_size[e_size];
+			ui32_n = kaui32_matrix_size[e_size];
+			ui32_k = kaui32_matrix_size[e_size];
+#else
+		{
+			ui32_m = M;
+			ui32_n = N;
+			ui32_k = K;
+#endif
+			ui64_bits_a = (uint64_t)ui32_m * ui32_k * sizeof(float32_t) * CHAR_BIT;
+			ui64_elements = ((uint64_t)ui32_m * ui32_k) + ((uint64_t)ui32_k * ui32_n);
+			ui32_samples = 0u;
+			ui32_detected = 0u;
+			memset(aui32_strat_samples, 0, sizeof(aui32_strat_samples));
+			memset(aui32_strat_detected, 0, sizeof(aui32_strat_detected));
+			f64_dc = 0.0;
+			f64_center = 0.0;
+			f64_half = 1.0;
+
+			/* 2. Golden ES */
+			ui32_dc_golden = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+
+			/* 3. Batches of samples until the margin (or the maximum number of samples) is reached */
+			while ((ui32_samples < pst_sample_cfg->ui32_samples_max) && ((ui32_samples == 0u) || ((100.0 * f64_half) > pst_sample_cfg->f64_margin)))
 			{
-				size_a = M * K * sizeof(float32_t);
-				size_b = K * N * sizeof(float32_t);
-				ui32_matrix_size = kaui32_matrix_size[e_size];
+				/* Sites drawn serially (same sites for any number of threads): element of A or B, then bit */
+				for (ui32_idx = 0u; ui32_idx < FI_SAMPLE_BATCH; ui32_idx++)
+				{
+					e_strat = (pst_sample_cfg->e_mode == e_FI_SAMPLE_STRATIFIED) ? (e_fi_stratum)((ui32_samples + ui32_idx) % e_FI_STRAT_MAX) : e_FI_STRAT_MAX;
+					ui32_bit = (e_strat < e_FI_STRAT_MAX) ? (kaui32_strat_first[e_strat] + rng_range(&st_rng, kaui32_strat_bits[e_strat])) : rng_range(&st_rng, sizeof(float32_t) * CHAR_BIT);
+					aui64_site[ui32_idx] = ((((uint64_t)rng_u32(&st_rng) << 32) | (uint64_t)rng_u32(&st_rng)) % ui64_elements) * (sizeof(float32_t) * CHAR_BIT) + ui32_bit;
+				}
+				mem_fi_sites_omp(e_tech, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, ui32_dc_golden,
+					ui64_bits_a, &aui64_site[0u], FI_SAMPLE_BATCH, &aui8_detected[0u]);
+
+				for (ui32_idx = 0u; ui32_idx < FI_SAMPLE_BATCH; ui32_idx++)
+				{
+					ui32_bit = (uint32_t)(aui64_site[ui32_idx] % (sizeof(float32_t) * CHAR_BIT));
+					e_strat = (ui32_bit == 31u) ? e_FI_STRAT_SIGN : ((ui32_bit >= 23u) ? e_FI_STRAT_EXPONENT : e_FI_STRAT_MANTISSA);
+					aui32_strat_samples[e_strat]++;
+					if (aui8_detected[ui32_idx] != 0u)
+					{
+						aui32_strat_detected[e_strat]++;
+						ui32_detected++;
+					}
+					else if (aui64_site[ui32_idx] < ui64_bits_a)
+					{
+						fprintf(p_file_idx_fi, "A%llu,", (unsigned long long)aui64_site[ui32_idx]);
+					}
+					else
+					{
+						fprintf(p_file_idx_fi, "B%llu,", (unsigned long long)(aui64_site[ui32_idx] - ui64_bits_a));
+					}
+				}
+				ui32_samples += FI_SAMPLE_BATCH;
+
+				/* 4. DC and half width of its interval */
+				if (pst_sample_cfg->e_mode == e_FI_SAMPLE_STRATIFIED)
+				{
+					f64_dc = 0.0;
+					f64_center = 0.0;
+					f64_var = 0.0;
+					for (e_strat = e_FI_STRAT_SIGN; e_strat < e_FI_STRAT_MAX; e_strat++)
+					{
+						f64_p = ((float64_t)aui32_strat_detected[e_strat] + (0.5 * f64_z2)) / ((float64_t)aui32_strat_samples[e_strat] + f64_z2);
+						f64_dc += ((float64_t)kaui32_strat_bits[e_strat] / 32.0) * ((float64_t)aui32_strat_detected[e_strat] / (float64_t)aui32_strat_samples[e_strat]);
+						f64_center += ((float64_t)kaui32_strat_bits[e_strat] / 32.0) * f64_p;
+						f64_var += ((float64_t)(kaui32_strat_bits[e_strat] * kaui32_strat_bits[e_strat]) / 1024.0) * (f64_p * (1.0 - f64_p)) / ((float64_t)aui32_strat_samples[e_strat] + f64_z2);
+					}
+				}
+				else
+				{
+					f64_p = ((float64_t)ui32_detected + (0.5 * f64_z2)) / ((float64_t)ui32_samples + f64_z2);
+					f64_dc = (float64_t)ui32_detected / (float64_t)ui32_samples;
+					f64_center = f64_p;
+					f64_var = (f64_p * (1.0 - f64_p)) / ((float64_t)ui32_samples + f64_z2);
+				}
+				f64_half = pst_sample_cfg->f64_z * sqrt(f64_var);
+			}
+
+			printf("\n\t\t [%3u x %3u x %3u] %-26s %u samples, DC = %8.4f %% [%8.4f, %8.4f]", ui32_m, ui32_n, ui32_k, pstr_technique[e_tech], ui32_samples,
+				100.0 * f64_dc, 100.0 * fmax(f64_center - f64_half, 0.0), 100.0 * fmin(f64_center + f64_half, 1.0));
+			fprintf(p_file, "\n%s,%u,%u,%u,%s,%u,%u,%.6f,%.6f,%.6f,%.2f", pstr_technique[e_tech], ui32_m, ui32_n, ui32_k,
+				(pst_sample_cfg->e_mode == e_FI_SAMPLE_STRATIFIED) ? "stratified" : "uniform", ui32_samples, ui32_detected,
+				100.0 * f64_dc, 100.0 * fmax(f64_center - f64_half, 0.0), 100.0 * fmin(f64_center + f64_half, 1.0), pst_sample_cfg->f64_confidence);
+			for (e_strat = e_FI_STRAT_SIGN; e_strat < e_FI_STRAT_MAX; e_strat++)
+			{
+				fprintf(p_file, ",%.6f", (aui32_strat_samples[e_strat] > 0u) ? ((100.0 * aui32_strat_detected[e_strat]) / aui32_strat_samples[e_strat]) : 0.0);
+			}
+			fprintf(p_file, ",%llu", (unsigned long long)ui64_rng_seed);
+			fprintf(p_file_idx_fi, "\n");
+		}
+
+		fclose(p_file);
+		fclose(p_file_idx_fi);
+	}
+
+	GET_TIME(tmr_end_exp);
+	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
+	printf("\n Experiments executed in %10.8lf [sec]", time_interval);
+	return EXIT_SUCCESS;
+}
+
+#ifdef FI_HOOK
+/******************************************************************************
+**				Name:    measure_dc__error_bit_hook
+******************************************************************************/
+/*!
+** @brief  Single bit campaign in C (A = B = 0) through the injection hook of the AVX
+**         techniques (build with -DFI_HOOK):
+**         - e_FI_VAR_C:   every bit of every element of C is flipped in memory before the
+**                         iteration (i, k) of the technique (-fi_at=i,k), i.e. in the middle
+**                         of the computation of row i (rows before i already computed).
+**         - e_FI_VAR_ACC: every bit of the accumulator of every element (i, j) of C is
+**                         flipped after its update of the iteration k (-fi_at=,k), in the
+**                         register (result256) before it is stored and checked.
+**         Results per technique in <tech>_fi_c.csv / <tech>_fi_acc.csv and the undetected
+**         faults in <tech>_fi_c_idx / <tech>_fi_acc_idx (.bin or .csv, first bitmap:
+**         bit (element of C * 32 + bit) of the fault, second bitmap empty).
+**
+** @param[in] e_size_max          Maximum matrix size (square matrices)
+** @param[in] ab32_selected_tech  Selected techniques
+** @param[in] pst_hook_cfg        Variable of the faults and iteration (i, k)
+** @param[in] e_idx_format        Format of the undetected faults files
+** @param[in] paf32_ma            Pointer to matrix A
+** @param[in] paf32_mb            Pointer to matrix B
+** @param[in] paf32_mc            Pointer to matrix C
+**
+** @return  int32_t EXIT_SUCCESS / EXIT_FAILURE
+**
+******************************************************************************/
+static int32_t measure_dc__error_bit_hook(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], const st_fi_hook_cfg_t *pst_hook_cfg,
+	e_fi_idx_format e_idx_format, float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc)
+{
+	const char *pstr_var = (pst_hook_cfg->e_var == e_FI_VAR_C) ? "c" : "acc";
+	e_enum_technique e_tech;
+	FILE *p_file,
+		*p_file_idx_fi;
+	char str_file_name[200u];
+	uint8_t *pau8_undetected;
+	uint32_t ui32_m, ui32_n, ui32_k,
+		ui32_at_i,
+		ui32_at_k,
+		ui32_faults,
+		ui32_dc_golden,
+		ui32_dc_cnt;
+	float32_t f32_alpha = 1.0f;
+	DEF_TIME_VAR(tmr_start_exp);
+	DEF_TIME_VAR(tmr_end_exp);
+	float64_t time_interval;
+#ifdef Square_mtrx
+	e_enum_size_2d e_size;
+#endif
+
+	assert((pst_hook_cfg->e_var == e_FI_VAR_C) || (pst_hook_cfg->e_var == e_FI_VAR_ACC));
+	GET_TIME(tmr_start_exp);
+#ifdef Square_mtrx
+	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
+	matrix2zeros(&paf32_ma[0u], MAX_DIM, MAX_DIM);
+	matrix2zeros(&paf32_mb[0u], MAX_DIM, MAX_DIM);
+#else
+	matrix2zeros(&paf32_ma[0u], M, K);
+	matrix2zeros(&paf32_mb[0u], K, N);
+#endif
+
+	for (e_tech = TECH_INTEL_XOR_EXTERNAL; e_tech < TECH_INTEL_COMB; e_tech++)
+	{
+		if (!ab32_selected_tech[e_tech])
+		{
+			continue;
+		}
+
+		/* 1. Open output files */
+		snprintf(str_file_name, sizeof(str_file_name), "%s_fi_%s.csv", pstr_technique[e_tech], pstr_var);
+		if ((p_file = fopen(str_file_name, "w+")) == NULL)
+		{
+			fprintf(stderr, "cannot open file '%s'\n", str_file_name);
+			return EXIT_FAILURE;
+		}
+		snprintf(str_file_name, sizeof(str_file_name), "%s_fi_%s_idx.%s", pstr_technique[e_tech], pstr_var, kapstr_fi_idx_ext[e_idx_format]);
+		if ((p_file_idx_fi = fopen(str_file_name, kapstr_fi_idx_mode[e_idx_format])) == NULL)
+		{
+			fprintf(stderr, "cannot open file '%s'\n", str_file_name);
+			fclose(p_file);
+			return EXIT_FAILURE;
+		}
+		fprintf(p_file, "diagnostic_technique,M,N,K,variable,i,k,number_of_fi,detected_errors,dc,seed");
+
+#ifdef Square_mtrx
+		for (e_size = eSIZE_MIN; e_size <= e_size_max; e_size++)
+		{
+			ui32_m = kaui32_matrix_size[e_size];
+			ui32_n = kaui32_matrix_size[e_size];
+			ui32_k = kaui32_matrix_size[e_size];
+#else
+		{
+			ui32_m = M;
+			ui32_n = N;
+			ui32_k = K;
+#endif
+			ui32_at_i = (pst_hook_cfg->ui32_i == FI_HOOK_AT_MIDDLE) ? (ui32_m / 2u) : ((pst_hook_cfg->ui32_i < ui32_m) ? pst_hook_cfg->ui32_i : (ui32_m - 1u));
+			ui32_at_k = (pst_hook_cfg->ui32_k == FI_HOOK_AT_MIDDLE) ? (ui32_k / 2u) : ((pst_hook_cfg->ui32_k < ui32_k) ? pst_hook_cfg->ui32_k : (ui32_k - 1u));
+			ui32_faults = ui32_m * ui32_n * sizeof(float32_t) * CHAR_BIT;
+
+			/* 2. Golden ES (C = 0 before and after it, as every faulty execution starts) */
+			matrix2zeros(&paf32_mc[0u], ui32_m, ui32_n);
+			ui32_dc_golden = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+
+			/* 3. Faults in C / in the accumulators, split between the threads */
+			pau8_undetected = (uint8_t*)calloc(ui32_faults, sizeof(uint8_t));
+			assert(pau8_undetected != NULL);
+			ui32_dc_cnt = mem_fi_hook_omp(e_tech, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, ui32_dc_golden,
+				pst_hook_cfg->e_var, ui32_at_i, ui32_at_k, ui32_faults, pau8_undetected);
+			fi_idx_write(p_file_idx_fi, e_idx_format, ui32_m, ui32_n, ui32_k, 0u, ui32_faults, 0u, FALSE, pau8_undetected, pau8_undetected);
+			free(pau8_undetected);
+
+			printf("\n\t\t [%3u x %3u x %3u] %-26s %s (i = %u, k = %u): %u / %u detected, DC = %8.4f %%", ui32_m, ui32_n, ui32_k, pstr_technique[e_tech],
+				pstr_var, (pst_hook_cfg->e_var == e_FI_VAR_C) ? ui32_at_i : 0u, ui32_at_k, ui32_dc_cnt, ui32_faults, (100.0 * ui32_dc_cnt) / ui32_faults);
+			fprintf(p_file, "\n%s,%u,%u,%u,%s,%u,%u,%u,%u,%.6f,%llu", pstr_technique[e_tech], ui32_m, ui32_n, ui32_k, pstr_var,
+				(pst_hook_cfg->e_var == e_FI_VAR_C) ? ui32_at_i : 0u, ui32_at_k, ui32_faults, ui32_dc_cnt, (100.0 * ui32_dc_cnt) / ui32_faults, (unsigned long long)ui64_rng_seed);
+		}
+
+		fclose(p_file);
+		fclose(p_file_idx_fi);
+	}
+
+	GET_TIME(tmr_end_exp);
+	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
+	printf("\n Experiments executed in %10.8lf [sec]", time_interval);
+	return EXIT_SUCCESS;
+}
+#endif
+
+#ifdef FI_CAMPAIGN_QUEUE
+/******************************************************************************
+**				Name:    measure_dc__error_bit_queue
+******************************************************************************/
+/*!
+** @brief  Single bit campaign (square matrices, A = B = 0) executed through a queue file.
+**         The first call creates the queue with the chunks of bits of every selected
+**         technique and size; a new call with the same file resumes it and only executes
+**         the chunks that are not done. ui32_workers local processes claim the chunks: a claim
+**         records the host and the process of the worker and a lease that the worker renews while
+**         the chunk runs. A chunk whose lease expired (worker stopped on any host) or whose process
+**         no longer exists on this host is claimed again.
+**         When all the chunks are done the results are merged into <tech>_fi.csv and
+**         <tech>_fi_idx.bin / .csv (same files as -dc without queue) and <queue>_summary.csv.
+**
+** @param[in] e_size_max          Maximum matrix size (only used when the queue is created)
+** @param[in] ab32_selected_tech  Selected techniques (only used when the queue is created)
+** @param[in] pst_queue_cfg       Queue file, number of workers, bits per chunk and lease
+** @param[in] e_idx_format        Format of the merged undetected faults files
+** @param[in] paf32_ma            Pointer to matrix A
+** @param[in] paf32_mb            Pointer to matrix B
+** @param[in] paf32_mc            Pointer to matrix C
+**
+** @return  int32_t EXIT_SUCCESS when the campaign is complete
+**
+******************************************************************************/
+static int32_t measure_dc__error_bit_queue(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], const st_fi_queue_cfg_t *pst_queue_cfg,
+	e_fi_idx_format e_idx_format, float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc)
+{
+	st_fi_queue_hdr_t st_hdr;
+	st_fi_queue_file_t st_queue_file;
+	st_fi_transport_t st_transport;
+	pid_t *pa_pid_worker;
+	uint32_t ui32_idx;
+	int32_t i32_fd,
+		i32_pending;
+	struct timespec st_time_start,
+		st_time_end;
+	float64_t time_interval;
+
+	clock_gettime(CLOCK_MONOTONIC, &st_time_start);
+
+	/* 1. Create or resume the queue */
+	i32_fd = fi_queue_open(pst_queue_cfg->pstr_queue, e_size_max, ab32_selected_tech, pst_queue_cfg->ui32_chunk_bits, &st_hdr);
+	if (i32_fd < 0)
+	{
+		return EXIT_FAILURE;
+	}
+	printf("\n\t Queue %s: %u chunks of %u bits, %u worker(s)", pst_queue_cfg->pstr_queue, st_hdr.ui32_chunks, st_hdr.ui32_chunk_bits, pst_queue_cfg->ui32_workers);
+
+	st_queue_file.i32_fd = i32_fd;
+	st_queue_file.pstr_queue = pst_queue_cfg->pstr_queue;
+	st_queue_file.ui32_lease_sec = pst_queue_cfg->ui32_lease_sec;
+	memset(&st_queue_file.str_host[0u], 0, sizeof(st_queue_file.str_host));
+	(void_t)gethostname(&st_queue_file.str_host[0u], sizeof(st_queue_file.str_host) - 1u);
+	st_transport.p_ctx = &st_queue_file;
+	st_transport.pfn_claim = fi_queue_file_claim;
+	st_transport.pfn_renew = fi_queue_file_renew;
+	st_transport.pfn_complete = fi_queue_file_complete;
+	st_transport.ui32_lease_sec = pst_queue_cfg->ui32_lease_sec;
+
+	/* 2. Execute the chunks: in this process or in ui32_workers child processes sharing the queue file */
+	if (pst_queue_cfg->ui32_workers <= 1u)
+	{
+		(void_t)fi_queue_worker(&st_transport, paf32_ma, paf32_mb, paf32_mc);
+	}
+	else
+	{
+		pa_pid_worker = (pid_t*)calloc(pst_queue_cfg->ui32_workers, sizeof(pid_t));
+		assert(pa_pid_worker != NULL);
+		fflush(stdout);
+		for (ui32_idx = 0u; ui32_idx < pst_queue_cfg->ui32_workers; ui32_idx++)
+		{
+			pa_pid_worker[ui32_idx] = fork();
+			if (pa_pid_worker[ui32_idx] == 0)
+			{
+#ifdef _OPENMP
+				/* The threads of the machine are shared between the workers */
+				omp_set_num_threads(((uint32_t)omp_get_max_threads() > pst_queue_cfg->ui32_workers) ? (omp_get_max_threads() / (int32_t)pst_queue_cfg->ui32_workers) : 1);
+#endif
+				(void_t)fi_queue_worker(&st_transport, paf32_ma, paf32_mb, paf32_mc);
+				fflush(stdout);
+				_exit(EXIT_SUCCESS);
+			}
+			else if (pa_pid_worker[ui32_idx] < 0)
+			{
+				fprintf(stderr, "cannot start worker %u: %s\n", ui32_idx, strerror(errno));
+			}
+		}
+		for (ui32_idx = 0u; ui32_idx < pst_queue_cfg->ui32_workers; ui32_idx++)
+		{
+			if (pa_pid_worker[ui32_idx] > 0)
+			{
+				while ((waitpid(pa_pid_worker[ui32_idx], NULL, 0) < 0) && (errno == EINTR));
+			}
+		}
+		free(pa_pid_worker);
+	}
+
+	/* 3. Merge the chunks when the campaign is complete (under the lock: other hosts may finish at the same time) */
+	fi_queue_lock(i32_fd, TRUE);
+	i32_pending = fi_queue_merge(i32_fd, pst_queue_cfg->pstr_queue, e_idx_format);
+	fi_queue_lock(i32_fd, FALSE);
+	close(i32_fd);
+
+	clock_gettime(CLOCK_MONOTONIC, &st_time_end);
+	time_interval = (float64_t)(st_time_end.tv_sec - st_time_start.tv_sec) + ((float64_t)(st_time_end.tv_nsec - st_time_start.tv_nsec) * 1e-9);
+	if (i32_pending == 0)
+	{
+		printf("\n\t Campaign complete, results merged (%s_summary.csv)", pst_queue_cfg->pstr_queue);
+	}
+	else if (i32_pending > 0)
+	{
+		printf("\n\t %d chunk(s) not done, execute the same command again to resume the campaign", i32_pending);
+	}
+	printf("\n Experiments executed in %10.8lf [sec]", time_interval);
+
+	return (i32_pending == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/******************************************************************************
+**				Name:    fi_queue_lock
+******************************************************************************/
+/*!
+** @brief  Lock / unlock the whole queue file (fcntl write lock, blocking)
+**
+** @param[in] i32_fd    Queue file descriptor
+** @param[in] b32_lock  TRUE: lock, FALSE: unlock
+**
+** @return  int32_t 0 OK, -1 error
+**
+******************************************************************************/
+static int32_t fi_queue_lock(int32_t i32_fd, bool32_t b32_lock)
+{
+	struct flock st_lock;
+	int32_t i32_result;
+
+	memset(&st_lock, 0, sizeof(st_lock));
+	st_lock.l_type = b32_lock ? F_WRLCK : F_UNLCK;
+	st_lock.l_whence = SEEK_SET;
+	st_lock.l_start = 0;
+	st_lock.l_len = 0;
+	while (((i32_result = fcntl(i32_fd, F_SETLKW, &st_lock)) < 0) && (errno == EINTR));
+	return i32_result;
+}
+
+/******************************************************************************
+**				Name:    fi_queue_open
+******************************************************************************/
+/*!
+** @brief  Open the queue file. If it is empty (or its creation was interrupted) the chunks of
+**         the campaign are written: for every selected technique and size, the bits
+**         [0, size * size * 32) in chunks of ui32_chunk_bits. The header is written last.
+**
+** @param[in]  pstr_queue          Queue file name
+** @param[in]  e_size_max          Maximum matrix size
+** @param[in]  ab32_selected_tech  Selected techniques
+** @param[in]  ui32_chunk_bits     Bits per chunk
+** @param[out] pst_hdr             Header of the queue
+**
+** @return  int32_t File descriptor, -1 error
+**
+******************************************************************************/
+static int32_t fi_queue_open(const char *pstr_queue, e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], uint32_t ui32_chunk_bits, st_fi_queue_hdr_t *pst_hdr)
+{
+	st_fi_chunk_t st_chunk;
+	e_enum_technique e_tech;
+	e_enum_size_2d e_size;
+	uint32_t ui32_combinations,
+		ui32_bit;
+	int32_t i32_fd;
+
+	if ((i32_fd = open(pstr_queue, O_RDWR | O_CREAT, 0644)) < 0)
+	{
+		fprintf(stderr, "cannot open file '%s': %s\n", pstr_queue, strerror(errno));
+		return -1;
+	}
+	fi_queue_lock(i32_fd, TRUE);
+
+	memset(pst_hdr, 0, sizeof(st_fi_queue_hdr_t));
+	if ((pread(i32_fd, pst_hdr, sizeof(st_fi_queue_hdr_t), 0) == (ssize_t)sizeof(st_fi_queue_hdr_t)) && (pst_hdr->ui32_magic == FI_QUEUE_MAGIC))
+	{
+		printf("\n\t Resuming queue %s", pstr_queue);
+	}
+	else if ((pst_hdr->ui32_magic != FI_QUEUE_MAGIC) && (pst_hdr->ui32_magic != 0u) && (lseek(i32_fd, 0, SEEK_END) >= (off_t)sizeof(st_fi_queue_hdr_t)))
+	{
+		fprintf(stderr, "'%s' is not a campaign queue file\n", pstr_queue);
+		fi_queue_lock(i32_fd, FALSE);
+		close(i32_fd);
+		return -1;
+	}
+	else
+	{
+		memset(pst_hdr, 0, sizeof(st_fi_queue_hdr_t));
+		memset(&st_chunk, 0, sizeof(st_chunk));
+		(void_t)ftruncate(i32_fd, 0);
+		pst_hdr->ui32_chunk_bits = ui32_chunk_bits;
+		pst_hdr->ui32_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
+		for (e_tech = TECH_INTEL_XOR_EXTERNAL; e_tech < TECH_INTEL_COMB; e_tech++)
+		{
+			for (e_size = eSIZE_MIN; ab32_selected_tech[e_tech] && (e_size <= pst_hdr->ui32_size_max); e_size++)
+			{
+				ui32_combinations = (kaui32_matrix_size[e_size] * kaui32_matrix_size[e_size]) * sizeof(uint32_t) * 8;
+				for (ui32_bit = 0u; ui32_bit < ui32_combinations; ui32_bit += ui32_chunk_bits)
+				{
+					st_chunk.ui32_tech = e_tech;
+					st_chunk.ui32_size = e_size;
+					st_chunk.ui32_bit_first = ui32_bit;
+					st_chunk.ui32_bit_end = ((ui32_combinations - ui32_bit) > ui32_chunk_bits) ? (ui32_bit + ui32_chunk_bits) : ui32_combinations;
+					st_chunk.ui32_state = e_FI_CHUNK_TODO;
+					(void_t)pwrite(i32_fd, &st_chunk, sizeof(st_chunk), (off_t)(sizeof(st_fi_queue_hdr_t) + pst_hdr->ui32_chunks * sizeof(st_fi_chunk_t)));
+					pst_hdr->ui32_chunks++;
+				}
+			}
+		}
+		fsync(i32_fd);
+		pst_hdr->ui32_magic = FI_QUEUE_MAGIC;
+		(void_t)pwrite(i32_fd, pst_hdr, sizeof(st_fi_queue_hdr_t), 0);
+		fsync(i32_fd);
+		printf("\n\t Created queue %s", pstr_queue);
+	}
+
+	fi_queue_lock(i32_fd, FALSE);
+	return i32_fd;
+}
+
+/******************************************************************************
+**				Name:    fi_queue_file_claim
+******************************************************************************/
+/*!
+** @brief  Local transport: claim the first chunk to do, or the first claimed chunk whose lease
+**         expired (worker stopped or disconnected, on any host; the hosts must have synchronized
+**         clocks) or whose process does not exist anymore on this host (interrupted campaign).
+**         The claim records the host, the process and the end of the lease.
+**
+** @param[in]  p_ctx        st_fi_queue_file_t of the queue
+** @param[out] pui32_chunk  Index of the claimed chunk
+** @param[out] pst_chunk    Claimed chunk
+**
+** @return  int32_t 1 claimed, 0 no chunk left, -1 error
+**
+******************************************************************************/
+static int32_t fi_queue_file_claim(void_t *p_ctx, uint32_t *pui32_chunk, st_fi_chunk_t *pst_chunk)
+{
+	const st_fi_queue_file_t *pst_queue = (const st_fi_queue_file_t*)p_ctx;
+	st_fi_queue_hdr_t st_hdr;
+	const int64_t i64_now = (int64_t)time(NULL);
+	uint32_t ui32_idx;
+	int32_t i32_result = 0;
+
+	if (fi_queue_lock(pst_queue->i32_fd, TRUE) < 0)
+	{
+		return -1;
+	}
+	if (pread(pst_queue->i32_fd, &st_hdr, sizeof(st_hdr), 0) != (ssize_t)sizeof(st_hdr))
+	{
+		i32_result = -1;
+	}
+	for (ui32_idx = 0u; (i32_result == 0) && (ui32_idx < st_hdr.ui32_chunks); ui32_idx++)
+	{
+		if (pread(pst_queue->i32_fd, pst_chunk, sizeof(st_fi_chunk_t), (off_t)(sizeof(st_hdr) + ui32_idx * sizeof(st_fi_chunk_t))) != (ssize_t)sizeof(st_fi_chunk_t))
+		{
+			i32_result = -1;
+		}
+		else if ((pst_chunk->ui32_state == e_FI_CHUNK_TODO) ||
+			((pst_chunk->ui32_state == e_FI_CHUNK_CLAIMED) && (pst_chunk->i64_lease_end < i64_now)) ||
+			((pst_chunk->ui32_state == e_FI_CHUNK_CLAIMED) && (strncmp(pst_chunk->str_owner_host, pst_queue->str_host, FI_QUEUE_HOST_LEN) == 0) &&
+			 (kill(pst_chunk->i32_owner_pid, 0) < 0) && (errno == ESRCH)))
+		{
+			if (pst_chunk->ui32_state == e_FI_CHUNK_CLAIMED)
+			{
+				printf("\n\t\t [worker %d] chunk %u claimed again (worker %d of %s stopped)", (int32_t)getpid(), ui32_idx,
+					pst_chunk->i32_owner_pid, pst_chunk->str_owner_host);
+			}
+			pst_chunk->ui32_state = e_FI_CHUNK_CLAIMED;
+			pst_chunk->i32_owner_pid = (int32_t)getpid();
+			memcpy(pst_chunk->str_owner_host, pst_queue->str_host, FI_QUEUE_HOST_LEN);
+			pst_chunk->i64_lease_end = i64_now + (int64_t)pst_queue->ui32_lease_sec;
+			if (pwrite(pst_queue->i32_fd, pst_chunk, sizeof(st_fi_chunk_t), (off_t)(sizeof(st_hdr) + ui32_idx * sizeof(st_fi_chunk_t))) == (ssize_t)sizeof(st_fi_chunk_t))
+			{
+				*pui32_chunk = ui32_idx;
+				i32_result = 1;
+			}
+			else
+			{
+				i32_result = -1;
+			}
+		}
+	}
+	fi_queue_lock(pst_queue->i32_fd, FALSE);
+
+	return i32_result;
+}
+
+/******************************************************************************
+**				Name:    fi_queue_file_renew
+******************************************************************************/
+/*!
+** @brief  Local transport: extend the lease of a chunk claimed by this worker (heartbeat)
+**
+** @param[in] p_ctx       st_fi_queue_file_t of the queue
+** @param[in] ui32_chunk  Index of the chunk
+**
+** @return  int32_t 0 renewed, -1 error or the chunk is not claimed by this worker anymore
+**
+******************************************************************************/
+static int32_t fi_queue_file_renew(void_t *p_ctx, uint32_t ui32_chunk)
+{
+	const st_fi_queue_file_t *pst_queue = (const st_fi_queue_file_t*)p_ctx;
+	st_fi_chunk_t st_chunk;
+	const off_t off_chunk = (off_t)(sizeof(st_fi_queue_hdr_t) + ui32_chunk * sizeof(st_fi_chunk_t));
+	int32_t i32_result = -1;
+
+	if (fi_queue_lock(pst_queue->i32_fd, TRUE) < 0)
+	{
+		return -1;
+	}
+	if ((pread(pst_queue->i32_fd, &st_chunk, sizeof(st_chunk), off_chunk) == (ssize_t)sizeof(st_chunk)) &&
+		(st_chunk.ui32_state == e_FI_CHUNK_CLAIMED) && (st_chunk.i32_owner_pid == (int32_t)getpid()) &&
+		(strncmp(st_chunk.str_owner_host, pst_queue->str_host, FI_QUEUE_HOST_LEN) == 0))
+	{
+		st_chunk.i64_lease_end = (int64_t)time(NULL) + (int64_t)pst_queue->ui32_lease_sec;
+		i32_result = (pwrite(pst_queue->i32_fd, &st_chunk, sizeof(st_chunk), off_chunk) == (ssize_t)sizeof(st_chunk)) ? 0 : -1;
+	}
+	fi_queue_lock(pst_queue->i32_fd, FALSE);
+
+	return i32_result;
+}
+
+/******************************************************************************
+**				Name:    fi_queue_file_complete
+******************************************************************************/
+/*!
+** @brief  Local transport: write the undetected flags of the bits of the chunk (one byte per bit)
+**         to <queue>.<chunk>.idx (temporary file + rename, so a chunk file is always complete)
+**         and mark the chunk done.
+**         If the worker stops before the chunk is marked done, the chunk is executed again.
+**
+** @param[in] p_ctx            st_fi_queue_file_t of the queue
+** @param[in] ui32_chunk       Index of the chunk
+** @param[in] pst_chunk        Chunk with its number of detected / undetected faults
+** @param[in] pau8_undetected  FI_UNDETECTED_A / FI_UNDETECTED_B flags of the bits of the chunk
+**
+** @return  int32_t 0 OK, -1 error
+**
+******************************************************************************/
+static int32_t fi_queue_file_complete(void_t *p_ctx, uint32_t ui32_chunk, const st_fi_chunk_t *pst_chunk, const uint8_t *pau8_undetected)
+{
+	const st_fi_queue_file_t *pst_queue = (const st_fi_queue_file_t*)p_ctx;
+	st_fi_chunk_t st_chunk;
+	const off_t off_chunk = (off_t)(sizeof(st_fi_queue_hdr_t) + ui32_chunk * sizeof(st_fi_chunk_t));
+	FILE *p_file;
+	char str_file_name[300u],
+		str_file_name_tmp[320u];
+	const size_t size_flags = pst_chunk->ui32_bit_end - pst_chunk->ui32_bit_first;
+	int32_t i32_result = 0;
+
+	/* 1. Undetected flags of the chunk */
+	snprintf(str_file_name, sizeof(str_file_name), "%s.%u.idx", pst_queue->pstr_queue, ui32_chunk);
+	snprintf(str_file_name_tmp, sizeof(str_file_name_tmp), "%s.tmp%d", str_file_name, (int32_t)getpid());
+	if ((p_file = fopen(str_file_name_tmp, "wb")) == NULL)
+	{
+		fprintf(stderr, "cannot open file '%s'\n", str_file_name_tmp);
+		return -1;
+	}
+	if ((fwrite(pau8_undetected, 1u, size_flags, p_file) != size_flags) || (fflush(p_file) != 0) || (fsync(fileno(p_file)) != 0))
+	{
+		i32_result = -1;
+	}
+	fclose(p_file);
+	if ((i32_result != 0) || (rename(str_file_name_tmp, str_file_name) != 0))
+	{
+		fprintf(stderr, "cannot write file '%s'\n", str_file_name);
+		return -1;
+	}
+
+	/* 2. Chunk done */
+	fi_queue_lock(pst_queue->i32_fd, TRUE);
+	if (pread(pst_queue->i32_fd, &st_chunk, sizeof(st_chunk), off_chunk) == (ssize_t)sizeof(st_chunk))
+	{
+		st_chunk.ui32_state = e_FI_CHUNK_DONE;
+		st_chunk.ui32_detected = pst_chunk->ui32_detected;
+		st_chunk.ui32_undetected = pst_chunk->ui32_undetected;
+		i32_result = (pwrite(pst_queue->i32_fd, &st_chunk, sizeof(st_chunk), off_chunk) == (ssize_t)sizeof(st_chunk)) ? fdatasync(pst_queue->i32_fd) : -1;
+	}
+	else
+	{
+		i32_result = -1;
+	}
+	fi_queue_lock(pst_queue->i32_fd, FALSE);
+
+	return i32_result;
+}
+
+/******************************************************************************
+**				Name:    fi_queue_heartbeat
+******************************************************************************/
+/*!
+** @brief  Thread of a worker that renews the lease of its chunk every ui32_lease_sec /
+**         FI_QUEUE_HEARTBEATS seconds until the chunk is done (b32_stop). If the claim was
+**         lost (the lease expired and another worker claimed the chunk), both execute it:
+**         the results are the same.
+**
+** @param[in] p_arg  st_fi_heartbeat_t of the chunk
+**
+** @return  void_t* NULL
+**
+******************************************************************************/
+static void_t *fi_queue_heartbeat(void_t *p_arg)
+{
+	st_fi_heartbeat_t *pst_beat = (st_fi_heartbeat_t*)p_arg;
+	struct timespec st_wake;
+
+	pthread_mutex_lock(&pst_beat->st_mutex);
+	while (!pst_beat->b32_stop)
+	{
+		clock_gettime(CLOCK_REALTIME, &st_wake);
+		st_wake.tv_sec += (time_t)(pst_beat->pst_transport->ui32_lease_sec / FI_QUEUE_HEARTBEATS);
+		if ((pthread_cond_timedwait(&pst_beat->st_cond, &pst_beat->st_mutex, &st_wake) != 0) && !pst_beat->b32_stop)
+		{
+			if (pst_beat->pst_transport->pfn_renew(pst_beat->pst_transport->p_ctx, pst_beat->ui32_chunk) != 0)
+			{
+				printf("\n ---> [worker %d] lease of chunk %u lost", (int32_t)getpid(), pst_beat->ui32_chunk);
+			}
+		}
+	}
+	pthread_mutex_unlock(&pst_beat->st_mutex);
+
+	return NULL;
+}
+
+/******************************************************************************
+**				Name:    fi_queue_worker
+******************************************************************************/
+/*!
+** @brief  Claim and execute chunks of the campaign until no chunk is left. Each chunk
+**         computes the golden ES of its technique and size and injects the faults of its
+**         bits in A and B (mem_fi_bits_omp), while fi_queue_heartbeat renews its lease.
+**
+** @param[in] pst_transport  Transport to the queue
+** @param[in] paf32_ma       Pointer to matrix A
+** @param[in] paf32_mb       Pointer to matrix B
+** @param[in] paf32_mc       Pointer to matrix C
+**
+** @return  uint32_t Number of chunks executed
+**
+******************************************************************************/
+static uint32_t fi_queue_worker(const st_fi_transport_t *pst_transport, float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc)
+{
+	st_fi_chunk_t st_chunk;
+	st_fi_heartbeat_t st_beat;
+	pthread_t st_thread_beat;
+	bool32_t b32_beat;
+	uint8_t *pau8_undetected;
+	uint32_t ui32_chunk,
+		ui32_size,
+		ui32_dc_golden,
+		ui32_chunks_done = 0u;
+	float32_t f32_alpha = 1.0f;
+
+	matrix2zeros(&paf32_ma[0u], MAX_DIM, MAX_DIM);
+	matrix2zeros(&paf32_mb[0u], MAX_DIM, MAX_DIM);
+	matrix2zeros(&paf32_mc[0u], MAX_DIM, MAX_DIM);
+
+	while (pst_transport->pfn_claim(pst_transport->p_ctx, &ui32_chunk, &st_chunk) == 1)
+	{
+		ui32_size = kaui32_matrix_size[st_chunk.ui32_size];
+		ui32_dc_golden = ptr_fn_smm_technique[st_chunk.ui32_tech](ui32_size, ui32_size, ui32_size, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+
+		pau8_undetected = (uint8_t*)calloc(st_chunk.ui32_bit_end - st_chunk.ui32_bit_first, sizeof(uint8_t));
+		assert(pau8_undetected != NULL);
+		st_beat.pst_transport = pst_transport;
+		st_beat.ui32_chunk = ui32_chunk;
+		st_beat.b32_stop = FALSE;
+		pthread_mutex_init(&st_beat.st_mutex, NULL);
+		pthread_cond_init(&st_beat.st_cond, NULL);
+		b32_beat = (pthread_create(&st_thread_beat, NULL, fi_queue_heartbeat, &st_beat) == 0) ? TRUE : FALSE;
+		if (!b32_beat)
+		{
+			printf("\n ---> [worker %d] no heartbeat, chunk %u may be claimed again after %u s", (int32_t)getpid(), ui32_chunk, pst_transport->ui32_lease_sec);
+		}
+		st_chunk.ui32_detected = mem_fi_bits_omp((e_enum_technique)st_chunk.ui32_tech, ui32_size, ui32_size, ui32_size, f32_alpha, paf32_ma, paf32_mb, paf32_mc,
+			ui32_dc_golden, st_chunk.ui32_bit_first, st_chunk.ui32_bit_end, TRUE, TRUE, pau8_undetected);
+		if (b32_beat)
+		{
+			pthread_mutex_lock(&st_beat.st_mutex);
+			st_beat.b32_stop = TRUE;
+			pthread_cond_signal(&st_beat.st_cond);
+			pthread_mutex_unlock(&st_beat.st_mutex);
+			pthread_join(st_thread_beat, NULL);
+		}
+		pthread_mutex_destroy(&st_beat.st_mutex);
+		pthread_cond_destroy(&st_beat.st_cond);
+		st_chunk.ui32_undetected = 2u * (st_chunk.ui32_bit_end - st_chunk.ui32_bit_first) - st_chunk.ui32_detected;
+
+		printf("\n\t\t [worker %d] chunk %u: %s [%3u x %3u] bits [%u, %u), detected %u / %u", (int32_t)getpid(), ui32_chunk,
+			pstr_technique[st_chunk.ui32_tech], ui32_size, ui32_size, st_chunk.ui32_bit_first, st_chunk.ui32_bit_end,
+			st_chunk.ui32_detected, st_chunk.ui32_detected + st_chunk.ui32_undetected);
+		fflush(stdout);
+
+		if (pst_transport->pfn_complete(pst_transport->p_ctx, ui32_chunk, &st_chunk, pau8_undetected) != 0)
+		{
+			free(pau8_undetected);
+			break;
+		}
+		free(pau8_undetected);
+		ui32_chunks_done++;
+	}
+	return ui32_chunks_done;
+}
+
+/******************************************************************************
+**				Name:    fi_queue_merge
+******************************************************************************/
+/*!
+** @brief  If all the chunks are done, merge them (in queue order: technique, size, bits)
+**         into <tech>_fi.csv, <tech>_fi_idx.bin / .csv and <queue>_summary.csv. Called with
+**         the queue locked.
+**
+** @param[in] i32_fd        Queue file descriptor
+** @param[in] pstr_queue    Queue file name
+** @param[in] e_idx_format  Format of the undetected faults files
+**
+** @return  int32_t Number of chunks not done (0 -> merged), -1 error
+**
+******************************************************************************/
+static int32_t fi_queue_merge(int32_t i32_fd, const char *pstr_queue, e_fi_idx_format e_idx_format)
+{
+	st_fi_queue_hdr_t st_hdr;
+	st_fi_chunk_t st_chunk,
+		st_chunk_prev;
+	FILE *p_file = NULL,
+		*p_file_idx_fi = NULL,
+		*p_file_summary,
+		*p_file_chunk;
+	char str_file_name[300u];
+	uint8_t *pau8_undetected = NULL;
+	uint32_t ui32_idx,
+		ui32_size,
+		ui32_combinations = 0u,
+		ui32_dc_cnt_all = 0u,
+		ui32_dc_cnt = 0u;
+	int32_t i32_pending = 0;
+	bool32_t b32_last;
+
+	/* 1. Pending chunks */
+	if (pread(i32_fd, &st_hdr, sizeof(st_hdr), 0) != (ssize_t)sizeof(st_hdr))
+	{
+		return -1;
+	}
+	for (ui32_idx = 0u; ui32_idx < st_hdr.ui32_chunks; ui32_idx++)
+	{
+		if (pread(i32_fd, &st_chunk, sizeof(st_chunk), (off_t)(sizeof(st_hdr) + ui32_idx * sizeof(st_chunk))) != (ssize_t)sizeof(st_chunk))
+		{
+			return -1;
+		}
+		i32_pending += (st_chunk.ui32_state != e_FI_CHUNK_DONE) ? 1 : 0;
+	}
+	if (i32_pending != 0)
+	{
+		return i32_pending;
+	}
+
+	/* 2. Merge: one row and one set of undetected flags per technique and size */
+	snprintf(str_file_name, sizeof(str_file_name), "%s_summary.csv", pstr_queue);
+	if ((p_file_summary = fopen(str_file_name, "w+")) == NULL)
+	{
+		fprintf(stderr, "cannot open file '%s'\n", str_file_name);
+		return -1;
+	}
+	fprintf(p_file_summary, "diagnostic_technique,size,number_of_fi,detected_errors,dc,seed");
+
+	memset(&st_chunk_prev, 0, sizeof(st_chunk_prev));
+	for (ui32_idx = 0u; ui32_idx <= st_hdr.ui32_chunks; ui32_idx++)
+	{
+		b32_last = (ui32_idx == st_hdr.ui32_chunks);
+		if (!b32_last)
+		{
+			(void_t)pread(i32_fd, &st_chunk, sizeof(st_chunk), (off_t)(sizeof(st_hdr) + ui32_idx * sizeof(st_chunk)));
+		}
+
+		if ((ui32_idx > 0u) && (b32_last || (st_chunk.ui32_tech != st_chunk_prev.ui32_tech) || (st_chunk.ui32_size != st_chunk_prev.ui32_size)))
+		{
+			ui32_size = kaui32_matrix_size[st_chunk_prev.ui32_size];
+			fi_idx_write(p_file_idx_fi, e_idx_format, ui32_size, ui32_size, ui32_size, 0u, ui32_combinations, ui32_combinations, TRUE, pau8_undetected, pau8_undetected);
+			free(pau8_undetected);
+			fprintf(p_file, "\n%s, %u, %u, %u, %llu", pstr_technique[st_chunk_prev.ui32_tech], ui32_size, ui32_dc_cnt_all, ui32_dc_cnt, (unsigned long long)ui64_rng_seed);
+			fprintf(p_file_summary, "\n%s,%u,%u,%u,%.6f,%llu", pstr_technique[st_chunk_prev.ui32_tech], ui32_size, ui32_dc_cnt_all, ui32_dc_cnt,
+				(100.0 * (float64_t)ui32_dc_cnt) / (float64_t)ui32_dc_cnt_all, (unsigned long long)ui64_rng_seed);
+			if (b32_last || (st_chunk.ui32_tech != st_chunk_prev.ui32_tech))
+			{
+				fclose(p_file);
+				fclose(p_file_idx_fi);
+			}
+		}
+		if (b32_last)
+		{
+			break;
+		}
+
+		if ((ui32_idx == 0u) || (st_chunk.ui32_tech != st_chunk_prev.ui32_tech))
+		{
+			snprintf(str_file_name, sizeof(str_file_name), "%s_fi.csv", pstr_technique[st_chunk.ui32_tech]);
+			p_file = fopen(str_file_name, "w+");
+			snprintf(str_file_name, sizeof(str_file_name), "%s_fi_idx.%s", pstr_technique[st_chunk.ui32_tech], kapstr_fi_idx_ext[e_idx_format]);
+			p_file_idx_fi = fopen(str_file_name, kapstr_fi_idx_mode[e_idx_format]);
+			assert((p_file != NULL) && (p_file_idx_fi != NULL));
+		}
+		if ((ui32_idx == 0u) || (st_chunk.ui32_tech != st_chunk_prev.ui32_tech) || (st_chunk.ui32_size != st_chunk_prev.ui32_size))
+		{
+			ui32_dc_cnt_all = 0u;
+			ui32_dc_cnt = 0u;
+			ui32_combinations = (kaui32_matrix_size[st_chunk.ui32_size] * kaui32_matrix_size[st_chunk.ui32_size]) * sizeof(uint32_t) * 8;
+			pau8_undetected = (uint8_t*)calloc(ui32_combinations, sizeof(uint8_t));
+			assert(pau8_undetected != NULL);
+		}
+		ui32_dc_cnt_all += st_chunk.ui32_detected + st_chunk.ui32_undetected;
+		ui32_dc_cnt += st_chunk.ui32_detected;
+
+		snprintf(str_file_name, sizeof(str_file_name), "%s.%u.idx", pstr_queue, ui32_idx);
+		if (((p_file_chunk = fopen(str_file_name, "rb")) == NULL) ||
+			(fread(&pau8_undetected[st_chunk.ui32_bit_first], 1u, st_chunk.ui32_bit_end - st_chunk.ui32_bit_first, p_file_chunk) != (st_chunk.ui32_bit_end - st_chunk.ui32_bit_first)))
+		{
+			fprintf(stderr, "cannot read file '%s'\n", str_file_name);
+			i32_pending = -1;
+		}
+		if (p_file_chunk != NULL)
+		{
+			fclose(p_file_chunk);
+		}
+		st_chunk_prev = st_chunk;
+	}
+	fclose(p_file_summary);
+
+	return i32_pending;
+}
+#endif
+
+static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX],
+	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc,
+	float32_t* const paf32_ma_fi, float32_t* const paf32_mb_fi,
+	float32_t* const paf32_ma_rand, float32_t* const paf32_mb_rand, float32_t* const paf32_mc_rand)
+{
+	e_enum_technique e_tech;
+	e_enum_size_2d e_size;
+	size_t size_a;
+	size_t size_b;
+
+	uint32_t ui32_idx_value,
+		ui32_matrix_size,
+		ui32_dc_cnt_all = 0u,
+		ui32_dc_cnt = 0u,
+		ui32_combinations_a = 0u,
+		ui32_combinations_b = 0u,
+		aui32_dc_value[e_FI_VAR_MAX];
+	uint32_t *pui32_a,
+		*pui32_b;
+	float32_t f32_alpha = 1.0f,
+		f32_dc;
+	DEF_TIME_VAR(tmr_start);
+	DEF_TIME_VAR(tmr_end);
+	DEF_TIME_VAR(tmr_start_exp);
+	DEF_TIME_VAR(tmr_end_exp);
+	float64_t time_interval;
+#ifdef _WIN32
+	FILE *p_file;
+	char str_file_name[200u];
+	errno_t err;
+	time_t time_now = time(NULL);
+	struct tm time_info;
+
+	/* 1. Open output file (csv) */
+	localtime_s(&time_info, &time_now);
+	strftime(str_file_name, sizeof(str_file_name), "dc_random_value_csv_%y_%m_%d__%A__%H_%M_%S.csv", &time_info);
+	if ((err = fopen_s(&p_file, str_file_name, "w+")) != 0)
+	{
+		fprintf(stderr, "cannot open file '%s': %u\n", str_file_name, err);
+		return EXIT_FAILURE;
+	}
+	fprintf(p_file, "Technique, Size, DC, Seed");
+#endif
+
+	/* 1. Initialize matrixes */
+	matrix2rand(&paf32_ma[0], MAX_DIM, MAX_DIM);
+	matrix2rand(&paf32_mb[0], MAX_DIM, MAX_DIM);
+	matrix2zeros(&paf32_mc[0], MAX_DIM, MAX_DIM);
+
+	matrix2rand(&paf32_ma_rand[0], MAX_DIM, MAX_DIM);
+	matrix2rand(&paf32_mb_rand[0], MAX_DIM, MAX_DIM);
+	matrix2zeros(&paf32_mc_rand[0], MAX_DIM, MAX_DIM);
+
+	/* 3. Execute DC measurement */
+	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
+	GET_TIME(tmr_start_exp);
+	for (e_tech = TECH_NONE; e_tech < TECH_MAX; e_tech++)
+	{
+		if (ab32_selected_tech[e_tech])
+		{
+			printf("\n\t Experiment %2u / %2u (%25s): ", (e_tech + 1u), (TECH_MAX + 1u), pstr_technique[e_tech]);
+			for (e_size = eSIZE_MIN; e_size <= e_size_max; e_size++)
+			{
+				size_a = M * K * sizeof(float32_t);
+				size_b = K * N * sizeof(float32_t);
+				ui32_matrix_size = kaui32_matrix_size[e_size];
 				ui32_dc_cnt = 0u;
 				ui32_dc_cnt_all = 0u;
 
@@ -1519,7 +3041,7 @@ static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_
 				{
 					memcpy(&paf32_ma_fi[0u], &paf32_ma[0u], size_a);
 					pui32_a = (uint32_t *)&paf32_ma_fi[ui32_idx_value];
-					*pui32_a = (uint32_t)rand();
+					*pui32_a = rng_u32(&st_rng);
 
 					aui32_dc_value[e_FI_VAR_A] = ptr_fn_smm_technique[e_tech](M, K, N, f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
 
@@ -1535,25 +3057,150 @@ static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_
 				{
 					memcpy(&paf32_mb_fi[0u], &paf32_mb[0u], size_b);
 					pui32_b = (uint32_t *)&paf32_mb_fi[ui32_idx_value];
-					*pui32_b = (uint32_t)rand();
+					*pui32_b = rng_u32(&st_rng);
 
 					aui32_dc_value[e_FI_VAR_B] = ptr_fn_smm_technique[e_tech](M, K, N, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
 
-					ui32_dc_cnt_all += 2u;
-					ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
-					/*if ((ui32_idx_value % (ui32_combinations / 10u) == 0u))
+					ui32_dc_cnt_all += 2u;
+					ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
+					/*if ((ui32_idx_value % (ui32_combinations / 10u) == 0u))
+					{
+					printf("%1u", ui32_idx_value / (ui32_combinations / 10u));
+					}*/
+				}
+				f32_dc = (100.0f * (float32_t)ui32_dc_cnt) / ((float32_t)ui32_dc_cnt_all);
+				GET_TIME(tmr_end);
+				GET_TIME_DIFF(tmr_start, tmr_end, time_interval);
+				// Before: printf("]; Diagnostic coverage = %5.2f %%; Exec Time = %6.2f [sec]", f32_dc, time_interval);
+				printf("%5.2f, Exec Time = %6.2f", f32_dc, time_interval);
+#ifdef _WIN32
+				fprintf(p_file, "\n%s,%u,%f,%llu", pstr_technique[e_tech], kaui32_matrix_size[e_size], f32_dc, (unsigned long long)ui64_rng_seed);
+#endif
+			}
+		}
+		else
+		{
+			//printf(" -> Skipped, not selected in techniques filter");
+		}
+	}
+#ifdef _WIN32
+	fclose(p_file);
+#endif
+
+	GET_TIME(tmr_end_exp);
+	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
+	printf("\n\t\t Experiments executed in %10.f [sec]", time_interval);
+
+	return EXIT_SUCCESS;
+}
+
+static int32_t measure_dc__error_random_values(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], bool32_t b32_consecutive, uint32_t ui32_n_length, uint32_t ui32_n_iterations,
+	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc,
+	float32_t* const paf32_ma_fi, float32_t* const paf32_mb_fi,
+	float32_t* const paf32_ma_rand, float32_t* const paf32_mb_rand, float32_t* const paf32_mc_rand)
+{
+	e_enum_technique e_tech;
+	e_enum_size_2d e_size;
+	size_t size;
+	uint32_t ui32_idx_iteration,
+		ui32_idx_length,
+		ui32_matrix_size,
+		ui32_dc_cnt_all = 0u,
+		ui32_dc_cnt = 0u,
+		aui32_dc_value[e_FI_VAR_MAX];
+	float32_t f32_alpha = 1.0f,
+		f32_dc;
+	DEF_TIME_VAR(tmr_start);
+	DEF_TIME_VAR(tmr_end);
+	DEF_TIME_VAR(tmr_start_exp);
+	DEF_TIME_VAR(tmr_end_exp);
+	float64_t time_interval;
+#ifdef _WIN32
+	FILE *p_file;
+	char str_file_name[100u];
+	errno_t err;
+	time_t time_now = time(NULL);
+	struct tm time_info;
+
+	/* 1. Open output file (csv) */
+	localtime_s(&time_info, &time_now);
+	strftime(str_file_name, sizeof(str_file_name), "dc_random_error_csv_%y_%m_%d__%A__%H_%M_%S.csv", &time_info);
+	if ((err = fopen_s(&p_file, str_file_name, "w+")) != 0)
+	{
+		fprintf(stderr, "cannot open file '%s': %u\n", str_file_name, err);
+		return EXIT_FAILURE;
+	}
+	fprintf(p_file, "Technique, Size, DC, Seed");
+#endif
+
+	/* 1. Initialize matrixes */
+	matrix2rand(&paf32_ma[0], MAX_DIM, MAX_DIM);
+	matrix2rand(&paf32_mb[0], MAX_DIM, MAX_DIM);
+	matrix2zeros(&paf32_mc[0], MAX_DIM, MAX_DIM);
+
+	matrix2rand(&paf32_ma_rand[0], MAX_DIM, MAX_DIM);
+	matrix2rand(&paf32_mb_rand[0], MAX_DIM, MAX_DIM);
+	matrix2zeros(&paf32_mc_rand[0], MAX_DIM, MAX_DIM);
+
+	/* 3. Execute DC measurement */
+	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
+	GET_TIME(tmr_start_exp);
+	for (e_tech = TECH_NONE; e_tech < TECH_MAX; e_tech++)
+	{
+		if (ab32_selected_tech[e_tech])
+		{
+			printf("\n\t Experiment %2u / %2u (%25s): ", (e_tech + 1u), (TECH_MAX + 1u), pstr_technique[e_tech]);
+			GET_TIME(tmr_start);
+			for (e_size = eSIZE_MIN; e_size <= e_size_max; e_size++)
+			{
+				printf("\n [%3u x %3u]  Execution progress of %6u random error replacements of %2u variables at %s positions. Execution percentage = [", kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], ui32_n_iterations, ui32_n_length, (b32_consecutive) ? "consecutive" : "random");
+				for (ui32_idx_length = 0u; ui32_idx_length < ui32_n_length; ui32_idx_length++)
+				{
+					for (ui32_idx_iteration = 0u; ui32_idx_iteration < ui32_n_iterations; ui32_idx_iteration++)
+					{
+						size = kaui32_matrix_size[e_size] * kaui32_matrix_size[e_size] * sizeof(float32_t);
+						ui32_matrix_size = kaui32_matrix_size[e_size];
+						ui32_dc_cnt = 0u;
+						ui32_dc_cnt_all = 0u;
+
+						if (ui32_idx_iteration == 0u)
+						{
+							matrix2zeros(&paf32_ma[0u], MAX_DIM, MAX_DIM);
+							matrix2zeros(&paf32_mb[0u], MAX_DIM, MAX_DIM);
+							matrix2zeros(&paf32_mc[0u], MAX_DIM, MAX_DIM);
+						}
+						else
+						{
+							memcpy(&paf32_ma[0u], &paf32_ma_rand[0], size);
+							memcpy(&paf32_mb[0u], &paf32_mb_rand[0], size);
+							memcpy(&paf32_mc[0u], &paf32_mc_rand[0], size);
+						}
+
+						aui32_dc_value[e_FI_VAR_NONE] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
+						memcpy(&paf32_ma_fi[0u], &paf32_ma[0u], size);
+						memcpy(&paf32_mb_fi[0u], &paf32_mb[0u], size);
+						mem_fi_random_value(&paf32_ma_fi[0], ui32_matrix_size * ui32_matrix_size, ui32_idx_length, b32_consecutive);
+						mem_fi_random_value(&paf32_mb_fi[0], ui32_matrix_size * ui32_matrix_size, ui32_idx_length, b32_consecutive);
+
+						aui32_dc_value[e_FI_VAR_A] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
+						aui32_dc_value[e_FI_VAR_B] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
+
+						ui32_dc_cnt_all += 2u;
+						ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
+						ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
+					}
+					if (((ui32_idx_length) % ((ui32_n_length)) == 0u))
 					{
-					printf("%1u", ui32_idx_value / (ui32_combinations / 10u));
-					}*/
+						printf("%1u", ui32_idx_iteration / (ui32_n_iterations / 10u));
+					}
 				}
 				f32_dc = (100.0f * (float32_t)ui32_dc_cnt) / ((float32_t)ui32_dc_cnt_all);
 				GET_TIME(tmr_end);
 				GET_TIME_DIFF(tmr_start, tmr_end, time_interval);
-				// Before: printf("]; Diagnostic coverage = %5.2f %%; Exec Time = %6.2f [sec]", f32_dc, time_interval);
-				printf("%5.2f, Exec Time = %6.2f", f32_dc, time_interval);
 #ifdef _WIN32
-				fprintf(p_file, "\n%s,%u,%f", pstr_technique[e_tech], kaui32_matrix_size[e_size], f32_dc);
+				fprintf(p_file, "\n%s,%u,%f,%llu", pstr_technique[e_tech], kaui32_matrix_size[e_size], f32_dc, (unsigned long long)ui64_rng_seed);
 #endif
+				printf("]; Diagnostic coverage = %5.2f %%; Exec Time = %6.1f [sec]", f32_dc, time_interval);
 			}
 		}
 		else
@@ -1561,150 +3208,955 @@ static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_
 			//printf(" -> Skipped, not selected in techniques filter");
 		}
 	}
-#ifdef _WIN32
-	fclose(p_file);
-#endif
+#ifdef _WIN32
+	fclose(p_file);
+#endif
+	GET_TIME(tmr_end_exp);
+	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
+	printf("\n\t\t Experiments executed in %10.f [sec]", time_interval);
+
+	return EXIT_SUCCESS;
+}
+
+
+static void_t mem_fi(float32_t* const paf32_m, uint32_t ui32_bit_idx)
+{
+	uint32_t ui32_idx_flt = ui32_bit_idx / (sizeof(float32_t)*CHAR_BIT),
+		ui32_idx_flt_bit = ui32_bit_idx % (sizeof(float32_t)*CHAR_BIT);
+	uint32_t ui32_f_d = *((uint32_t *)&paf32_m[ui32_idx_flt]);
+
+	ui32_f_d ^= (1u << ui32_idx_flt_bit);
+	paf32_m[ui32_idx_flt] = *((float32_t *)&ui32_f_d);
+}
+
+/******************************************************************************
+**				Name:    mem_fi_bits_omp
+******************************************************************************/
+/*!
+** @brief  Single bit fault injection of the bits [ui32_bit_first, ui32_bit_end) of A and / or B,
+**         split between the OpenMP threads. Each thread injects the faults in its own copies
+**         of A, B and C and counts the detected faults in its own counter (reduction).
+**         The undetected faults are flagged per bit, so the caller can write them in bit order.
+**
+** @param[in]  e_tech           Technique
+** @param[in]  ui32_m           Number of matrix A rows
+** @param[in]  ui32_n           Number of matrix B columns
+** @param[in]  ui32_k           Number of matrix A columns / Number of matrix B rows
+** @param[in]  f32_alpha        Correction factor
+** @param[in]  paf32_ma         Pointer to matrix A (golden)
+** @param[in]  paf32_mb         Pointer to matrix B (golden)
+** @param[in]  paf32_mc         Pointer to matrix C after the golden execution
+** @param[in]  ui32_dc_golden   Golden execution signature
+** @param[in]  ui32_bit_first   First bit index
+** @param[in]  ui32_bit_end     Last bit index + 1
+** @param[in]  b32_fi_a         Inject the faults in A
+** @param[in]  b32_fi_b         Inject the faults in B
+** @param[out] pau8_undetected  FI_UNDETECTED_A / FI_UNDETECTED_B flags of each bit (index - ui32_bit_first)
+**
+** @return  uint32_t Number of detected faults
+**
+******************************************************************************/
+static uint32_t mem_fi_bits_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	uint32_t ui32_bit_first, uint32_t ui32_bit_end, bool32_t b32_fi_a, bool32_t b32_fi_b, uint8_t* const pau8_undetected)
+{
+	const size_t size_a = (size_t)ui32_m * ui32_k * sizeof(float32_t),
+		size_b = (size_t)ui32_k * ui32_n * sizeof(float32_t),
+		size_c = (size_t)ui32_m * ui32_n * sizeof(float32_t);
+	uint32_t ui32_dc_cnt = 0u;
+
+#pragma omp parallel reduction(+:ui32_dc_cnt)
+	{
+		/* Copies of the thread: the techniques write C, the faults are injected in A and B */
+		float32_t *paf32_ma_t = (float32_t*)malloc(size_a),
+			*paf32_mb_t = (float32_t*)malloc(size_b),
+			*paf32_mc_t = (float32_t*)malloc(size_c);
+		uint32_t ui32_dc_value;
+		int32_t i32_idx_bit;
+
+		assert((paf32_ma_t != NULL) && (paf32_mb_t != NULL) && (paf32_mc_t != NULL));
+		memcpy(paf32_ma_t, paf32_ma, size_a);
+		memcpy(paf32_mb_t, paf32_mb, size_b);
+		memcpy(paf32_mc_t, paf32_mc, size_c);
+
+#pragma omp for schedule(dynamic, 64)
+		for (i32_idx_bit = (int32_t)ui32_bit_first; i32_idx_bit < (int32_t)ui32_bit_end; i32_idx_bit++)
+		{
+			uint8_t ui8_undetected = 0u;
+
+			if (b32_fi_a)
+			{
+				mem_fi(&paf32_ma_t[0], (uint32_t)i32_idx_bit);
+				ui32_dc_value = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma_t, paf32_mb_t, paf32_mc_t);
+				if (ui32_dc_golden != ui32_dc_value) {
+					ui32_dc_cnt += 1u;
+				}
+				else {
+					ui8_undetected |= FI_UNDETECTED_A;
+				}
+				FI_RESTORE_C_NON_FINITE(paf32_ma_t, (uint32_t)i32_idx_bit, paf32_mc_t, paf32_mc, size_c);
+				mem_fi(&paf32_ma_t[0], (uint32_t)i32_idx_bit);
+			}
+			if (b32_fi_b)
+			{
+				mem_fi(&paf32_mb_t[0], (uint32_t)i32_idx_bit);
+				ui32_dc_value = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma_t, paf32_mb_t, paf32_mc_t);
+				if (ui32_dc_golden != ui32_dc_value) {
+					ui32_dc_cnt += 1u;
+				}
+				else {
+					ui8_undetected |= FI_UNDETECTED_B;
+				}
+				FI_RESTORE_C_NON_FINITE(paf32_mb_t, (uint32_t)i32_idx_bit, paf32_mc_t, paf32_mc, size_c);
+				mem_fi(&paf32_mb_t[0], (uint32_t)i32_idx_bit);
+			}
+			/* Each bit is written by one thread only */
+			pau8_undetected[(uint32_t)i32_idx_bit - ui32_bit_first] = ui8_undetected;
+		}
+
+		free(paf32_ma_t);
+		free(paf32_mb_t);
+		free(paf32_mc_t);
+	}
+	return ui32_dc_cnt;
+}
+
+/******************************************************************************
+**				Name:    fi_prune_a_proven
+******************************************************************************/
+/*!
+** @brief  Techniques whose faults in A are equivalent in every row (-fi_prune).
+**         With B = 0 and a finite faulty value, C is the same as in the golden execution
+**         (finite * 0 = +-0, c + +-0 = c for a finite c that is not -0), so the signature only
+**         changes through the checksum of A. The XOR, two's complement and CRC techniques
+**         update it once per captured element with the same code in every row, and each
+**         update carries the difference of the element to the signature whatever the state
+**         (xor, negated sum, CRC step: all bijective in the state). The fault of A(i, k)
+**         is detected iff the element k is captured, the same for every row i.
+**         One's complement (two zeros) and Fletcher (sums modulo 65535 weighted by the
+**         position) do not keep this property and are always run fault by fault.
+**
+** @param[in]  e_tech  Technique
+**
+** @return  bool32_t TRUE: the faults in A with the same column, bit and value are equivalent
+**
+******************************************************************************/
+static bool32_t fi_prune_a_proven(e_enum_technique e_tech)
+{
+	switch (e_tech)
+	{
+	case TECH_INTEL_XOR_EXTERNAL:
+	case TECH_INTEL_XOR_INTERMEDIATE:
+	case TECH_INTEL_XOR_INTERNAL:
+	case TECH_INTEL_TWOS_EXTERNAL:
+	case TECH_INTEL_TWOS_INTERMEDIATE:
+	case TECH_INTEL_TWOS_INTERNAL:
+	case TECH_INTEL_CRC_EXTERNAL:
+	case TECH_INTEL_CRC_INTERMEDIATE:
+	case TECH_INTEL_CRC_INTERNAL:
+		return TRUE;
+	default:
+		return FALSE;
+	}
+}
+
+/******************************************************************************
+**				Name:    mem_fi_bits_prune_omp
+******************************************************************************/
+/*!
+** @brief  Same campaign as mem_fi_bits_omp with the equivalent faults in A executed once
+**         (-fi_prune, techniques of fi_prune_a_proven). The faults of A(i, k) are grouped with
+**         the first row r of the range with the same value A(r, k); only that fault is
+**         executed and its result is given to the whole class, so the DC and the undetected
+**         faults are the same as fault by fault. Without B = 0 and a finite C with no -0
+**         (or for other techniques) it is mem_fi_bits_omp. Faults in B are always executed.
+**
+** @param[in]  e_tech           Technique
+** @param[in]  ui32_m           Number of matrix A rows
+** @param[in]  ui32_n           Number of matrix B columns
+** @param[in]  ui32_k           Number of matrix A columns / Number of matrix B rows
+** @param[in]  f32_alpha        Correction factor
+** @param[in]  paf32_ma         Pointer to matrix A (golden)
+** @param[in]  paf32_mb         Pointer to matrix B (golden)
+** @param[in]  paf32_mc         Pointer to matrix C after the golden execution
+** @param[in]  ui32_dc_golden   Golden execution signature
+** @param[in]  ui32_bit_first   First bit index
+** @param[in]  ui32_bit_end     Last bit index + 1
+** @param[in]  b32_fi_a         Inject the faults in A
+** @param[in]  b32_fi_b         Inject the faults in B
+** @param[out] pau8_undetected  FI_UNDETECTED_A / FI_UNDETECTED_B flags of each bit (index - ui32_bit_first)
+**
+** @return  uint32_t Number of detected faults
+**
+******************************************************************************/
+static uint32_t mem_fi_bits_prune_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	uint32_t ui32_bit_first, uint32_t ui32_bit_end, bool32_t b32_fi_a, bool32_t b32_fi_b, uint8_t* const pau8_undetected)
+{
+	const uint32_t *paui32_a = (const uint32_t*)paf32_ma,
+		*paui32_b = (const uint32_t*)paf32_mb,
+		*paui32_c = (const uint32_t*)paf32_mc;
+	const uint32_t ui32_row_bits = ui32_k * sizeof(float32_t) * CHAR_BIT,
+		ui32_bits_a = ui32_m * ui32_row_bits;
+	uint32_t *paui32_rep,
+		ui32_idx,
+		ui32_idx_bit,
+		ui32_row,
+		ui32_faulty,
+		ui32_dc_cnt = 0u;
+	bool32_t b32_proven = b32_fi_a && fi_prune_a_proven(e_tech);
+
+	/* 1. Preconditions of the equivalence: B = 0 (+0 or -0), C finite and not -0 */
+	for (ui32_idx = 0u; b32_proven && (ui32_idx < (ui32_k * ui32_n)); ui32_idx++)
+	{
+		b32_proven = ((paui32_b[ui32_idx] & 0x7FFFFFFFu) == 0u);
+	}
+	for (ui32_idx = 0u; b32_proven && (ui32_idx < (ui32_m * ui32_n)); ui32_idx++)
+	{
+		b32_proven = ((paui32_c[ui32_idx] & FI_F32_EXPONENT) != FI_F32_EXPONENT) && (paui32_c[ui32_idx] != FI_F32_SIGN);
+	}
+	if (!b32_proven)
+	{
+		return mem_fi_bits_omp(e_tech, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, ui32_dc_golden,
+			ui32_bit_first, ui32_bit_end, b32_fi_a, b32_fi_b, pau8_undetected);
+	}
+
+	/* 2. Representative of each fault in A: same column and bit in the first row of the range with the same value.
+	**    Faults with a non finite faulty value (A * 0 = NaN changes C) are their own representative */
+	paui32_rep = (uint32_t*)malloc((size_t)(ui32_bit_end - ui32_bit_first) * sizeof(uint32_t));
+	assert(paui32_rep != NULL);
+	for (ui32_idx_bit = ui32_bit_first; ui32_idx_bit < ui32_bit_end; ui32_idx_bit++)
+	{
+		paui32_rep[ui32_idx_bit - ui32_bit_first] = ui32_idx_bit;
+		if (ui32_idx_bit >= ui32_bits_a)
+		{
+			continue;
+		}
+		ui32_faulty = paui32_a[ui32_idx_bit / 32u] ^ (1u << (ui32_idx_bit % 32u));
+		if ((ui32_faulty & FI_F32_EXPONENT) == FI_F32_EXPONENT)
+		{
+			continue;
+		}
+		for (ui32_row = (ui32_idx_bit % ui32_row_bits); ui32_row < ui32_idx_bit; ui32_row += ui32_row_bits)
+		{
+			if ((ui32_row >= ui32_bit_first) && (paui32_a[ui32_row / 32u] == paui32_a[ui32_idx_bit / 32u]))
+			{
+				paui32_rep[ui32_idx_bit - ui32_bit_first] = ui32_row;
+				break;
+			}
+		}
+	}
+
+	/* 3. Representatives of A and every fault of B, split between the threads */
+#pragma omp parallel reduction(+:ui32_dc_cnt)
+	{
+		const size_t size_a = (size_t)ui32_m * ui32_k * sizeof(float32_t),
+			size_b = (size_t)ui32_k * ui32_n * sizeof(float32_t),
+			size_c = (size_t)ui32_m * ui32_n * sizeof(float32_t);
+		float32_t *paf32_ma_t = (float32_t*)malloc(size_a),
+			*paf32_mb_t = (float32_t*)malloc(size_b),
+			*paf32_mc_t = (float32_t*)malloc(size_c);
+		uint32_t ui32_dc_value;
+		int32_t i32_idx_bit;
+
+		assert((paf32_ma_t != NULL) && (paf32_mb_t != NULL) && (paf32_mc_t != NULL));
+		memcpy(paf32_ma_t, paf32_ma, size_a);
+		memcpy(paf32_mb_t, paf32_mb, size_b);
+		memcpy(paf32_mc_t, paf32_mc, size_c);
+
+#pragma omp for schedule(dynamic, 64)
+		for (i32_idx_bit = (int32_t)ui32_bit_first; i32_idx_bit < (int32_t)ui32_bit_end; i32_idx_bit++)
+		{
+			uint8_t ui8_undetected = 0u;
+
+			if (paui32_rep[(uint32_t)i32_idx_bit - ui32_bit_first] == (uint32_t)i32_idx_bit)
+			{
+				mem_fi(&paf32_ma_t[0], (uint32_t)i32_idx_bit);
+				ui32_dc_value = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma_t, paf32_mb_t, paf32_mc_t);
+				if (ui32_dc_golden != ui32_dc_value) {
+					ui32_dc_cnt += 1u;
+				}
+				else {
+					ui8_undetected |= FI_UNDETECTED_A;
+				}
+				FI_RESTORE_C_NON_FINITE(paf32_ma_t, (uint32_t)i32_idx_bit, paf32_mc_t, paf32_mc, size_c);
+				mem_fi(&paf32_ma_t[0], (uint32_t)i32_idx_bit);
+			}
+			if (b32_fi_b)
+			{
+				mem_fi(&paf32_mb_t[0], (uint32_t)i32_idx_bit);
+				ui32_dc_value = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma_t, paf32_mb_t, paf32_mc_t);
+				if (ui32_dc_golden != ui32_dc_value) {
+					ui32_dc_cnt += 1u;
+				}
+				else {
+					ui8_undetected |= FI_UNDETECTED_B;
+				}
+				FI_RESTORE_C_NON_FINITE(paf32_mb_t, (uint32_t)i32_idx_bit, paf32_mc_t, paf32_mc, size_c);
+				mem_fi(&paf32_mb_t[0], (uint32_t)i32_idx_bit);
+			}
+			pau8_undetected[(uint32_t)i32_idx_bit - ui32_bit_first] = ui8_undetected;
+		}
+
+		free(paf32_ma_t);
+		free(paf32_mb_t);
+		free(paf32_mc_t);
+	}
+
+	/* 4. Result of the representative to the rest of its class (the representative is in a previous row) */
+	for (ui32_idx_bit = ui32_bit_first; ui32_idx_bit < ui32_bit_end; ui32_idx_bit++)
+	{
+		ui32_idx = paui32_rep[ui32_idx_bit - ui32_bit_first];
+		if (ui32_idx != ui32_idx_bit)
+		{
+			pau8_undetected[ui32_idx_bit - ui32_bit_first] |= pau8_undetected[ui32_idx - ui32_bit_first] & FI_UNDETECTED_A;
+			ui32_dc_cnt += ((pau8_undetected[ui32_idx - ui32_bit_first] & FI_UNDETECTED_A) == 0u) ? 1u : 0u;
+		}
+	}
+	free(paui32_rep);
+
+	return ui32_dc_cnt;
+}
+
+/******************************************************************************
+**				Name:    mem_fi_bits_lanes_omp
+******************************************************************************/
+/*!
+** @brief  Same campaign as mem_fi_bits_omp for the scalar techniques (TECH_XOR_EXTERNAL ...
+**         TECH_CRC_INTERNAL), with FI_LANES faults per execution: each execution of
+**         smm_lanes_fi carries the experiments of FI_LANES fault sites, one per 32 bit lane.
+**         The faults of one bit in A and in B are always in the same execution, so every
+**         bit flag is written by one thread only. The C of every lane starts from paf32_mc.
+**
+** @param[in]  e_tech           Technique (scalar)
+** @param[in]  ui32_m           Number of matrix A rows
+** @param[in]  ui32_n           Number of matrix B columns
+** @param[in]  ui32_k           Number of matrix A columns / Number of matrix B rows
+** @param[in]  f32_alpha        Correction factor
+** @param[in]  paf32_ma         Pointer to matrix A (golden)
+** @param[in]  paf32_mb         Pointer to matrix B (golden)
+** @param[in]  paf32_mc         Pointer to matrix C after the golden execution
+** @param[in]  ui32_dc_golden   Golden execution signature
+** @param[in]  ui32_bit_first   First bit index
+** @param[in]  ui32_bit_end     Last bit index + 1
+** @param[in]  b32_fi_a         Inject the faults in A
+** @param[in]  b32_fi_b         Inject the faults in B
+** @param[out] pau8_undetected  FI_UNDETECTED_A / FI_UNDETECTED_B flags of each bit (index - ui32_bit_first)
+**
+** @return  uint32_t Number of detected faults
+**
+******************************************************************************/
+static uint32_t mem_fi_bits_lanes_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	uint32_t ui32_bit_first, uint32_t ui32_bit_end, bool32_t b32_fi_a, bool32_t b32_fi_b, uint8_t* const pau8_undetected)
+{
+	const size_t size_c = (size_t)ui32_m * ui32_n;
+	const uint32_t ui32_faults_bit = (b32_fi_a ? 1u : 0u) + (b32_fi_b ? 1u : 0u),  /* Faults per bit index */
+		ui32_faults = (ui32_bit_end - ui32_bit_first) * ui32_faults_bit;
+	uint32_t ui32_dc_cnt = 0u;
+
+	assert((e_tech >= TECH_XOR_EXTERNAL) && (e_tech < TECH_XOR_FLET));
+	assert((ui32_faults_bit > 0u) && ((FI_LANES % ui32_faults_bit) == 0u));
+	memset(pau8_undetected, 0, ui32_bit_end - ui32_bit_first);
+
+#pragma omp parallel reduction(+:ui32_dc_cnt)
+	{
+		/* C of the thread, FI_LANES floats (one per lane) per element of C */
+		float32_t *paf32_mc_lanes = (float32_t*)malloc(size_c * FI_LANES * sizeof(float32_t));
+		uint32_t aui32_site_a[FI_LANES],
+			aui32_site_b[FI_LANES],
+			aui32_flip[FI_LANES],
+			ui32_undetected,
+			ui32_fault,
+			ui32_bit,
+			ui32_lane;
+		bool32_t b32_in_b;
+		size_t size_idx;
+		__m256i m256i_sig;
+		int32_t i32_idx_run;
+
+		assert(paf32_mc_lanes != NULL);
+
+#pragma omp for schedule(dynamic, 8)
+		for (i32_idx_run = 0; i32_idx_run < (int32_t)((ui32_faults + FI_LANES - 1u) / FI_LANES); i32_idx_run++)
+		{
+			/* 1. Fault site of every lane: fault = (bit - ui32_bit_first) * faults per bit + (0: A, 1: B) */
+			for (ui32_lane = 0u; ui32_lane < FI_LANES; ui32_lane++)
+			{
+				ui32_fault = ((uint32_t)i32_idx_run * FI_LANES) + ui32_lane;
+				ui32_bit = ui32_bit_first + (ui32_fault / ui32_faults_bit);
+				b32_in_b = (ui32_faults_bit == 2u) ? ((ui32_fault & 1u) != 0u) : b32_fi_b;
+				aui32_site_a[ui32_lane] = ((ui32_fault < ui32_faults) && !b32_in_b) ? (ui32_bit / 32u) : FI_LANES_NO_SITE;
+				aui32_site_b[ui32_lane] = ((ui32_fault < ui32_faults) && b32_in_b) ? (ui32_bit / 32u) : FI_LANES_NO_SITE;
+				aui32_flip[ui32_lane] = 1u << (ui32_bit % 32u);
+			}
+			for (size_idx = 0u; size_idx < size_c; size_idx++)
+			{
+				_mm256_storeu_ps(&paf32_mc_lanes[size_idx * FI_LANES], _mm256_set1_ps(paf32_mc[size_idx]));
+			}
+
+			/* 2. FI_LANES faulty executions */
+			m256i_sig = smm_lanes_fi(e_tech, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc_lanes,
+				_mm256_loadu_si256((const __m256i*)&aui32_site_a[0u]), _mm256_loadu_si256((const __m256i*)&aui32_site_b[0u]),
+				_mm256_loadu_si256((const __m256i*)&aui32_flip[0u]));
+			ui32_undetected = (uint32_t)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(m256i_sig, _mm256_set1_epi32((int32_t)ui32_dc_golden))));
+
+			/* 3. Verdicts; all the faults of a bit are in this execution */
+			for (ui32_lane = 0u; ui32_lane < FI_LANES; ui32_lane++)
+			{
+				ui32_fault = ((uint32_t)i32_idx_run * FI_LANES) + ui32_lane;
+				if (ui32_fault < ui32_faults)
+				{
+					b32_in_b = (ui32_faults_bit == 2u) ? ((ui32_fault & 1u) != 0u) : b32_fi_b;
+					if (((ui32_undetected >> ui32_lane) & 1u) == 0u) {
+						ui32_dc_cnt += 1u;
+					}
+					else {
+						pau8_undetected[ui32_fault / ui32_faults_bit] |= b32_in_b ? FI_UNDETECTED_B : FI_UNDETECTED_A;
+					}
+				}
+			}
+		}
+
+		free(paf32_mc_lanes);
+	}
+	return ui32_dc_cnt;
+}
+
+/******************************************************************************
+**				Name:    smm_lanes_fi
+******************************************************************************/
+/*!
+** @brief  Execution of a scalar technique (TECH_XOR_EXTERNAL ... TECH_CRC_INTERNAL) for
+**         FI_LANES fault sites at once, used only by the DC campaign. Lane l computes the
+**         technique with the bit m256i_flip[l] of A[m256i_site_a[l]] or B[m256i_site_b[l]]
+**         flipped: the loops, the products and the checksum updates are the ones of the
+**         scalar functions, with one lane per experiment (the signature of a lane is the
+**         one of the scalar function with its fault).
+**
+** @param[in]     e_tech          Technique (scalar)
+** @param[in]     ui32_m          Number of matrix A rows
+** @param[in]     ui32_n          Number of matrix B columns
+** @param[in]     ui32_k          Number of matrix A columns / Number of matrix B rows
+** @param[in]     f32_alpha       Correction factor
+** @param[in]     paf32_ma        Pointer to matrix A (without faults)
+** @param[in]     paf32_mb        Pointer to matrix B (without faults)
+** @param[in,out] paf32_mc_lanes  Matrix C of the lanes: element i of C of lane l in [i * FI_LANES + l]
+** @param[in]     m256i_site_a    Element of A of the fault of each lane (FI_LANES_NO_SITE: none)
+** @param[in]     m256i_site_b    Element of B of the fault of each lane (FI_LANES_NO_SITE: none)
+** @param[in]     m256i_flip      Mask of the flipped bit of each lane
+**
+** @return  __m256i Signature of each lane
+**
+******************************************************************************/
+static __m256i smm_lanes_fi(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc_lanes,
+	__m256i m256i_site_a, __m256i m256i_site_b, __m256i m256i_flip)
+{
+	const e_fi_lanes_sum e_sum = (e_fi_lanes_sum)((e_tech - TECH_XOR_EXTERNAL) / 3u);
+	const e_fi_lanes_place e_place = (e_fi_lanes_place)((e_tech - TECH_XOR_EXTERNAL) % 3u);
+	const uint32_t *paui32_ma = (const uint32_t*)paf32_ma,
+		*paui32_mb = (const uint32_t*)paf32_mb;
+	const __m256i m256i_sign = _mm256_set1_epi32(INT32_MIN),
+		m256i_n = _mm256_set1_epi32((int32_t)(ui32_n ^ 0x80000000u));
+	const __m256 m256_alpha = _mm256_set1_ps(f32_alpha);
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b = 0u,
+		ui32_idx_c = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+	bool32_t b32_fi_row_b;
+	__m256i m256i_value,
+		m256i_fi_row_b;
+	__m256 m256_a_part = _mm256_setzero_ps(),
+		m256_b = _mm256_setzero_ps(),
+		m256_c = _mm256_setzero_ps();
+	st_fi_lanes_sig_t st_sig_a,
+		st_sig_b,
+		st_sig_c,
+		st_sig;
+
+	assert((e_tech >= TECH_XOR_EXTERNAL) && (e_tech < TECH_XOR_FLET));
+	assert(paf32_ma != NULL);
+	assert(paf32_mb != NULL);
+	assert(paf32_mc_lanes != NULL);
+
+	st_sig_a.m256i_lo = _mm256_set1_epi32((e_sum == e_FI_LANES_CRC) ? (int32_t)INITIAL_REMAINDER : 0);
+	st_sig_a.m256i_hi = _mm256_setzero_si256();
+	st_sig_b = st_sig_a;
+	st_sig_c = st_sig_a;
+
+	for (ui32_idx_i = 0u; ui32_idx_i < ui32_m; ui32_idx_i++)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0u; ui32_idx_k < ui32_k; ui32_idx_k++, ui32_idx_a++)
+		{
+			m256i_value = _mm256_set1_epi32((int32_t)paui32_ma[ui32_idx_a]);
+			m256i_value = _mm256_xor_si256(m256i_value, _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_set1_epi32((int32_t)ui32_idx_a), m256i_site_a), m256i_flip));
+			m256_a_part = _mm256_mul_ps(m256_alpha, _mm256_castsi256_ps(m256i_value));
+			if (e_place == e_FI_LANES_INTERNAL)
+			{
+				fi_lanes_sig_update(e_sum, &st_sig_a, _mm256_castps_si256(m256_a_part));
+			}
+
+			/* Lanes with the fault in this row of B: (site - ui32_idx_b_ref) < ui32_n */
+			m256i_fi_row_b = _mm256_cmpgt_epi32(m256i_n, _mm256_xor_si256(_mm256_sub_epi32(m256i_site_b, _mm256_set1_epi32((int32_t)ui32_idx_b_ref)), m256i_sign));
+			b32_fi_row_b = !_mm256_testz_si256(m256i_fi_row_b, m256i_fi_row_b);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j < ui32_n; ui32_idx_j++, ui32_idx_b++, ui32_idx_c++)
+			{
+				m256i_value = _mm256_set1_epi32((int32_t)paui32_mb[ui32_idx_b]);
+				if (b32_fi_row_b)
+				{
+					m256i_value = _mm256_xor_si256(m256i_value, _mm256_and_si256(_mm256_cmpeq_epi32(_mm256_set1_epi32((int32_t)ui32_idx_b), m256i_site_b), m256i_flip));
+				}
+				m256_b = _mm256_castsi256_ps(m256i_value);
+				m256_c = _mm256_add_ps(_mm256_loadu_ps(&paf32_mc_lanes[ui32_idx_c * FI_LANES]), _mm256_mul_ps(m256_a_part, m256_b));
+				_mm256_storeu_ps(&paf32_mc_lanes[ui32_idx_c * FI_LANES], m256_c);
+				if (e_place == e_FI_LANES_INTERNAL)
+				{
+					fi_lanes_sig_update(e_sum, &st_sig_b, _mm256_castps_si256(m256_b));
+					fi_lanes_sig_update(e_sum, &st_sig_c, _mm256_castps_si256(m256_c));
+				}
+			}
+			if (e_place == e_FI_LANES_INTERMEDIATE)
+			{
+				fi_lanes_sig_update(e_sum, &st_sig_a, _mm256_castps_si256(m256_a_part));
+				fi_lanes_sig_update(e_sum, &st_sig_b, _mm256_castps_si256(m256_b));
+				fi_lanes_sig_update(e_sum, &st_sig_c, _mm256_castps_si256(m256_c));
+			}
+			ui32_idx_b_ref += ui32_n;
+		}
+		if (e_place == e_FI_LANES_EXTERNAL)
+		{
+			fi_lanes_sig_update(e_sum, &st_sig_a, _mm256_castps_si256(m256_a_part));
+			fi_lanes_sig_update(e_sum, &st_sig_b, _mm256_castps_si256(m256_b));
+			fi_lanes_sig_update(e_sum, &st_sig_c, _mm256_castps_si256(m256_c));
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+
+	/* Signature: same combination of A, B and C as the scalar function */
+	st_sig = st_sig_a;
+	switch (e_sum)
+	{
+	case e_FI_LANES_XOR:
+		st_sig.m256i_lo = _mm256_xor_si256(_mm256_xor_si256(st_sig_a.m256i_lo, st_sig_b.m256i_lo), st_sig_c.m256i_lo);
+		break;
+	case e_FI_LANES_ONES:
+		fi_lanes_ones_add(&st_sig, st_sig_b.m256i_lo, st_sig_b.m256i_hi);
+		if (e_place == e_FI_LANES_INTERNAL)
+		{
+			st_sig.m256i_lo = _mm256_xor_si256(_mm256_add_epi32(st_sig.m256i_lo, st_sig.m256i_hi), _mm256_set1_epi32(-1));
+		}
+		fi_lanes_ones_add(&st_sig, st_sig_c.m256i_lo, st_sig_c.m256i_hi);
+		st_sig.m256i_lo = _mm256_xor_si256(_mm256_add_epi32(st_sig.m256i_lo, st_sig.m256i_hi), _mm256_set1_epi32(-1));
+		break;
+	case e_FI_LANES_TWOS:
+		st_sig.m256i_lo = _mm256_add_epi32(st_sig_a.m256i_lo, st_sig_b.m256i_lo);
+		if (e_place == e_FI_LANES_INTERNAL)
+		{
+			st_sig.m256i_lo = _mm256_sub_epi32(_mm256_setzero_si256(), st_sig.m256i_lo);
+		}
+		st_sig.m256i_lo = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_add_epi32(st_sig.m256i_lo, st_sig_c.m256i_lo));
+		break;
+	case e_FI_LANES_FLETCHER:
+	case e_FI_LANES_CRC:
+	default:
+		fi_lanes_sig_update(e_sum, &st_sig, st_sig_b.m256i_lo);
+		fi_lanes_sig_update(e_sum, &st_sig, st_sig_c.m256i_lo);
+		break;
+	}
+	return st_sig.m256i_lo;
+}
+
+/******************************************************************************
+**				Name:    fi_lanes_sig_update
+******************************************************************************/
+/*!
+** @brief  Checksum update of every lane with its data, as the scalar techniques do
+**         (XOR, one's complement, two's complement, Fletcher32c_ui32, singletable_crc32c_ui32)
+**
+** @param[in]     e_sum       Checksum
+** @param[in,out] pst_sig     Checksum state of the lanes
+** @param[in]     m256i_data  Data of the lanes
+**
+** @return  void
+**
+******************************************************************************/
+static inline void_t fi_lanes_sig_update(e_fi_lanes_sum e_sum, st_fi_lanes_sig_t *pst_sig, __m256i m256i_data)
+{
+	const __m256i m256i_ui16 = _mm256_set1_epi32(0xFFFF),
+		m256i_ui8 = _mm256_set1_epi32(0xFF),
+		m256i_255 = _mm256_set1_epi32(255),
+		m256i_div255 = _mm256_set1_epi32(32897);  /* x / 255 = (x * 32897) >> 23 for x < 2^16 */
+	__m256i m256i_sum_0,
+		m256i_sum_1;
+	uint32_t ui32_byte;
+
+	switch (e_sum)
+	{
+	case e_FI_LANES_XOR:
+		pst_sig->m256i_lo = _mm256_xor_si256(pst_sig->m256i_lo, m256i_data);
+		break;
+	case e_FI_LANES_ONES:
+		fi_lanes_ones_add(pst_sig, m256i_data, _mm256_setzero_si256());
+		pst_sig->m256i_lo = _mm256_xor_si256(_mm256_add_epi32(pst_sig->m256i_lo, pst_sig->m256i_hi), _mm256_set1_epi32(-1));
+		break;
+	case e_FI_LANES_TWOS:
+		pst_sig->m256i_lo = _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_add_epi32(pst_sig->m256i_lo, m256i_data));
+		break;
+	case e_FI_LANES_FLETCHER:
+		/* ui16[0] and ui16[1] of every lane in 32 bit lanes */
+		m256i_sum_0 = _mm256_and_si256(pst_sig->m256i_lo, m256i_ui16);
+		m256i_sum_1 = _mm256_srli_epi32(pst_sig->m256i_lo, 16);
+		m256i_sum_0 = _mm256_and_si256(_mm256_add_epi32(m256i_sum_0, _mm256_and_si256(m256i_data, m256i_ui16)), m256i_ui16);
+		m256i_sum_1 = _mm256_and_si256(_mm256_add_epi32(m256i_sum_1, m256i_sum_0), m256i_ui16);
+		m256i_sum_0 = _mm256_and_si256(_mm256_add_epi32(m256i_sum_0, _mm256_srli_epi32(m256i_data, 16)), m256i_ui16);
+		m256i_sum_1 = _mm256_and_si256(_mm256_add_epi32(m256i_sum_1, m256i_sum_0), m256i_ui16);
+		m256i_sum_0 = _mm256_sub_epi32(m256i_sum_0, _mm256_mullo_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(m256i_sum_0, m256i_div255), 23), m256i_255));
+		m256i_sum_1 = _mm256_sub_epi32(m256i_sum_1, _mm256_mullo_epi32(_mm256_srli_epi32(_mm256_mullo_epi32(m256i_sum_1, m256i_div255), 23), m256i_255));
+		pst_sig->m256i_lo = _mm256_or_si256(m256i_sum_0, _mm256_slli_epi32(m256i_sum_1, 16));
+		break;
+	case e_FI_LANES_CRC:
+	default:
+		/* 4 bytes, one table look-up per lane and byte */
+		for (ui32_byte = 0u; ui32_byte < 4u; ui32_byte++)
+		{
+			m256i_sum_0 = _mm256_and_si256(_mm256_xor_si256(pst_sig->m256i_lo, m256i_data), m256i_ui8);
+			pst_sig->m256i_lo = _mm256_xor_si256(_mm256_i32gather_epi32((const int32_t*)&kaui32_crc_table[0u], m256i_sum_0, 4),
+				_mm256_srli_epi32(pst_sig->m256i_lo, 8));
+			m256i_data = _mm256_srli_epi32(m256i_data, 8);
+		}
+		break;
+	}
+}
+
+/******************************************************************************
+**				Name:    fi_lanes_ones_add
+******************************************************************************/
+/*!
+** @brief  ui64 += (m256i_hi:m256i_lo) in every lane of a one's complement checksum state
+**
+** @param[in,out] pst_sig   Checksum state of the lanes
+** @param[in]     m256i_lo  Low words to add
+** @param[in]     m256i_hi  High words to add
+**
+** @return  void
+**
+******************************************************************************/
+static inline void_t fi_lanes_ones_add(st_fi_lanes_sig_t *pst_sig, __m256i m256i_lo, __m256i m256i_hi)
+{
+	const __m256i m256i_sign = _mm256_set1_epi32(INT32_MIN);
+	__m256i m256i_sum = _mm256_add_epi32(pst_sig->m256i_lo, m256i_lo);
+
+	/* Carry (-1) when the low sum is lower (unsigned) than the added low word */
+	pst_sig->m256i_hi = _mm256_sub_epi32(_mm256_add_epi32(pst_sig->m256i_hi, m256i_hi),
+		_mm256_cmpgt_epi32(_mm256_xor_si256(m256i_lo, m256i_sign), _mm256_xor_si256(m256i_sum, m256i_sign)));
+	pst_sig->m256i_lo = m256i_sum;
+}
+
+#ifdef FI_HOOK
+/******************************************************************************
+**				Name:    mem_fi_hook_omp
+******************************************************************************/
+/*!
+** @brief  Single bit faults in C (e_FI_VAR_C) or in the accumulators (e_FI_VAR_ACC) through
+**         the injection hook, split between the OpenMP threads. Every thread arms its own
+**         hook (st_fi_hook is threadprivate) and executes the technique on its own copy of
+**         C, restored from paf32_mc before every fault. Fault ui32_bit: bit ui32_bit % 32 of
+**         the element ui32_bit / 32 of C.
+**
+** @param[in]  e_tech           Technique (AVX)
+** @param[in]  ui32_m           Number of matrix A rows
+** @param[in]  ui32_n           Number of matrix B columns
+** @param[in]  ui32_k           Number of matrix A columns / Number of matrix B rows
+** @param[in]  f32_alpha        Correction factor
+** @param[in]  paf32_ma         Pointer to matrix A
+** @param[in]  paf32_mb         Pointer to matrix B
+** @param[in]  paf32_mc         Pointer to matrix C before the golden execution
+** @param[in]  ui32_dc_golden   Golden execution signature
+** @param[in]  e_var            e_FI_VAR_C or e_FI_VAR_ACC
+** @param[in]  ui32_at_i        Iteration i of the faults in C
+** @param[in]  ui32_at_k        Iteration k of the faults
+** @param[in]  ui32_faults      Number of faults (bits of C)
+** @param[out] pau8_undetected  FI_UNDETECTED_A flag of each fault
+**
+** @return  uint32_t Number of detected faults
+**
+******************************************************************************/
+static uint32_t mem_fi_hook_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	e_fi_var e_var, uint32_t ui32_at_i, uint32_t ui32_at_k, uint32_t ui32_faults, uint8_t* const pau8_undetected)
+{
+	const size_t size_c = (size_t)ui32_m * ui32_n * sizeof(float32_t);
+	uint32_t ui32_dc_cnt = 0u;
+
+#pragma omp parallel reduction(+:ui32_dc_cnt)
+	{
+		float32_t *paf32_mc_t = (float32_t*)malloc(size_c);
+		int32_t i32_idx_bit;
+
+		assert(paf32_mc_t != NULL);
+
+#pragma omp for schedule(dynamic, 64)
+		for (i32_idx_bit = 0; i32_idx_bit < (int32_t)ui32_faults; i32_idx_bit++)
+		{
+			memcpy(paf32_mc_t, paf32_mc, size_c);
+			st_fi_hook.ui32_c = (uint32_t)i32_idx_bit / 32u;
+			st_fi_hook.ui32_flip = 1u << ((uint32_t)i32_idx_bit % 32u);
+			st_fi_hook.ui32_i = (e_var == e_FI_VAR_ACC) ? (st_fi_hook.ui32_c / ui32_n) : ui32_at_i;
+			st_fi_hook.ui32_k = ui32_at_k;
+			st_fi_hook.e_var = e_var;
+			if (ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc_t) != ui32_dc_golden) {
+				ui32_dc_cnt += 1u;
+			}
+			else {
+				pau8_undetected[i32_idx_bit] = FI_UNDETECTED_A;
+			}
+			st_fi_hook.e_var = e_FI_VAR_NONE;
+		}
+
+		free(paf32_mc_t);
+	}
+	return ui32_dc_cnt;
+}
 
-	GET_TIME(tmr_end_exp);
-	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
-	printf("\n\t\t Experiments executed in %10.f [sec]", time_interval);
+/******************************************************************************
+**				Name:    fi_hook_ik
+******************************************************************************/
+/*!
+** @brief  Hook of the iteration (i, k) of the AVX techniques (FI_HOOK_IK): flips the bit of
+**         the element of C in memory (e_FI_VAR_C) and tells whether the accumulator hooks of
+**         this iteration are armed (e_FI_VAR_ACC)
+**
+** @param[in]     ui32_i    Iteration i
+** @param[in]     ui32_k    Iteration k
+** @param[in,out] paf32_mc  Pointer to matrix C
+**
+** @return  bool32_t TRUE when the fault is in an accumulator of this iteration
+**
+******************************************************************************/
+static inline bool32_t fi_hook_ik(uint32_t ui32_i, uint32_t ui32_k, float32_t* const paf32_mc)
+{
+	bool32_t b32_armed = (st_fi_hook.e_var != e_FI_VAR_NONE) && (ui32_i == st_fi_hook.ui32_i) && (ui32_k == st_fi_hook.ui32_k);
 
-	return EXIT_SUCCESS;
+	if (b32_armed && (st_fi_hook.e_var == e_FI_VAR_C))
+	{
+		((uint32_t*)paf32_mc)[st_fi_hook.ui32_c] ^= st_fi_hook.ui32_flip;
+		b32_armed = FALSE;
+	}
+	return b32_armed;
 }
 
-static int32_t measure_dc__error_random_values(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], bool32_t b32_consecutive, uint32_t ui32_n_length, uint32_t ui32_n_iterations,
-	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc,
-	float32_t* const paf32_ma_fi, float32_t* const paf32_mb_fi,
-	float32_t* const paf32_ma_rand, float32_t* const paf32_mb_rand, float32_t* const paf32_mc_rand)
+/******************************************************************************
+**				Name:    fi_hook_acc
+******************************************************************************/
+/*!
+** @brief  Hook of the accumulator of the elements [ui32_c, ui32_c + 8) of C (FI_HOOK_ACC)
+**
+** @param[in] ui32_c    Element of C of the first lane
+** @param[in] m256_acc  Accumulator
+**
+** @return  __m256 Accumulator with the fault when the faulty element is one of its lanes
+**
+******************************************************************************/
+static inline __m256 fi_hook_acc(uint32_t ui32_c, __m256 m256_acc)
 {
-	e_enum_technique e_tech;
-	e_enum_size_2d e_size;
-	size_t size;
-	uint32_t ui32_idx_iteration,
-		ui32_idx_length,
-		ui32_matrix_size,
-		ui32_dc_cnt_all = 0u,
-		ui32_dc_cnt = 0u,
-		aui32_dc_value[e_FI_VAR_MAX];
-	float32_t f32_alpha = 1.0f,
-		f32_dc;
-	DEF_TIME_VAR(tmr_start);
-	DEF_TIME_VAR(tmr_end);
-	DEF_TIME_VAR(tmr_start_exp);
-	DEF_TIME_VAR(tmr_end_exp);
-	float64_t time_interval;
-#ifdef _WIN32
-	FILE *p_file;
-	char str_file_name[100u];
-	errno_t err;
-	time_t time_now = time(NULL);
-	struct tm time_info;
+	uint32_t aui32_lane[8u];
 
-	/* 1. Open output file (csv) */
-	localtime_s(&time_info, &time_now);
-	strftime(str_file_name, sizeof(str_file_name), "dc_random_error_csv_%y_%m_%d__%A__%H_%M_%S.csv", &time_info);
-	if ((err = fopen_s(&p_file, str_file_name, "w+")) != 0)
+	if ((st_fi_hook.ui32_c - ui32_c) < 8u)
 	{
-		fprintf(stderr, "cannot open file '%s': %u\n", str_file_name, err);
-		return EXIT_FAILURE;
+		_mm256_storeu_ps((float32_t*)&aui32_lane[0u], m256_acc);
+		aui32_lane[st_fi_hook.ui32_c - ui32_c] ^= st_fi_hook.ui32_flip;
+		m256_acc = _mm256_loadu_ps((const float32_t*)&aui32_lane[0u]);
 	}
-	fprintf(p_file, "Technique, Size, DC");
-#endif
+	return m256_acc;
+}
 
-	/* 1. Initialize matrixes */
-	matrix2rand(&paf32_ma[0], MAX_DIM, MAX_DIM);
-	matrix2rand(&paf32_mb[0], MAX_DIM, MAX_DIM);
-	matrix2zeros(&paf32_mc[0], MAX_DIM, MAX_DIM);
+/******************************************************************************
+**				Name:    fi_hook_acc_tail
+******************************************************************************/
+/*!
+** @brief  Hook of the scalar accumulation of the last (N % 8) columns (FI_HOOK_ACC_TAIL)
+**
+** @param[in]     ui32_c    Element of C just accumulated
+** @param[in,out] paf32_mc  Pointer to matrix C
+**
+** @return  void
+**
+******************************************************************************/
+static inline void_t fi_hook_acc_tail(uint32_t ui32_c, float32_t* const paf32_mc)
+{
+	if (ui32_c == st_fi_hook.ui32_c)
+	{
+		((uint32_t*)paf32_mc)[ui32_c] ^= st_fi_hook.ui32_flip;
+	}
+}
+#endif
 
-	matrix2rand(&paf32_ma_rand[0], MAX_DIM, MAX_DIM);
-	matrix2rand(&paf32_mb_rand[0], MAX_DIM, MAX_DIM);
-	matrix2zeros(&paf32_mc_rand[0], MAX_DIM, MAX_DIM);
+/******************************************************************************
+**				Name:    mem_fi_sites_omp
+******************************************************************************/
+/*!
+** @brief  Single bit fault injection of a list of sites, split between the OpenMP threads
+**         (thread copies of A, B and C as in mem_fi_bits_omp). A site is a bit of A
+**         (site < ui64_bits_a) or of B (site - ui64_bits_a).
+**
+** @param[in]  e_tech           Technique
+** @param[in]  ui32_m           Number of matrix A rows
+** @param[in]  ui32_n           Number of matrix B columns
+** @param[in]  ui32_k           Number of matrix A columns / Number of matrix B rows
+** @param[in]  f32_alpha        Correction factor
+** @param[in]  paf32_ma         Pointer to matrix A (golden)
+** @param[in]  paf32_mb         Pointer to matrix B (golden)
+** @param[in]  paf32_mc         Pointer to matrix C after the golden execution
+** @param[in]  ui32_dc_golden   Golden execution signature
+** @param[in]  ui64_bits_a      Number of bits of A
+** @param[in]  paui64_site      Fault sites
+** @param[in]  ui32_sites       Number of fault sites
+** @param[out] pau8_detected    1 if the fault of the site is detected, 0 otherwise
+**
+** @return  void
+**
+******************************************************************************/
+static void_t mem_fi_sites_omp(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha,
+	const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc, uint32_t ui32_dc_golden,
+	uint64_t ui64_bits_a, const uint64_t* const paui64_site, uint32_t ui32_sites, uint8_t* const pau8_detected)
+{
+	const size_t size_a = (size_t)ui32_m * ui32_k * sizeof(float32_t),
+		size_b = (size_t)ui32_k * ui32_n * sizeof(float32_t),
+		size_c = (size_t)ui32_m * ui32_n * sizeof(float32_t);
 
-	/* 3. Execute DC measurement */
-	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
-	GET_TIME(tmr_start_exp);
-	for (e_tech = TECH_NONE; e_tech < TECH_MAX; e_tech++)
+#pragma omp parallel
 	{
-		if (ab32_selected_tech[e_tech])
+		float32_t *paf32_ma_t = (float32_t*)malloc(size_a),
+			*paf32_mb_t = (float32_t*)malloc(size_b),
+			*paf32_mc_t = (float32_t*)malloc(size_c),
+			*paf32_m_fi;
+		uint32_t ui32_bit;
+		int32_t i32_idx;
+
+		assert((paf32_ma_t != NULL) && (paf32_mb_t != NULL) && (paf32_mc_t != NULL));
+		memcpy(paf32_ma_t, paf32_ma, size_a);
+		memcpy(paf32_mb_t, paf32_mb, size_b);
+		memcpy(paf32_mc_t, paf32_mc, size_c);
+
+#pragma omp for schedule(dynamic, 1)
+		for (i32_idx = 0; i32_idx < (int32_t)ui32_sites; i32_idx++)
 		{
-			printf("\n\t Experiment %2u / %2u (%25s): ", (e_tech + 1u), (TECH_MAX + 1u), pstr_technique[e_tech]);
-			GET_TIME(tmr_start);
-			for (e_size = eSIZE_MIN; e_size <= e_size_max; e_size++)
-			{
-				printf("\n [%3u x %3u]  Execution progress of %6u random error replacements of %2u variables at %s positions. Execution percentage = [", kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], ui32_n_iterations, ui32_n_length, (b32_consecutive) ? "consecutive" : "random");
-				for (ui32_idx_length = 0u; ui32_idx_length < ui32_n_length; ui32_idx_length++)
-				{
-					for (ui32_idx_iteration = 0u; ui32_idx_iteration < ui32_n_iterations; ui32_idx_iteration++)
-					{
-						size = kaui32_matrix_size[e_size] * kaui32_matrix_size[e_size] * sizeof(float32_t);
-						ui32_matrix_size = kaui32_matrix_size[e_size];
-						ui32_dc_cnt = 0u;
-						ui32_dc_cnt_all = 0u;
-
-						if (ui32_idx_iteration == 0u)
-						{
-							matrix2zeros(&paf32_ma[0u], MAX_DIM, MAX_DIM);
-							matrix2zeros(&paf32_mb[0u], MAX_DIM, MAX_DIM);
-							matrix2zeros(&paf32_mc[0u], MAX_DIM, MAX_DIM);
-						}
-						else
-						{
-							memcpy(&paf32_ma[0u], &paf32_ma_rand[0], size);
-							memcpy(&paf32_mb[0u], &paf32_mb_rand[0], size);
-							memcpy(&paf32_mc[0u], &paf32_mc_rand[0], size);
-						}
+			paf32_m_fi = (paui64_site[i32_idx] < ui64_bits_a) ? paf32_ma_t : paf32_mb_t;
+			ui32_bit = (uint32_t)((paui64_site[i32_idx] < ui64_bits_a) ? paui64_site[i32_idx] : (paui64_site[i32_idx] - ui64_bits_a));
+			mem_fi(&paf32_m_fi[0], ui32_bit);
+			pau8_detected[i32_idx] = (ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma_t, paf32_mb_t, paf32_mc_t) != ui32_dc_golden) ? 1u : 0u;
+			mem_fi(&paf32_m_fi[0], ui32_bit);
+		}
 
-						aui32_dc_value[e_FI_VAR_NONE] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-						memcpy(&paf32_ma_fi[0u], &paf32_ma[0u], size);
-						memcpy(&paf32_mb_fi[0u], &paf32_mb[0u], size);
-						mem_fi_random_value(&paf32_ma_fi[0], ui32_matrix_size * ui32_matrix_size, ui32_idx_length, b32_consecutive);
-						mem_fi_random_value(&paf32_mb_fi[0], ui32_matrix_size * ui32_matrix_size, ui32_idx_length, b32_consecutive);
+		free(paf32_ma_t);
+		free(paf32_mb_t);
+		free(paf32_mc_t);
+	}
+}
 
-						aui32_dc_value[e_FI_VAR_A] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-						aui32_dc_value[e_FI_VAR_B] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
+/******************************************************************************
+**				Name:    fi_idx_write
+******************************************************************************/
+/*!
+** @brief  Write the undetected faults of one experiment (technique and size).
+**         e_FI_IDX_CSV: "%u," per undetected fault, A and B interleaved per bit (square
+**         campaign) or all A, new line, all B (rectangular campaign).
+**         e_FI_IDX_BIN: st_fi_idx_hdr_t followed by the bitmap of A and the bitmap of B
+**         (bit i of the bitmap, LSB first: fault ui32_bit_first + i not detected), written
+**         with one fwrite per bitmap. fi_idx_reader.c converts it back to the CSV file.
+**
+** @param[in] p_file            Output file
+** @param[in] e_format          Output format
+** @param[in] ui32_m            Number of matrix A rows
+** @param[in] ui32_n            Number of matrix B columns
+** @param[in] ui32_k            Number of matrix A columns / Number of matrix B rows
+** @param[in] ui32_bit_first    First bit index
+** @param[in] ui32_bits_a       Number of injected bits of A
+** @param[in] ui32_bits_b       Number of injected bits of B
+** @param[in] b32_interleaved   A and B interleaved per bit in the CSV file
+** @param[in] pau8_undetected_a FI_UNDETECTED_A flags of the bits of A
+** @param[in] pau8_undetected_b FI_UNDETECTED_B flags of the bits of B
+**
+** @return  int32_t 0 OK, -1 error
+**
+******************************************************************************/
+static int32_t fi_idx_write(FILE *p_file, e_fi_idx_format e_format, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k,
+	uint32_t ui32_bit_first, uint32_t ui32_bits_a, uint32_t ui32_bits_b, bool32_t b32_interleaved,
+	const uint8_t* const pau8_undetected_a, const uint8_t* const pau8_undetected_b)
+{
+	st_fi_idx_hdr_t st_hdr;
+	uint8_t *pau8_bitmap;
+	uint32_t ui32_idx_bit,
+		ui32_bits;
+	int32_t i32_result = 0;
 
-						ui32_dc_cnt_all += 2u;
-						ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
-						ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
-					}
-					if (((ui32_idx_length) % ((ui32_n_length)) == 0u))
-					{
-						printf("%1u", ui32_idx_iteration / (ui32_n_iterations / 10u));
-					}
+	if (e_format == e_FI_IDX_CSV)
+	{
+		if (b32_interleaved)
+		{
+			for (ui32_idx_bit = 0u; ui32_idx_bit < ui32_bits_a; ui32_idx_bit++) {
+				if ((pau8_undetected_a[ui32_idx_bit] & FI_UNDETECTED_A) != 0u) {
+					fprintf(p_file, "%u,", ui32_bit_first + ui32_idx_bit);
+				}
+				if ((pau8_undetected_b[ui32_idx_bit] & FI_UNDETECTED_B) != 0u) {
+					fprintf(p_file, "%u,", ui32_bit_first + ui32_idx_bit);
 				}
-				f32_dc = (100.0f * (float32_t)ui32_dc_cnt) / ((float32_t)ui32_dc_cnt_all);
-				GET_TIME(tmr_end);
-				GET_TIME_DIFF(tmr_start, tmr_end, time_interval);
-#ifdef _WIN32
-				fprintf(p_file, "\n%s,%u,%f", pstr_technique[e_tech], kaui32_matrix_size[e_size], f32_dc);
-#endif
-				printf("]; Diagnostic coverage = %5.2f %%; Exec Time = %6.1f [sec]", f32_dc, time_interval);
 			}
 		}
 		else
 		{
-			//printf(" -> Skipped, not selected in techniques filter");
+			for (ui32_idx_bit = 0u; ui32_idx_bit < ui32_bits_a; ui32_idx_bit++) {
+				if ((pau8_undetected_a[ui32_idx_bit] & FI_UNDETECTED_A) != 0u) {
+					fprintf(p_file, "%u,", ui32_bit_first + ui32_idx_bit);
+				}
+			}
+			fprintf(p_file, "\n");
+			for (ui32_idx_bit = 0u; ui32_idx_bit < ui32_bits_b; ui32_idx_bit++) {
+				if ((pau8_undetected_b[ui32_idx_bit] & FI_UNDETECTED_B) != 0u) {
+					fprintf(p_file, "%u,", ui32_bit_first + ui32_idx_bit);
+				}
+			}
 		}
+		return (ferror(p_file) == 0) ? 0 : -1;
 	}
-#ifdef _WIN32
-	fclose(p_file);
-#endif
-	GET_TIME(tmr_end_exp);
-	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
-	printf("\n\t\t Experiments executed in %10.f [sec]", time_interval);
-
-	return EXIT_SUCCESS;
-}
 
+	st_hdr.ui32_magic = FI_IDX_MAGIC;
+	st_hdr.ui32_interleaved = b32_interleaved ? 1u : 0u;
+	st_hdr.ui32_m = ui32_m;
+	st_hdr.ui32_n = ui32_n;
+	st_hdr.ui32_k = ui32_k;
+	st_hdr.ui32_bit_first = ui32_bit_first;
+	st_hdr.ui32_bits_a = ui32_bits_a;
+	st_hdr.ui32_bits_b = ui32_bits_b;
+	pau8_bitmap = (uint8_t*)malloc((((ui32_bits_a > ui32_bits_b) ? ui32_bits_a : ui32_bits_b) + 7u) / 8u + 1u);
+	assert(pau8_bitmap != NULL);
+
+	i32_result = (fwrite(&st_hdr, sizeof(st_hdr), 1u, p_file) == 1u) ? 0 : -1;
+	/* Bitmap of A */
+	ui32_bits = (ui32_bits_a + 7u) / 8u;
+	memset(pau8_bitmap, 0, ui32_bits);
+	for (ui32_idx_bit = 0u; ui32_idx_bit < ui32_bits_a; ui32_idx_bit++) {
+		pau8_bitmap[ui32_idx_bit >> 3] |= (uint8_t)(((pau8_undetected_a[ui32_idx_bit] & FI_UNDETECTED_A) != 0u) << (ui32_idx_bit & 7u));
+	}
+	i32_result = (fwrite(pau8_bitmap, 1u, ui32_bits, p_file) == ui32_bits) ? i32_result : -1;
+	/* Bitmap of B */
+	ui32_bits = (ui32_bits_b + 7u) / 8u;
+	memset(pau8_bitmap, 0, ui32_bits);
+	for (ui32_idx_bit = 0u; ui32_idx_bit < ui32_bits_b; ui32_idx_bit++) {
+		pau8_bitmap[ui32_idx_bit >> 3] |= (uint8_t)(((pau8_undetected_b[ui32_idx_bit] & FI_UNDETECTED_B) != 0u) << (ui32_idx_bit & 7u));
+	}
+	i32_result = (fwrite(pau8_bitmap, 1u, ui32_bits, p_file) == ui32_bits) ? i32_result : -1;
 
-static void_t mem_fi(float32_t* const paf32_m, uint32_t ui32_bit_idx)
-{
-	uint32_t ui32_idx_flt = ui32_bit_idx / (sizeof(float32_t)*CHAR_BIT),
-		ui32_idx_flt_bit = ui32_bit_idx % (sizeof(float32_t)*CHAR_BIT);
-	uint32_t ui32_f_d = *((uint32_t *)&paf32_m[ui32_idx_flt]);
-
-	ui32_f_d ^= (1u << ui32_idx_flt_bit);
-	paf32_m[ui32_idx_flt] = *((float32_t *)&ui32_f_d);
+	free(pau8_bitmap);
+	return i32_result;
 }
 
 static void_t mem_fi_random_value(float32_t* const paf32_m, uint32_t ui32_max_dim, uint32_t ui32_n_length, bool32_t b32_consecutive)
@@ -1715,14 +4167,14 @@ static void_t mem_fi_random_value(float32_t* const paf32_m, uint32_t ui32_max_di
 
 	if (b32_consecutive)
 	{
-		ui32_idx_error = ((uint32_t)rand() % ui32_max_dim);
+		ui32_idx_error = rng_range(&st_rng, ui32_max_dim);
 		//printf("\n ui32_idx_error = %u / %u; ui32_n_length = %u", ui32_idx_error, ui32_max_dim, ui32_n_length);
 		for (ui32_idx = 0u; ui32_idx < ui32_n_length; ui32_idx++)
 		{
 			if ((ui32_idx_error + ui32_idx) < ui32_max_dim)
 			{
 				//printf("fi-");
-				pui32_m[ui32_idx_error + ui32_idx] = (uint32_t)rand();
+				pui32_m[ui32_idx_error + ui32_idx] = rng_u32(&st_rng);
 			}
 		}
 	}
@@ -1731,9 +4183,9 @@ static void_t mem_fi_random_value(float32_t* const paf32_m, uint32_t ui32_max_di
 		for (ui32_idx = 0u; ui32_idx < ui32_n_length; ui32_idx++)
 		{
 			//printf("fi-");
-			ui32_idx_error = ((uint32_t)rand() % ui32_max_dim);
+			ui32_idx_error = rng_range(&st_rng, ui32_max_dim);
 			//printf("\n ui32_idx_error = %u / %u; ", ui32_idx_error, ui32_max_dim);
-			pui32_m[ui32_idx_error] = (uint32_t)rand();
+			pui32_m[ui32_idx_error] = rng_u32(&st_rng);
 		}
 	}
 }
@@ -1751,14 +4203,182 @@ static void_t matrix2zeros(float32_t * paf32_matrix, uint32_t ui32_max_rows, uin
 
 static void_t matrix2rand(float32_t * paf32_matrix, uint32_t ui32_max_rows, uint32_t ui32_max_columns)
 {
+	const uint32_t ui32_size = ui32_max_rows * ui32_max_columns;
 	uint32_t ui32_idx;
+	float32_t af32_tail[RNG_LANES];
 
-	for (ui32_idx = 0u; ui32_idx < (ui32_max_rows * ui32_max_columns); ui32_idx++)
+	/* Values in [0, 2^31) as (float32_t)rand(), RNG_LANES per step */
+	for (ui32_idx = 0u; (ui32_idx + RNG_LANES) <= ui32_size; ui32_idx += RNG_LANES)
+	{
+		_mm256_storeu_ps(&paf32_matrix[ui32_idx], _mm256_cvtepi32_ps(_mm256_srli_epi32(rng_u32_x8(&st_rng_matrix), 1)));
+	}
+	if (ui32_idx < ui32_size)
+	{
+		_mm256_storeu_ps(&af32_tail[0u], _mm256_cvtepi32_ps(_mm256_srli_epi32(rng_u32_x8(&st_rng_matrix), 1)));
+		memcpy(&paf32_matrix[ui32_idx], &af32_tail[0u], (ui32_size - ui32_idx) * sizeof(float32_t));
+	}
+}
+
+/******************************************************************************
+**				Name:    rng_init
+******************************************************************************/
+/*!
+** @brief  Seed the random numbers of the experiments: stream of every OpenMP thread (st_rng, stream = thread number)
+**         and the RNG_LANES streams of matrix2rand. The same seed gives the same matrices and the same campaigns
+**         for any number of threads (the sampled sites are drawn by the master thread).
+**
+** @param[in]  ui64_seed  Seed (-seed=), recorded in the output CSV files
+**
+******************************************************************************/
+static void_t rng_init(uint64_t ui64_seed)
+{
+	ui64_rng_seed = ui64_seed;
+#pragma omp parallel
+	{
+		rng_seed(&st_rng, ui64_seed, (uint32_t)omp_get_thread_num());
+	}
+	rng_seed_x8(&st_rng_matrix, ui64_seed, RNG_STREAM_MATRIX);
+}
+
+/******************************************************************************
+**				Name:    rng_seed
+******************************************************************************/
+/*!
+** @brief  Seed a xoshiro128** generator with the stream ui32_stream of the seed (splitmix64 of seed and stream)
+**
+** @param[out] pst_rng      Generator
+** @param[in]  ui64_seed    Seed
+** @param[in]  ui32_stream  Stream (thread, lane of matrix2rand)
+**
+******************************************************************************/
+static void_t rng_seed(st_rng_t *pst_rng, uint64_t ui64_seed, uint32_t ui32_stream)
+{
+	uint64_t ui64_x = ui64_seed ^ ((uint64_t)ui32_stream * 0xD1B54A32D192ED03ull),
+		ui64_z;
+	uint32_t ui32_idx;
+
+	for (ui32_idx = 0u; ui32_idx < 4u; ui32_idx += 2u)
+	{
+		ui64_x += 0x9E3779B97F4A7C15ull;
+		ui64_z = ui64_x;
+		ui64_z = (ui64_z ^ (ui64_z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		ui64_z = (ui64_z ^ (ui64_z >> 27)) * 0x94D049BB133111EBull;
+		ui64_z ^= (ui64_z >> 31);
+		pst_rng->aui32_s[ui32_idx] = (uint32_t)ui64_z;
+		pst_rng->aui32_s[ui32_idx + 1u] = (uint32_t)(ui64_z >> 32);
+	}
+	/* All zero state never leaves zero */
+	if ((pst_rng->aui32_s[0u] | pst_rng->aui32_s[1u] | pst_rng->aui32_s[2u] | pst_rng->aui32_s[3u]) == 0u)
+	{
+		pst_rng->aui32_s[0u] = 1u;
+	}
+}
+
+/******************************************************************************
+**				Name:    rng_seed_x8
+******************************************************************************/
+/*!
+** @brief  Seed the RNG_LANES generators of rng_u32_x8: lane l is the stream ui32_stream_first + l of the seed
+**
+** @param[out] pst_rng            Generators
+** @param[in]  ui64_seed          Seed
+** @param[in]  ui32_stream_first  Stream of the lane 0
+**
+******************************************************************************/
+static void_t rng_seed_x8(st_rng_x8_t *pst_rng, uint64_t ui64_seed, uint32_t ui32_stream_first)
+{
+	st_rng_t ast_lane[RNG_LANES];
+	uint32_t aui32_s[RNG_LANES],
+		ui32_lane,
+		ui32_word;
+
+	for (ui32_lane = 0u; ui32_lane < RNG_LANES; ui32_lane++)
+	{
+		rng_seed(&ast_lane[ui32_lane], ui64_seed, ui32_stream_first + ui32_lane);
+	}
+	for (ui32_word = 0u; ui32_word < 4u; ui32_word++)
 	{
-		*paf32_matrix++ = (float32_t)rand();
+		for (ui32_lane = 0u; ui32_lane < RNG_LANES; ui32_lane++)
+		{
+			aui32_s[ui32_lane] = ast_lane[ui32_lane].aui32_s[ui32_word];
+		}
+		pst_rng->am256i_s[ui32_word] = _mm256_loadu_si256((const __m256i*)&aui32_s[0u]);
 	}
 }
 
+/******************************************************************************
+**				Name:    rng_u32
+******************************************************************************/
+/*!
+** @brief  Next 32 bit random number (xoshiro128**, all 32 bits random unlike rand())
+**
+** @param[in,out] pst_rng  Generator
+**
+** @return  uint32_t Random number
+**
+******************************************************************************/
+static inline uint32_t rng_u32(st_rng_t *pst_rng)
+{
+	uint32_t *paui32_s = &pst_rng->aui32_s[0u];
+	const uint32_t ui32_result = RNG_ROTL(paui32_s[1u] * 5u, 7u) * 9u,
+		ui32_t = paui32_s[1u] << 9;
+
+	paui32_s[2u] ^= paui32_s[0u];
+	paui32_s[3u] ^= paui32_s[1u];
+	paui32_s[1u] ^= paui32_s[2u];
+	paui32_s[0u] ^= paui32_s[3u];
+	paui32_s[2u] ^= ui32_t;
+	paui32_s[3u] = RNG_ROTL(paui32_s[3u], 11u);
+
+	return ui32_result;
+}
+
+/******************************************************************************
+**				Name:    rng_range
+******************************************************************************/
+/*!
+** @brief  Random number in [0, ui32_range) (multiply and shift, no division)
+**
+** @param[in,out] pst_rng     Generator
+** @param[in]     ui32_range  Number of values
+**
+** @return  uint32_t Random number
+**
+******************************************************************************/
+static inline uint32_t rng_range(st_rng_t *pst_rng, uint32_t ui32_range)
+{
+	return (uint32_t)(((uint64_t)rng_u32(pst_rng) * ui32_range) >> 32);
+}
+
+/******************************************************************************
+**				Name:    rng_u32_x8
+******************************************************************************/
+/*!
+** @brief  Next random number of the RNG_LANES generators (lane l: same sequence as rng_u32 with the stream l)
+**
+** @param[in,out] pst_rng  Generators
+**
+** @return  __m256i Random numbers
+**
+******************************************************************************/
+static inline __m256i rng_u32_x8(st_rng_x8_t *pst_rng)
+{
+	__m256i *pam256i_s = &pst_rng->am256i_s[0u];
+	const __m256i m256i_x5 = _mm256_mullo_epi32(pam256i_s[1u], _mm256_set1_epi32(5)),
+		m256i_result = _mm256_mullo_epi32(_mm256_or_si256(_mm256_slli_epi32(m256i_x5, 7), _mm256_srli_epi32(m256i_x5, 25)), _mm256_set1_epi32(9)),
+		m256i_t = _mm256_slli_epi32(pam256i_s[1u], 9);
+
+	pam256i_s[2u] = _mm256_xor_si256(pam256i_s[2u], pam256i_s[0u]);
+	pam256i_s[3u] = _mm256_xor_si256(pam256i_s[3u], pam256i_s[1u]);
+	pam256i_s[1u] = _mm256_xor_si256(pam256i_s[1u], pam256i_s[2u]);
+	pam256i_s[0u] = _mm256_xor_si256(pam256i_s[0u], pam256i_s[3u]);
+	pam256i_s[2u] = _mm256_xor_si256(pam256i_s[2u], m256i_t);
+	pam256i_s[3u] = _mm256_or_si256(_mm256_slli_epi32(pam256i_s[3u], 11), _mm256_srli_epi32(pam256i_s[3u], 21));
+
+	return m256i_result;
+}
+
+
 static inline uint32_t singletable_crc32c_ui32(uint32_t ui32_crc, uint32_t ui32_data)
 {
 	ui32_to_ui8_t u;
@@ -3786,6 +6406,7 @@ static uint32_t smm_intel_xor_external(uint32_t ui32_m, uint32_t ui32_n, uint32_
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -3796,12 +6417,14 @@ static uint32_t smm_intel_xor_external(uint32_t ui32_m, uint32_t ui32_n, uint32_
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 				}
 			}
 			ui32_idx_b_ref += ui32_n;
@@ -3874,6 +6497,7 @@ static uint32_t smm_intel_xor_intermediate(uint32_t ui32_m, uint32_t ui32_n, uin
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			// Evaluation of the ES (A value)
 			ui32_xor_a ^= (uint32_t) *((uint32_t*)&f32_a_part);
@@ -3887,6 +6511,7 @@ static uint32_t smm_intel_xor_intermediate(uint32_t ui32_m, uint32_t ui32_n, uin
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
@@ -3899,6 +6524,7 @@ static uint32_t smm_intel_xor_intermediate(uint32_t ui32_m, uint32_t ui32_n, uin
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					/* XOR checksum */
 					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
@@ -3973,6 +6599,7 @@ static uint32_t smm_intel_xor_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			// Evaluation of the ES (A value)
 			ui32_xor_a ^= (uint32_t) *((uint32_t*)&f32_a_part);
@@ -3986,6 +6613,7 @@ static uint32_t smm_intel_xor_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 				// Evaluation of the ES (B value)
@@ -3998,6 +6626,7 @@ static uint32_t smm_intel_xor_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					/* XOR checksum */
 					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
@@ -4074,6 +6703,7 @@ static uint32_t smm_intel_twos_external(uint32_t ui32_m, uint32_t ui32_n, uint32
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -4084,12 +6714,14 @@ static uint32_t smm_intel_twos_external(uint32_t ui32_m, uint32_t ui32_n, uint32
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 				}
 			}
 			ui32_idx_b_ref += ui32_n;
@@ -4182,6 +6814,7 @@ static uint32_t smm_intel_twos_intermediate(uint32_t ui32_m, uint32_t ui32_n, ui
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -4192,12 +6825,14 @@ static uint32_t smm_intel_twos_intermediate(uint32_t ui32_m, uint32_t ui32_n, ui
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 				}
 			}
 
@@ -4296,6 +6931,7 @@ static uint32_t smm_intel_twos_internal(uint32_t ui32_m, uint32_t ui32_n, uint32
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
@@ -4307,6 +6943,7 @@ static uint32_t smm_intel_twos_internal(uint32_t ui32_m, uint32_t ui32_n, uint32
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 				// Evaluation of the ES (B value)
@@ -4323,6 +6960,7 @@ static uint32_t smm_intel_twos_internal(uint32_t ui32_m, uint32_t ui32_n, uint32
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					/* Twos checksum */
 					// Evaluation of the ES (B value)
 					Twos_Checksum_b += (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
@@ -4428,6 +7066,7 @@ static uint32_t smm_intel_ones_external(uint32_t ui32_m, uint32_t ui32_n, uint32
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -4438,11 +7077,13 @@ static uint32_t smm_intel_ones_external(uint32_t ui32_m, uint32_t ui32_n, uint32
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 				}
 			}
 			ui32_idx_b_ref += ui32_n;
@@ -4579,6 +7220,7 @@ static uint32_t smm_intel_ones_intermediate(uint32_t ui32_m, uint32_t ui32_n, ui
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -4589,6 +7231,7 @@ static uint32_t smm_intel_ones_intermediate(uint32_t ui32_m, uint32_t ui32_n, ui
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
@@ -4625,6 +7268,7 @@ static uint32_t smm_intel_ones_intermediate(uint32_t ui32_m, uint32_t ui32_n, ui
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					/* One's complement checksum */
 					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
@@ -4756,6 +7400,7 @@ static uint32_t smm_intel_ones_internal(uint32_t ui32_m, uint32_t ui32_n, uint32
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -4766,6 +7411,7 @@ static uint32_t smm_intel_ones_internal(uint32_t ui32_m, uint32_t ui32_n, uint32
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 				// Evaluation of the ES (B value)
@@ -4815,6 +7461,7 @@ static uint32_t smm_intel_ones_internal(uint32_t ui32_m, uint32_t ui32_n, uint32
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					/* One's complement checksum */
 					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
@@ -4925,6 +7572,7 @@ static uint32_t smm_intel_fletcher_external(uint32_t ui32_m, uint32_t ui32_n, ui
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -4935,11 +7583,13 @@ static uint32_t smm_intel_fletcher_external(uint32_t ui32_m, uint32_t ui32_n, ui
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 				}
 			}
 			ui32_idx_b_ref += ui32_n;
@@ -5087,6 +7737,7 @@ static uint32_t smm_intel_fletcher_intermediate(uint32_t ui32_m, uint32_t ui32_n
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -5097,6 +7748,7 @@ static uint32_t smm_intel_fletcher_intermediate(uint32_t ui32_m, uint32_t ui32_n
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
@@ -5161,6 +7813,7 @@ static uint32_t smm_intel_fletcher_intermediate(uint32_t ui32_m, uint32_t ui32_n
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, (uint32_t) * (uint32_t *)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, (uint32_t) * (uint32_t *)&paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
@@ -5279,6 +7932,7 @@ static uint32_t smm_intel_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, ui
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -5289,6 +7943,7 @@ static uint32_t smm_intel_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, ui
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 				// Casting of the variables (B and C values)
@@ -5354,6 +8009,7 @@ static uint32_t smm_intel_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, ui
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, (uint32_t) * (uint32_t *)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, (uint32_t) * (uint32_t *)&paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
@@ -5455,6 +8111,7 @@ static uint32_t smm_intel_crc_external(uint32_t ui32_m, uint32_t ui32_n, uint32_
 		{
 			A_PART = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(A_PART);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -5465,12 +8122,14 @@ static uint32_t smm_intel_crc_external(uint32_t ui32_m, uint32_t ui32_n, uint32_
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += A_PART * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 				}
 			}
 			ui32_idx_b_ref += ui32_n;
@@ -5538,6 +8197,7 @@ static uint32_t smm_intel_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uin
 		{
 			float A_PART = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(A_PART);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			// Evaluation of the ES (A value)
 			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) * (uint32_t*)&A_PART);
@@ -5551,6 +8211,7 @@ static uint32_t smm_intel_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uin
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
@@ -5565,6 +8226,7 @@ static uint32_t smm_intel_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uin
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += A_PART * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
@@ -5625,6 +8287,7 @@ static uint32_t smm_intel_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_
 		{
 			float A_PART = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(A_PART);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			// Evaluation of the ES (A value)
 			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) * (uint32_t*)&A_PART);
@@ -5638,6 +8301,7 @@ static uint32_t smm_intel_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 
@@ -5653,6 +8317,7 @@ static uint32_t smm_intel_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += A_PART * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
@@ -5692,6 +8357,7 @@ static uint32_t smm_gemm_nn_intrincs_intel(uint32_t ui32_m, uint32_t ui32_n, uin
 		{
 			float A_PART = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(A_PART);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -5702,12 +8368,14 @@ static uint32_t smm_gemm_nn_intrincs_intel(uint32_t ui32_m, uint32_t ui32_n, uin
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += A_PART * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 				}
 			}
 			ui32_idx_b_ref += ui32_n;
@@ -5794,6 +8462,7 @@ static uint32_t smm_intel_xor_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -5804,6 +8473,7 @@ static uint32_t smm_intel_xor_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 				// Evaluation of the ES (B value)
@@ -5816,6 +8486,7 @@ static uint32_t smm_intel_xor_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					/* XOR checksum */
 					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
@@ -5981,6 +8652,7 @@ static uint32_t smm_intel_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui3
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -5992,6 +8664,7 @@ static uint32_t smm_intel_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui3
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 
@@ -6009,6 +8682,7 @@ static uint32_t smm_intel_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui3
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					/* XOR checksum */
 					//printf("\n idx_c:%d \tidx_c=%d \t", ui32_idx_c + ui32_idx_j, ui32_idx_b + ui32_idx_j);
 					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
@@ -6165,6 +8839,7 @@ static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -6175,6 +8850,7 @@ static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 
@@ -6195,6 +8871,7 @@ static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 
 					/* XOR checksum */
 					Twos_Checksum_b += (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
@@ -6370,6 +9047,7 @@ static uint32_t smm_intel_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -6380,6 +9058,7 @@ static uint32_t smm_intel_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 
@@ -6400,6 +9079,7 @@ static uint32_t smm_intel_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					/* XOR checksum */
 					Twos_Checksum_b += (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					Twos_Checksum_b = (~Twos_Checksum_b) + 1;
@@ -6513,6 +9193,7 @@ static uint32_t smm_intel_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -6523,6 +9204,7 @@ static uint32_t smm_intel_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 
@@ -6560,6 +9242,7 @@ static uint32_t smm_intel_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 
 					/* One's complement checksum */
 					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
@@ -6701,6 +9384,7 @@ static uint32_t smm_intel_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -6711,6 +9395,7 @@ static uint32_t smm_intel_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 
@@ -6748,6 +9433,7 @@ static uint32_t smm_intel_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 
 					/* One's complement checksum */
 					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
@@ -6950,6 +9636,7 @@ static uint32_t smm_intel_flet_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 		{
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
+			FI_HOOK_IK(ui32_idx_i, ui32_idx_k, paf32_mc);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
@@ -6960,6 +9647,7 @@ static uint32_t smm_intel_flet_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 				result256 = _mm256_mul_ps(a256, b256);
 
 				result256 = _mm256_add_ps(result256, c256);
+				FI_HOOK_ACC(ui32_idx_c, result256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
 				// Casting of the variables (B and C values)
@@ -7024,6 +9712,7 @@ static uint32_t smm_intel_flet_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
 					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					FI_HOOK_ACC_TAIL(ui32_idx_c + ui32_idx_j, paf32_mc);
 					Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, (uint32_t) * (uint32_t *)&paf32_mb[ui32_idx_b + ui32_idx_j]);
 					Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, (uint32_t) * (uint32_t *)&paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
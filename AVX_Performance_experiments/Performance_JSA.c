@@ -72,11 +72,27 @@ involved in the multiplication. In all the intermediate computes are evaluated t
 #include "errno.h"
 #endif
 
+#ifdef __linux__
+#include <unistd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
 #ifdef _WIN32
 #include <intrin.h>
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
 #else
 #include <emmintrin.h>
 #include <immintrin.h>
+#include <cpuid.h>
+#endif
+
+#ifdef __GNUC__
+/* No implicit contraction of a * b + c into FMA: FMA is only used where it is explicitly selected (SMM_MADD_PS) */
+#pragma GCC optimize ("fp-contract=off")
 #endif
 
 /* ==============================================================================================================
@@ -107,12 +123,82 @@ involved in the multiplication. In all the intermediate computes are evaluated t
 	 Square_mtrx = FALSE  	=> unbalanced_matrix  */
 #define Square_mtrx boolean NULL;
 
-#define SINGLETABLE_CRC32_UI32(ui32_crc, ui32_data, u) \
-    u.ui32 = ui32_data; \
-	ui32_crc = kaui32_crc_table[(ui32_crc ^ u.ui8[0u]) & 0x00ffu] ^ (ui32_crc >> 8u); \
-	ui32_crc = kaui32_crc_table[(ui32_crc ^ u.ui8[1u]) & 0x00ffu] ^ (ui32_crc >> 8u); \
-	ui32_crc = kaui32_crc_table[(ui32_crc ^ u.ui8[2u]) & 0x00ffu] ^ (ui32_crc >> 8u); \
-	ui32_crc = kaui32_crc_table[(ui32_crc ^ u.ui8[3u]) & 0x00ffu] ^ (ui32_crc >> 8u); \
+/* Instruction set of the AVX kernels. The binary is built for the baseline x86-64 target and only the kernels are
+   compiled for AVX2 + FMA + SSE4.2 (+ PCLMULQDQ for the CRC32C shift, TARGET_AVX2_CLMUL): smm_dispatch_techniques
+   enables them when the CPU supports it (no SIGILL on older nodes). Multiply-accumulate: FMA (one rounding) or mul + add (two roundings),
+   each kernel is compiled in both variants (SMM_MADD_VARIANTS) and smm_dispatch_techniques selects one with b32_use_fma. */
+#ifdef __GNUC__
+#define TARGET_AVX2 __attribute__((target("avx2,fma,sse4.2")))
+#define TARGET_AVX2_CLMUL __attribute__((target("avx2,fma,sse4.2,pclmul")))
+#define TARGET_SSE42 __attribute__((target("sse4.2")))
+#else
+#define TARGET_AVX2
+#define TARGET_AVX2_CLMUL
+#define TARGET_SSE42
+#endif
+#ifdef __GNUC__
+/* Only the extensions of the AVX-512 kernels (AVX512F, VPCLMULQDQ for the CRC folding): BW / VL would let the
+   compiler emit instructions that the AVX512F-only CPUs (Knights Landing) do not have */
+#define TARGET_AVX512 __attribute__((target("avx512f,avx2,fma,sse4.2,pclmul,vpclmulqdq")))
+#define FORCE_INLINE inline __attribute__((always_inline))
+#else
+#define TARGET_AVX512
+#define FORCE_INLINE __forceinline
+#endif
+/* Multiply-accumulate of the AVX kernels. b32_fma is a constant parameter of the FORCE_INLINE kernel bodies: the
+   branch is resolved when a variant (SMM_MADD_VARIANTS) is compiled, never in the loops */
+#define SMM_MADD_PS(a256, b256, c256) (b32_fma ? _mm256_fmadd_ps((a256), (b256), (c256)) : _mm256_add_ps(_mm256_mul_ps((a256), (b256)), (c256)))
+#define SMM_MADD_PS512(a512, b512, c512) (b32_fma ? _mm512_fmadd_ps((a512), (b512), (c512)) : _mm512_add_ps(_mm512_mul_ps((a512), (b512)), (c512)))
+/* CRC32C step of the portable C techniques: crc32 instruction when the CPU has SSE4.2, look-up table otherwise */
+#define SMM_CRC32C_UI32(ui32_crc, ui32_data) pfn_crc32c_ui32((ui32_crc), (ui32_data))
+#define SMM_MADD_F32(f32_a, f32_b, f32_c) (b32_fma ? _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(f32_a), _mm_set_ss(f32_b), _mm_set_ss(f32_c))) : (((f32_a) * (f32_b)) + (f32_c)))
+/* FMA and mul + add variants (name_fma, name_mul_add) of the body of a kernel, registered in ast_smm_impl */
+#define SMM_MADD_VARIANTS(name, target) \
+static target uint32_t name##_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc) \
+{ \
+	return name(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, TRUE); \
+} \
+static target uint32_t name##_mul_add(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc) \
+{ \
+	return name(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, FALSE); \
+}
+#define SMM_MADD_VARIANTS_PROTO(name) \
+static uint32_t name##_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc); \
+static uint32_t name##_mul_add(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc)
+/* Same variants for the MMM of a shard that returns its signature state (ptr_fn_smm_shard_t, see smm_par_shards) */
+#define SMM_SHARD_VARIANTS(name, target) \
+static target void_t name##_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig) \
+{ \
+	name(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, pst_sig, TRUE); \
+} \
+static target void_t name##_mul_add(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig) \
+{ \
+	name(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, pst_sig, FALSE); \
+}
+#define SMM_SHARD_VARIANTS_PROTO(name) \
+static void_t name##_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, smm_shard_sig_t* const pst_sig); \
+static void_t name##_mul_add(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, smm_shard_sig_t* const pst_sig)
+
+/* Lane-wise signature updates of the blocked GEMM (Experiment 5). v is an __m256i, lo/hi the state lanes */
+#define BLK_SIG_XOR_V(lo, hi, v)  lo = _mm256_xor_si256(lo, v);
+#define BLK_SIG_TWOS_V(lo, hi, v) lo = _mm256_add_epi32(lo, v);
+#define BLK_SIG_ONES_V(lo, hi, v) lo = _mm256_add_epi64(lo, _mm256_blend_epi32(v, _mm256_setzero_si256(), 0xAA)); \
+	hi = _mm256_add_epi64(hi, _mm256_srli_epi64(v, 32));
+#define BLK_SIG_FLET_V(lo, hi, v) lo = _mm256_add_epi32(lo, v); hi = _mm256_add_epi32(hi, lo);
+
+/* CRC32C of a stream of 64-byte blocks (Experiment 6): the 4 x 128-bit lanes of acc are folded 512 bits forward
+   with VPCLMULQDQ and the next block v is added. acc stays congruent to the stream modulo the CRC polynomial */
+#define ZMM_CRC_FOLD(acc, v, k) acc = _mm512_ternarylogic_epi32(_mm512_clmulepi64_epi128(acc, k, 0x00), _mm512_clmulepi64_epi128(acc, k, 0x11), v, 0x96);
+/* End-around carry of 64-bit lanes holding 1's complement sums of 32-bit words */
+#define BLK_SIG_ONES_FOLD(x) x = _mm256_add_epi64(_mm256_blend_epi32(x, _mm256_setzero_si256(), 0xAA), _mm256_srli_epi64(x, 32));
+/* Apply SIG_V to the 12 accumulators of the 6x16 register tile */
+#define BLK_TILE_SIG(SIG_V, lo, hi) \
+	SIG_V(lo, hi, _mm256_castps_si256(c256_00)) SIG_V(lo, hi, _mm256_castps_si256(c256_01)) \
+	SIG_V(lo, hi, _mm256_castps_si256(c256_10)) SIG_V(lo, hi, _mm256_castps_si256(c256_11)) \
+	SIG_V(lo, hi, _mm256_castps_si256(c256_20)) SIG_V(lo, hi, _mm256_castps_si256(c256_21)) \
+	SIG_V(lo, hi, _mm256_castps_si256(c256_30)) SIG_V(lo, hi, _mm256_castps_si256(c256_31)) \
+	SIG_V(lo, hi, _mm256_castps_si256(c256_40)) SIG_V(lo, hi, _mm256_castps_si256(c256_41)) \
+	SIG_V(lo, hi, _mm256_castps_si256(c256_50)) SIG_V(lo, hi, _mm256_castps_si256(c256_51))
 
 	 /* ==============================================================================================================
 	 * 										TYPEDEFS
@@ -208,6 +294,30 @@ typedef enum
 	TECH_INTEL_TWOS_CRC,
 	TECH_INTEL_FLET_CRC,
 
+	TECH_INTEL_BLOCKED_NO_DC,
+	TECH_INTEL_BLOCKED_XOR,
+	TECH_INTEL_BLOCKED_ONES,
+	TECH_INTEL_BLOCKED_TWOS,
+	TECH_INTEL_BLOCKED_FLETCHER,
+	TECH_INTEL_BLOCKED_CRC,
+
+	TECH_AVX512_NO_DC,
+	TECH_AVX512_XOR,
+	TECH_AVX512_ONES,
+	TECH_AVX512_TWOS,
+	TECH_AVX512_FLETCHER,
+	TECH_AVX512_CRC,
+	TECH_AVX512_XOR_FLET,
+	TECH_AVX512_XOR_CRC,
+	TECH_AVX512_ONES_FLET,
+	TECH_AVX512_ONES_CRC,
+	TECH_AVX512_TWOS_FLET,
+	TECH_AVX512_TWOS_CRC,
+	TECH_AVX512_FLET_CRC,
+
+	TECH_PAR_CRC_INTERNAL,
+	TECH_PAR_INTEL_CRC_INTERNAL,
+
 	TECH_INTEL_COMB,
 	TECH_MAX
 } e_enum_technique;
@@ -233,6 +343,215 @@ typedef enum
 	e_FI_VAR_MAX
 } e_fi_var;
 
+typedef enum
+{
+	e_FMA_AUTO = 0u,    /*!< FMA if the CPU supports it */
+	e_FMA_OFF,          /*!< mul + add (execution signatures of non-FMA machines) */
+	e_FMA_ON,           /*!< FMA requested by the user */
+	e_FMA_MAX
+} e_fma_mode;
+
+/* Execution of the faulty MMMs of the single bit campaign (see smm_fi_delta_a / smm_fi_delta_b) */
+typedef enum
+{
+	e_FI_EXEC_FULL = 0u,    /*!< Every faulty MMM is fully executed (brute force) */
+	e_FI_EXEC_DELTA,        /*!< Faults in A: only the row shard of the faulty element is executed again, faults in B:
+	                             only its column slice. The techniques without an exact merge are fully executed */
+	e_FI_EXEC_CHECK,        /*!< Delta and the full execution of -fi=full, the detected / undetected results are compared */
+	e_FI_EXEC_MAX
+} e_fi_exec;
+
+/* Clock of the time measurements (-timer=mono|tsc), see timer_init */
+typedef enum
+{
+	e_TIMER_MONO = 0u,      /*!< clock_gettime(CLOCK_MONOTONIC_RAW), QueryPerformanceCounter on Windows */
+	e_TIMER_TSC,            /*!< rdtscp + lfence, ticks converted with the TSC frequency measured against e_TIMER_MONO */
+	e_TIMER_MAX
+} e_timer;
+
+/* Hardware counters read around each timed call (-perf), one perf_event_open group led by the cycles */
+typedef enum
+{
+	e_PERF_CYCLES = 0u,
+	e_PERF_INSTRUCTIONS,
+	e_PERF_L1D_MISSES,      /*!< L1 data cache read misses */
+	e_PERF_LLC_MISSES,      /*!< Last level cache misses */
+	e_PERF_BRANCH_MISSES,
+	e_PERF_SIMD_FP,         /*!< Single precision FP instructions (FP_ARITH_INST_RETIRED on Intel, -perf_fp=raw) */
+	e_PERF_MAX
+} e_perf_event;
+
+/* Instruction set extensions of the CPU (probed at startup) and required by the technique implementations */
+typedef enum
+{
+	e_ISA_NONE = 0u,                /*!< Baseline x86-64 (SSE2) */
+	e_ISA_SSE42 = (1u << 0u),       /*!< CRC32 instruction */
+	e_ISA_PCLMUL = (1u << 1u),      /*!< Carry-less multiplication */
+	e_ISA_AVX = (1u << 2u),
+	e_ISA_AVX2 = (1u << 3u),
+	e_ISA_FMA = (1u << 4u),
+	e_ISA_AVX512F = (1u << 5u),
+	e_ISA_AVX512BW = (1u << 6u),
+	e_ISA_AVX512VL = (1u << 7u),
+	e_ISA_VPCLMUL = (1u << 8u),     /*!< 256/512-bit carry-less multiplication */
+	e_ISA_ALL = 0x1FFu
+} e_isa_flag;
+
+typedef enum
+{
+	e_BLK_SIG_NONE = 0u,
+	e_BLK_SIG_XOR,
+	e_BLK_SIG_ONES,
+	e_BLK_SIG_TWOS,
+	e_BLK_SIG_FLETCHER,
+	e_BLK_SIG_CRC,
+	e_BLK_SIG_MAX
+} e_blk_sig;
+
+/* Instruction sets of the compute ceilings of the roofline (roofline_measure) */
+typedef enum
+{
+	e_ROOF_SSE = 0u,
+	e_ROOF_AVX2,
+	e_ROOF_AVX512,
+	e_ROOF_MAX
+} e_roof_isa;
+
+/* Independent CRC32C chains of the CRC techniques, merged at the end of the MMM (Experiment 7) */
+typedef enum
+{
+	e_CRC_STREAM_A = 0u,
+	e_CRC_STREAM_B,
+	e_CRC_STREAM_C,
+	e_CRC_STREAM_MAX
+} e_crc_stream;
+
+/* Execution signature state of the blocked GEMM (Experiment 5). A and B are signed while they are packed,
+   C is signed from the accumulator registers when a tile is written back. */
+typedef struct
+{
+	e_blk_sig e_sig;        /*!< Checksum technique */
+	uint32_t ui32_a;        /*!< A: XOR / 2's complement sum / Fletcher sum 1 */
+	uint32_t ui32_a2;       /*!< A: Fletcher sum 2 */
+	uint64_t ui64_a;        /*!< A: 1's complement sum (carries folded at the end) */
+	uint32_t ui32_crc;      /*!< CRC chain over A, B and C */
+	__m256i m256i_b_lo;     /*!< B lanes: XOR / 2's sum / 1's sum of the low words / Fletcher sum 1 */
+	__m256i m256i_b_hi;     /*!< B lanes: 1's sum of the high words / Fletcher sum 2 */
+	__m256i m256i_c_lo;     /*!< C lanes: same meaning as the B lanes */
+	__m256i m256i_c_hi;
+} blk_sig_t;
+
+typedef uint32_t(*ptr_fn_smm_t)(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
+
+/* MMM of a range of rows that returns the CRC32C chains (e_crc_stream) instead of the execution signature */
+typedef void_t(*ptr_fn_smm_crc_rows_t)(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX]);
+
+/* Merge of the execution signatures of the row shards of a SIMD technique executed with threads (smm_par_shards) */
+typedef enum
+{
+	e_SHARD_MERGE_SERIAL = 0u,  /*!< No exact merge of the signature state: the serial kernel is executed */
+	e_SHARD_MERGE_XOR,          /*!< ES of the MMM = XOR of the ES of the shards */
+	e_SHARD_MERGE_SUM,          /*!< ES of the MMM = sum of the ES of the shards (2's complement) */
+	e_SHARD_MERGE_CRC,          /*!< CRC chains of A, B and C of the shards, combined with crc32c_combine */
+	e_SHARD_MERGE_AVX512,       /*!< Signature lanes of smm_avx512_gemm (smm_avx512_shard_merge) */
+	e_SHARD_MERGE_MAX           /*!< Multi-threaded implementation (PAR_*), not split again */
+} e_shard_merge;
+
+/* Execution signature state of a shard of rows, or of consecutive shards once merged (smm_shard_merge).
+   The state is zeroed before it is filled, so two states of the same rows are equal if memcmp is 0 */
+typedef struct
+{
+	e_blk_sig e_inner;          /*!< AVX512: checksum of A, B and C */
+	e_blk_sig e_outer;          /*!< AVX512: checksum of the inner state */
+	uint32_t ui32_es;           /*!< XOR / SUM: execution signature of the rows */
+	uint32_t aui32_crc[e_CRC_STREAM_MAX]; /*!< CRC: chains of A, B and C from INITIAL_REMAINDER.
+	                                 AVX512: A chain, CRC (initial value 0) of the B and C streams */
+	uint32_t ui32_crc_o;        /*!< AVX512: CRC (initial value 0) of the outer stream */
+	uint64_t aui64_len[e_CRC_STREAM_MAX]; /*!< Length of the A, B and C streams in bytes */
+	uint64_t ui64_a;            /*!< AVX512: XOR / 2's complement / 1's complement (carries not folded) sum of A */
+	uint32_t aui32_s[4u][16u];  /*!< AVX512: inner signature lanes (ZMM_NR, see smm_avx512_sig_update) */
+	uint32_t aui32_o[2u][16u];  /*!< AVX512: outer signature lanes */
+} smm_shard_sig_t;
+
+/* MMM of a shard of rows that returns the state of its execution signature instead of the signature */
+typedef void_t(*ptr_fn_smm_shard_t)(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, smm_shard_sig_t* const pst_sig);
+
+/* Golden execution of a delta campaign (smm_fi_golden), one entry per row shard and per column slice */
+typedef struct
+{
+	uint32_t ui32_es;                 /*!< Golden execution signature */
+	uint32_t ui32_n_shards;           /*!< Number of row shards (0: no delta of the faults in A) */
+	smm_shard_sig_t *past_shard;      /*!< Signature state of each shard */
+	smm_shard_sig_t *past_prefix;     /*!< Merge of the shards before each shard */
+	smm_shard_sig_t *past_suffix;     /*!< Merge of each shard and the next ones */
+	uint32_t ui32_n_slices;           /*!< Number of column slices (0: no delta of the faults in B) */
+	uint32_t *paui32_slice;           /*!< Execution signature of the MMM of each column slice */
+} smm_fi_golden_t;
+
+/* Scratch buffers of the delta re-executions, allocated once by the caller (one per thread) */
+typedef struct
+{
+	float32_t *paf32_mb_part;         /*!< B of a column slice (k x < 2 x ui32_col_slice) */
+	float32_t *paf32_mc_part;         /*!< C of a row shard (SMM_OMP_ROWS x n) or of a column slice (m x < 2 x ui32_col_slice) */
+} smm_fi_scratch_t;
+
+/* Implementation of a technique and the instruction sets it executes (see smm_dispatch_techniques) */
+typedef struct
+{
+	e_enum_technique e_tech;    /*!< Technique implemented */
+	uint32_t ui32_isa;          /*!< e_isa_flag mask required by the implementation */
+	ptr_fn_smm_t ptr_fn;        /*!< Implementation with FMA */
+	ptr_fn_smm_t ptr_fn_mul_add; /*!< Implementation with mul + add (same as ptr_fn without AVX multiply-accumulate) */
+	e_shard_merge e_merge;      /*!< Merge of the row shards executed with threads (see smm_par_shards) */
+	ptr_fn_smm_shard_t ptr_fn_shard; /*!< Shard with FMA (e_SHARD_MERGE_CRC / _AVX512), NULL: the technique itself */
+	ptr_fn_smm_shard_t ptr_fn_shard_mul_add; /*!< Shard with mul + add */
+	e_shard_merge e_col_merge;  /*!< XOR / SUM: the ES of the MMM is the merge of the ES of its column slices (see
+	                                 smm_fi_delta_b), SERIAL: it is not */
+	uint32_t ui32_col_slice;    /*!< Columns of a slice (the last one takes the remaining columns) */
+	const char *pstr_isa;       /*!< Name of the instruction set */
+} smm_impl_t;
+
+/* Statistics of the timed calls of a technique (measure_time) */
+typedef struct
+{
+	uint32_t ui32_n;            /*!< Number of calls */
+	float64_t f64_min;
+	float64_t f64_median;
+	float64_t f64_mad;          /*!< Median absolute deviation from the median */
+	float64_t f64_p95;
+	float64_t f64_p99;
+	float64_t f64_max;
+} time_stats_t;
+
+/* GEMM shape of the time measurements: C [M x N] += A [M x K] x B [K x N] (-shape=MxNxK, -shapes=file) */
+typedef struct
+{
+	uint32_t ui32_m;
+	uint32_t ui32_n;
+	uint32_t ui32_k;
+} smm_shape_t;
+
+/*! xoshiro128** generator (rng_u32), as the one of Parallelized_One_bit_error.c */
+typedef struct
+{
+	uint32_t aui32_s[4u];
+} st_rng_t;
+
+/* Roofline of the host (roofline_measure): ceilings of the time measurements */
+typedef struct
+{
+	float64_t af64_peak_gflops[e_ROOF_MAX]; /*!< Multiply-accumulate throughput of each instruction set [GFLOP/s], 0 if not available */
+	float64_t f64_bw_gbs;                   /*!< Memory bandwidth of the STREAM triad [GB/s], 0 if not measured */
+} roofline_t;
+
+/* Values of the hardware counters (perf_read) */
+typedef struct
+{
+	uint64_t aui64_count[e_PERF_MAX];   /*!< Count of each event (0 if the event is not counted) */
+	uint64_t ui64_enabled;              /*!< Time the group was enabled [ns] */
+	uint64_t ui64_running;              /*!< Time the group was counting [ns], < enabled if it was multiplexed */
+} perf_counts_t;
+
 #ifndef __STDC_LIB_EXT1__
 typedef int errno_t;
 #endif
@@ -247,13 +566,59 @@ typedef int errno_t;
 #define MEASUREMENT_LOOPS_DC   ((uint32_t) 1u)  /*!< Number of measurement test loops */
 
 #define MAX_DIM             ((uint32_t) 640u)
+#define SHAPES_MAX          ((uint32_t) 64u)    /*!< Shapes of the time measurements (-shape, -shapes) */
+#define SHAPE_N_MIN         ((uint32_t) 8u)     /*!< Columns of B / C: the AVX kernels process at least one vector of 8 */
+#define MEM_ALIGN           ((size_t) 64u)      /*!< Alignment of the buffers of the shapes (cache line, AVX-512 vector) */
+#define DNN_LAYERS          ((uint32_t) 24u)    /*!< Convolution layers of kast_dnn_layers (-layers) */
+#define DNN_LAYERS_CALLS    ((uint32_t) 5u)     /*!< Default timed calls per technique and layer with -layers */
 #define M                   ((uint32_t) 18u)//128u) /*!< TBD DESCRIPTION */
 #define N                   ((uint32_t) 900u)//57600u) /*!< TBD DESCRIPTION */
 #define K                   ((uint32_t) 1024u)//576u) /*!< TBD DESCRIPTION */
 
 #define INITIAL_REMAINDER 	((uint32_t) 0xFFFFFFFF) /* Initial value of CRC */
+
+/* Blocked GEMM (Experiment 5): register tile MR x NR, cache blocks MC x KC (A panel, L2) and KC x NC (B panel, L3) */
+#define BLK_MR              ((uint32_t) 6u)     /*!< Rows of the register tile (micro-kernel) */
+#define BLK_NR              ((uint32_t) 16u)    /*!< Columns of the register tile (2 x __m256) */
+#define BLK_KC              ((uint32_t) 256u)   /*!< Depth of the packed panels: KC x NR floats of B fit in L1 */
+#define BLK_MC              ((uint32_t) 144u)   /*!< Rows of the packed A block (multiple of BLK_MR), MC x KC fits in L2 */
+#define BLK_NC              ((uint32_t) 3072u)  /*!< Columns of the packed B block (multiple of BLK_NR), KC x NC fits in L3 */
+
+#ifdef _WIN32
+#define DEF_ALIGN(x) __declspec(align(x))
+#else
+#define DEF_ALIGN(x) __attribute__((aligned(x)))
+#endif
+
+/* AVX-512 kernels (Experiment 6): 16 floats per vector, CRC32C folding constants for a 512-bit distance
+   (x^544 and x^480 mod P, bit reflected and shifted one bit as required by the reflected carry-less product) */
+#define ZMM_NR              ((uint32_t) 16u)
+#define ZMM_CRC_K_LO        ((int64_t) 0x740EEF02)
+#define ZMM_CRC_K_HI        ((int64_t) 0x9E4ADDF8)
+
+/* Rows of A and C of a shard of the multi-threaded MMMs (smm_par_crc_rows, smm_par_shards) */
+#define SMM_OMP_ROWS        ((uint32_t) 32u)
 /* TESTS */
 #define TIME_SEC2USEC       ((uint32_t) 1000000u) /*!< Microseconds per second*/
+#define TIME_USEC2NSEC      ((uint32_t) 1000u)    /*!< Nanoseconds per microsecond */
+#define TIMER_CALIBRATION_NS ((float64_t) 50.0e6) /*!< Interval of the monotonic clock used to measure the TSC frequency */
+#define TIMER_OVERHEAD_READS ((uint32_t) 1001u)   /*!< Back to back reads to measure the cost of a timer read */
+/* Roofline microbenchmarks (measure_time): best of ROOF_REPEAT runs. The triad arrays (3 x 32 MB) exceed the LLC */
+#define ROOF_REPEAT         ((uint32_t) 10u)
+#define ROOF_MADD_ITER      ((uint64_t) 1000000u) /*!< Iterations of the peak loops, ROOF_MADD_ACC multiply-accumulates each */
+#define ROOF_MADD_ACC       ((uint32_t) 12u)      /*!< Independent accumulators: hide the latency on 2 FMA ports */
+#define ROOF_STREAM_ELEMS   ((size_t) (8u * 1024u * 1024u))
+/* Random numbers (-seed=): the streams of Parallelized_One_bit_error.c, the same seed gives the same matrices */
+#define RNG_SEED_DEFAULT    ((uint64_t) 1u)           /*!< Seed of the random numbers without -seed= */
+#define RNG_LANES           8u                        /*!< Generators of matrix2rand, element i from the generator i % RNG_LANES */
+#define RNG_STREAM_MATRIX   ((uint32_t) 0x80000000u)  /*!< First stream of matrix2rand (stream 0: random values of the faults) */
+#define RNG_ROTL(ui32_x, ui32_r) (((ui32_x) << (ui32_r)) | ((ui32_x) >> (32u - (ui32_r))))
+/* FP_ARITH_INST_RETIRED (event 0xC7) of Intel cores: scalar, 128, 256 and 512-bit packed single precision */
+#define PERF_RAW_INTEL_FP_SINGLE ((uint64_t) 0xAAC7u)
+
+/* Median and nearest-rank percentile of ui32_n sorted samples */
+#define TIME_MEDIAN_SORTED(paf64, ui32_n) (0.5 * ((paf64)[((ui32_n) - 1u) / 2u] + (paf64)[(ui32_n) / 2u]))
+#define TIME_RANK_SORTED(paf64, ui32_n, ui32_percent) ((paf64)[((((ui32_n) * (ui32_percent)) + 99u) / 100u) - 1u])
 
 
 #ifndef TRUE
@@ -262,6 +627,19 @@ typedef int errno_t;
 #endif
 
 typedef uint32_t bool32_t;
+
+/* Delta re-execution of the faulty MMMs of a campaign (-fi=delta|check, see smm_fi_campaign_alloc) */
+typedef struct
+{
+	smm_fi_golden_t st_golden;        /*!< Golden checkpoints of the current technique and size */
+	smm_fi_scratch_t st_scratch;      /*!< Scratch buffers of the delta re-executions */
+	float32_t *paf32_mc_in;           /*!< C before the golden MMM */
+	float32_t *paf32_mc_delta;        /*!< -fi=check: C of the golden execution of the delta */
+	bool32_t b32_delta_a;             /*!< Faults in A of the current technique and size: smm_fi_delta_a */
+	bool32_t b32_delta_b;             /*!< Faults in B of the current technique and size: smm_fi_delta_b */
+	uint32_t ui32_mismatch;           /*!< -fi=check: faults detected by one execution and not by the other */
+} smm_fi_campaign_t;
+
 /* ==============================================================================================================
 * 										CONSTS
 * ============================================================================================================== */
@@ -342,38 +720,45 @@ static const uint32_t kaui32_matrix_size[eSIZE_MAX] =
 	/* eSIZE_160_160 */ 160,
 	/* eSIZE_320_320 */ 320,
 	/* eSIZE_640_640 */ MAX_DIM
+};
 
-
-	/*				 M=32 N=921600 K=27
-	*				 M=64 N=230400 K=288
-	*				 M=32 N=230400 K=64
-	*				 M=128 N=57600 K=576
-	*				 M=64 N=57600 K=128
-	*				 M=256 N=14400 K=1152
-	*				 M=128 N=14400 K=256
-	*				 M=512 N=3600 K=2304
-	*				 M=256 N=3600 K=512
-	*				 M=1024 N=900 K=4608
-	*				 M=512 N=900 K=1024
-	*				 M=18 N=900 K=1024
-	*				 M=256 N=900 K=512
-	*				 M=256 N=3600 K=768
-	*				 M=18 N=3600 K=512
-	*				 M=128 N=3600 K=256
-	*				 M=128 N=14400 K=384
-	*				 M=18 N=14400 K=256
-	*				 M=128 N=14400 K=128
-	*				 M=64 N=57600 K=256
-	*				 M=18 N=57600 K=128
-	*				 M=128 N=57600 K=64
-	*				 M=32 N=230400 K=192
-	*				 M=18 N=230400 K=64
-	*				 */
+/* Convolution layers of the DNN as GEMM: C [M x N] += A [M x K] x B [K x N], M output channels, N output pixels and
+ * K = input channels x kernel size (-layers times all of them, in the order of the network) */
+static const smm_shape_t kast_dnn_layers[DNN_LAYERS] =
+{
+	/*         M        N       K */
+	/* L1  */ {   32u, 921600u,   27u },
+	/* L2  */ {   64u, 230400u,  288u },
+	/* L3  */ {   32u, 230400u,   64u },
+	/* L4  */ {  128u,  57600u,  576u },
+	/* L5  */ {   64u,  57600u,  128u },
+	/* L6  */ {  256u,  14400u, 1152u },
+	/* L7  */ {  128u,  14400u,  256u },
+	/* L8  */ {  512u,   3600u, 2304u },
+	/* L9  */ {  256u,   3600u,  512u },
+	/* L10 */ { 1024u,    900u, 4608u },
+	/* L11 */ {  512u,    900u, 1024u },
+	/* L12 */ {   18u,    900u, 1024u },
+	/* L13 */ {  256u,    900u,  512u },
+	/* L14 */ {  256u,   3600u,  768u },
+	/* L15 */ {   18u,   3600u,  512u },
+	/* L16 */ {  128u,   3600u,  256u },
+	/* L17 */ {  128u,  14400u,  384u },
+	/* L18 */ {   18u,  14400u,  256u },
+	/* L19 */ {  128u,  14400u,  128u },
+	/* L20 */ {   64u,  57600u,  256u },
+	/* L21 */ {   18u,  57600u,  128u },
+	/* L22 */ {  128u,  57600u,   64u },
+	/* L23 */ {   32u, 230400u,  192u },
+	/* L24 */ {   18u, 230400u,   64u }
 };
 
-static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_time_exp, bool32_t *pb32_dc_exp, bool32_t *pb32_ut_exp, bool32_t *pab32_selected_tech);
+static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_time_exp, bool32_t *pb32_dc_exp, bool32_t *pb32_ut_exp, bool32_t *pab32_selected_tech, e_fma_mode *pe_fma_mode, uint32_t *pui32_isa_mask, uint32_t *pui32_threads, e_fi_exec *pe_fi_exec, e_timer *pe_timer, bool32_t *pb32_perf, uint64_t *pui64_perf_fp,
+	smm_shape_t *past_shapes, uint32_t *pui32_shapes, uint32_t *pui32_calls, bool32_t *pb32_layers, uint64_t *pui64_seed);
+static bool32_t shape_parse(const char *pstr_shape, smm_shape_t* const pst_shape);
+static uint32_t shapes_load(const char *pstr_file, smm_shape_t* const past_shapes, uint32_t ui32_shapes);
 static bool32_t execute_unit_test(bool32_t ab32_selected_tech[TECH_MAX], float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc, float32_t* const paf32_mc_ref);
-static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc);
+static int32_t measure_time(const smm_shape_t* const past_shapes, uint32_t ui32_shapes, uint32_t ui32_calls, bool32_t b32_layers, bool32_t ab32_selected_tech[TECH_MAX]);
 static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], bool32_t b32_double_error,
 	float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc,
 	float32_t* const paf32_ma_fi, float32_t* const paf32_mb_fi,
@@ -395,12 +780,50 @@ static void_t mem_fi(float32_t* const paf32_m, uint32_t ui32_bit_idx);
 static void_t mem_fi_random_value(float32_t* const paf32_m, uint32_t ui32_max_dim, uint32_t ui32_n_length, bool32_t b32_consecutive);
 static void_t matrix2zeros(float32_t  * paf32_matrix, uint32_t ui32_max_rows, uint32_t ui32_max_columns);
 static void_t matrix2rand(float32_t  * paf32_matrix, uint32_t ui32_max_rows, uint32_t ui32_max_columns);
+static void_t rng_init(uint64_t ui64_seed);
+static void_t rng_seed(st_rng_t *pst_rng, uint64_t ui64_seed, uint32_t ui32_stream);
+static inline uint32_t rng_u32(st_rng_t *pst_rng);
+static inline uint32_t rng_range(st_rng_t *pst_rng, uint32_t ui32_range);
+static void_t* mem_alloc_aligned(size_t size);
+static void_t mem_free_aligned(void_t* pv_mem);
+static uint32_t cpu_detect_isa(void_t);
+static void_t smm_dispatch_techniques(uint32_t ui32_isa, bool32_t ab32_selected_tech[TECH_MAX]);
+static uint32_t smm_execute(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
+static uint32_t smm_par_shards(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
+static void_t smm_shard_states(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, smm_shard_sig_t* const past_sig);
+static void_t smm_shard_run(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, smm_shard_sig_t* const pst_sig);
+static void_t smm_shard_init(e_shard_merge e_merge, smm_shard_sig_t* const pst_acc);
+static void_t smm_shard_merge(e_shard_merge e_merge, smm_shard_sig_t* const pst_acc, const smm_shard_sig_t* const pst_sig);
+static uint32_t smm_shard_final(e_shard_merge e_merge, const smm_shard_sig_t* const pst_acc, uint32_t ui32_m, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma);
+static bool32_t smm_fi_delta_supported(e_enum_technique e_tech);
+static bool32_t smm_fi_delta_b_supported(e_enum_technique e_tech, uint32_t ui32_n);
+static uint32_t smm_fi_golden(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, float32_t* const paf32_mc_in, smm_fi_golden_t* const pst_golden, const smm_fi_scratch_t* const pst_scratch);
+static uint32_t smm_fi_delta_a(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_ma_fi, const float32_t* const paf32_mb, const float32_t* const paf32_mc_in, const smm_fi_golden_t* const pst_golden, const smm_fi_scratch_t* const pst_scratch);
+static uint32_t smm_fi_slice(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mc_in, uint32_t ui32_slice, const smm_fi_scratch_t* const pst_scratch);
+static uint32_t smm_fi_delta_b(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, const float32_t* const paf32_mb_fi, const float32_t* const paf32_mc_in, const smm_fi_golden_t* const pst_golden, const smm_fi_scratch_t* const pst_scratch);
+static void_t smm_fi_campaign_alloc(smm_fi_campaign_t* const pst_fi);
+static void_t smm_fi_campaign_free(smm_fi_campaign_t* const pst_fi);
+static uint32_t smm_fi_campaign_golden(e_enum_technique e_tech, uint32_t ui32_size, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, smm_fi_campaign_t* const pst_fi);
+static bool32_t smm_fi_campaign_detect(e_enum_technique e_tech, uint32_t ui32_size, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_ma_fi, const float32_t* const paf32_mb, const float32_t* const paf32_mb_fi, float32_t* const paf32_mc, uint32_t ui32_es_golden, smm_fi_campaign_t* const pst_fi);
+static e_timer timer_init(e_timer e_timer_req);
+static uint64_t timer_mono_ticks(void_t);
+static uint64_t timer_ticks(void_t);
+static void_t time_stats(float64_t* const paf64_samples, uint32_t ui32_n, time_stats_t* const pst_stats);
+static bool32_t perf_open(uint64_t ui64_raw_fp);
+static void_t perf_read(perf_counts_t* const pst_counts);
+static void_t perf_close(void_t);
+static void_t roofline_measure(roofline_t* const pst_roof);
+static float32_t roofline_peak_sse(uint64_t ui64_iter);
+static float32_t roofline_peak_avx2(uint64_t ui64_iter);
+static float32_t roofline_peak_avx512(uint64_t ui64_iter);
+static e_roof_isa roofline_isa(e_enum_technique e_tech);
 
 /* ==============================================================================================================
 * 											Experiment 0 : optimization
 ==============================================================================================================*/
 static uint32_t smm_no_dc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
 static uint32_t smm_no_dc_opt(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
+static uint32_t smm_no_dc_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
 
 /* ==============================================================================================================
 * 											Experiment 1 : individual
@@ -422,11 +845,23 @@ static uint32_t smm_fletcher_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t
 static uint32_t smm_fletcher_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
 static uint32_t smm_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
 static inline uint32_t Fletcher32c_ui32(ui32_to_ui16_t Fletcher, uint32_t ui32_data);
+static inline __m128i fletcher_mod65535_epi32(__m128i m128i_v);
+static inline __m256i ones_fold_epi64(__m256i m256i_sum);
+static uint32_t ones_lane_ui32(uint64_t ui64_sum, bool32_t b32_negate, bool32_t b32_zero_odd);
 /* 1.5) CRC */
 static uint32_t smm_crc_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
 static uint32_t smm_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
 static uint32_t smm_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
 static inline uint32_t singletable_crc32c_ui32(uint32_t ui32_crc, uint32_t ui32_data);
+static uint32_t crc32c_combine(uint32_t ui32_crc1, uint32_t ui32_crc2, uint64_t ui64_len2);
+static uint32_t crc32c_combine_zero(uint32_t ui32_crc1, uint32_t ui32_crc2, uint64_t ui64_len2);
+static uint32_t smm_crc32c_repeat(uint32_t ui32_crc, uint64_t ui64_len, uint64_t ui64_count);
+static uint32_t crc32c_multmodp(uint32_t ui32_a, uint32_t ui32_b);
+static uint32_t crc32c_xpow(uint64_t ui64_e);
+static uint32_t crc32c_sse42_ui32(uint32_t ui32_crc, uint32_t ui32_data);
+static inline uint32_t crc32c_m256(uint32_t ui32_crc, __m256i m256i_v);
+static inline uint32_t crc32c_shift_clmul(uint32_t ui32_crc, __m128i m128i_k);
+static uint32_t crc32c_shift_zeros_clmul(uint32_t ui32_crc, uint64_t ui64_len);
 
 /*==============================================================================================================
 * 											Experiment 2 : combinations 1.0
@@ -451,29 +886,87 @@ static uint32_t smm_comb(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, floa
 * 											Experiment 4 : AVX intel
 ==============================================================================================================*/
 
-static uint32_t smm_gemm_nn_intrincs_intel(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_xor_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_xor_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_xor_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_twos_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_twos_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_twos_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_ones_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_ones_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_ones_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_fletcher_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_fletcher_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_crc_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_xor_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
-static uint32_t smm_intel_flet_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
+SMM_MADD_VARIANTS_PROTO(smm_gemm_nn_intrincs_intel);
+SMM_MADD_VARIANTS_PROTO(smm_intel_xor_external);
+SMM_MADD_VARIANTS_PROTO(smm_intel_xor_intermediate);
+SMM_MADD_VARIANTS_PROTO(smm_intel_xor_internal);
+SMM_MADD_VARIANTS_PROTO(smm_intel_twos_external);
+SMM_MADD_VARIANTS_PROTO(smm_intel_twos_intermediate);
+SMM_MADD_VARIANTS_PROTO(smm_intel_twos_internal);
+SMM_MADD_VARIANTS_PROTO(smm_intel_ones_external);
+SMM_MADD_VARIANTS_PROTO(smm_intel_ones_intermediate);
+SMM_MADD_VARIANTS_PROTO(smm_intel_ones_internal);
+SMM_MADD_VARIANTS_PROTO(smm_intel_fletcher_external);
+SMM_MADD_VARIANTS_PROTO(smm_intel_fletcher_intermediate);
+SMM_MADD_VARIANTS_PROTO(smm_intel_fletcher_internal);
+SMM_MADD_VARIANTS_PROTO(smm_intel_crc_external);
+SMM_MADD_VARIANTS_PROTO(smm_intel_crc_intermediate);
+SMM_MADD_VARIANTS_PROTO(smm_intel_crc_internal);
+SMM_SHARD_VARIANTS_PROTO(smm_intel_crc_external_shard);
+SMM_SHARD_VARIANTS_PROTO(smm_intel_crc_intermediate_shard);
+SMM_SHARD_VARIANTS_PROTO(smm_intel_crc_internal_shard);
+static FORCE_INLINE void_t smm_intel_crc_external_rows(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX], const bool32_t b32_fma);
+static FORCE_INLINE void_t smm_intel_crc_intermediate_rows(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX], const bool32_t b32_fma);
+SMM_MADD_VARIANTS_PROTO(smm_intel_xor_flet);
+SMM_MADD_VARIANTS_PROTO(smm_intel_xor_crc);
+SMM_MADD_VARIANTS_PROTO(smm_intel_twos_flet);
+SMM_MADD_VARIANTS_PROTO(smm_intel_twos_crc);
+SMM_MADD_VARIANTS_PROTO(smm_intel_ones_flet);
+SMM_MADD_VARIANTS_PROTO(smm_intel_ones_crc);
+SMM_MADD_VARIANTS_PROTO(smm_intel_flet_crc);
+
+/*==============================================================================================================
+* 											Experiment 5 : blocked AVX GEMM
+==============================================================================================================*/
+SMM_MADD_VARIANTS_PROTO(smm_intel_blocked_no_dc);
+SMM_MADD_VARIANTS_PROTO(smm_intel_blocked_xor);
+SMM_MADD_VARIANTS_PROTO(smm_intel_blocked_ones);
+SMM_MADD_VARIANTS_PROTO(smm_intel_blocked_twos);
+SMM_MADD_VARIANTS_PROTO(smm_intel_blocked_fletcher);
+SMM_MADD_VARIANTS_PROTO(smm_intel_blocked_crc);
+static FORCE_INLINE uint32_t smm_blk_gemm(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, e_blk_sig e_sig, const bool32_t b32_fma);
+static void_t smm_blk_pack_a(uint32_t ui32_mc, uint32_t ui32_kc, uint32_t ui32_lda, float32_t f32_alpha, const float32_t* const paf32_ma, float32_t* const paf32_pack, blk_sig_t* const p_sig);
+static void_t smm_blk_pack_b(uint32_t ui32_kc, uint32_t ui32_nc, uint32_t ui32_ldb, const float32_t* const paf32_mb, float32_t* const paf32_pack, blk_sig_t* const p_sig);
+static FORCE_INLINE void_t smm_blk_kernel_6x16(uint32_t ui32_kc, const float32_t* const paf32_pa, const float32_t* const paf32_pb, float32_t* const paf32_mc, uint32_t ui32_ldc, blk_sig_t* const p_sig, const bool32_t b32_fma);
+static uint32_t smm_blk_sig_finalize(const blk_sig_t* const p_sig);
+
+/*==============================================================================================================
+* 											Experiment 6 : AVX-512
+==============================================================================================================*/
+SMM_MADD_VARIANTS_PROTO(smm_avx512_no_dc);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_xor);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_ones);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_twos);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_fletcher);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_crc);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_xor_flet);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_xor_crc);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_ones_flet);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_ones_crc);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_twos_flet);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_twos_crc);
+SMM_MADD_VARIANTS_PROTO(smm_avx512_flet_crc);
+SMM_SHARD_VARIANTS_PROTO(smm_avx512_ones_shard);
+SMM_SHARD_VARIANTS_PROTO(smm_avx512_fletcher_shard);
+SMM_SHARD_VARIANTS_PROTO(smm_avx512_crc_shard);
+SMM_SHARD_VARIANTS_PROTO(smm_avx512_xor_crc_shard);
+SMM_SHARD_VARIANTS_PROTO(smm_avx512_twos_flet_shard);
+static FORCE_INLINE uint32_t smm_avx512_gemm(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, e_blk_sig e_inner, e_blk_sig e_outer, smm_shard_sig_t* const pst_sig, const bool32_t b32_fma);
+static uint32_t smm_avx512_sig_final(const smm_shard_sig_t* const pst_sig, uint32_t ui32_fletcher_a);
+static void_t smm_avx512_shard_merge(smm_shard_sig_t* const pst_acc, const smm_shard_sig_t* const pst_sig);
+static uint32_t smm_avx512_shard_final(const smm_shard_sig_t* const pst_acc, uint32_t ui32_m, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma);
+
+/*==============================================================================================================
+* 											Experiment 7 : parallel CRC
+==============================================================================================================*/
+static void_t smm_crc_internal_rows(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX]);
+static FORCE_INLINE void_t smm_intel_crc_internal_rows(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX], const bool32_t b32_fma);
+static void_t smm_intel_crc_internal_rows_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX]);
+static void_t smm_intel_crc_internal_rows_mul_add(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX]);
+static uint32_t smm_par_crc_rows(ptr_fn_smm_crc_rows_t ptr_fn, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
+static uint32_t smm_par_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
+static uint32_t smm_par_intel_crc_internal_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
+static uint32_t smm_par_intel_crc_internal_mul_add(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc);
 
 
 uint32_t(*ptr_fn_smm_technique[TECH_MAX])(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc) =
@@ -521,41 +1014,67 @@ uint32_t(*ptr_fn_smm_technique[TECH_MAX])(uint32_t ui32_m, uint32_t ui32_n, uint
 	smm_crc_internal_comb
 
 	/* INTRINSIC INTEL INSTRUCTIONS */
-	,smm_gemm_nn_intrincs_intel,
+	,smm_gemm_nn_intrincs_intel_fma,
 
 	/* XOR */
-	smm_intel_xor_external,
-	smm_intel_xor_intermediate,
-	smm_intel_xor_internal,
+	smm_intel_xor_external_fma,
+	smm_intel_xor_intermediate_fma,
+	smm_intel_xor_internal_fma,
 
 	/* 1's COMPLEMENT */
-	smm_intel_ones_external,
-	smm_intel_ones_intermediate,
-	smm_intel_ones_internal,
+	smm_intel_ones_external_fma,
+	smm_intel_ones_intermediate_fma,
+	smm_intel_ones_internal_fma,
 
 	/* 2's COMPLEMENT */
-	smm_intel_twos_external,
-	smm_intel_twos_intermediate,
-	smm_intel_twos_internal,
+	smm_intel_twos_external_fma,
+	smm_intel_twos_intermediate_fma,
+	smm_intel_twos_internal_fma,
 
 	/* FLETCHER */
-	smm_intel_fletcher_external,
-	smm_intel_fletcher_intermediate,
-	smm_intel_fletcher_internal,
+	smm_intel_fletcher_external_fma,
+	smm_intel_fletcher_intermediate_fma,
+	smm_intel_fletcher_internal_fma,
 
 	/* CRC */
-	smm_intel_crc_external,
-	smm_intel_crc_intermediate,
-	smm_intel_crc_internal,
+	smm_intel_crc_external_fma,
+	smm_intel_crc_intermediate_fma,
+	smm_intel_crc_internal_fma,
 
 	/* MIX */
-	smm_intel_xor_flet,
-	smm_intel_xor_crc,
-	smm_intel_ones_flet,
-	smm_intel_ones_crc,
-	smm_intel_twos_flet,
-	smm_intel_twos_crc,
-	smm_intel_flet_crc,
+	smm_intel_xor_flet_fma,
+	smm_intel_xor_crc_fma,
+	smm_intel_ones_flet_fma,
+	smm_intel_ones_crc_fma,
+	smm_intel_twos_flet_fma,
+	smm_intel_twos_crc_fma,
+	smm_intel_flet_crc_fma,
+
+	/* BLOCKED GEMM */
+	smm_intel_blocked_no_dc_fma,
+	smm_intel_blocked_xor_fma,
+	smm_intel_blocked_ones_fma,
+	smm_intel_blocked_twos_fma,
+	smm_intel_blocked_fletcher_fma,
+	smm_intel_blocked_crc_fma,
+
+	/* AVX-512 */
+	smm_avx512_no_dc_fma,
+	smm_avx512_xor_fma,
+	smm_avx512_ones_fma,
+	smm_avx512_twos_fma,
+	smm_avx512_fletcher_fma,
+	smm_avx512_crc_fma,
+	smm_avx512_xor_flet_fma,
+	smm_avx512_xor_crc_fma,
+	smm_avx512_ones_flet_fma,
+	smm_avx512_ones_crc_fma,
+	smm_avx512_twos_flet_fma,
+	smm_avx512_twos_crc_fma,
+	smm_avx512_flet_crc_fma,
+
+	smm_par_crc_internal,
+	smm_par_intel_crc_internal_fma,
 
 	/* ADITIONAL */
 	smm_comb
@@ -627,9 +1146,87 @@ const char *pstr_technique[TECH_MAX] =
 	"INTEL_TWOS_CRC",
 	"INTEL_FLET_CRC",
 
+	"INTEL_BLOCKED_NO_DC",
+	"INTEL_BLOCKED_XOR",
+	"INTEL_BLOCKED_ONES",
+	"INTEL_BLOCKED_TWOS",
+	"INTEL_BLOCKED_FLETCHER",
+	"INTEL_BLOCKED_CRC",
+
+	"AVX512_NO_DC",
+	"AVX512_XOR",
+	"AVX512_ONES",
+	"AVX512_TWOS",
+	"AVX512_FLETCHER",
+	"AVX512_CRC",
+	"AVX512_XOR_FLET",
+	"AVX512_XOR_CRC",
+	"AVX512_ONES_FLET",
+	"AVX512_ONES_CRC",
+	"AVX512_TWOS_FLET",
+	"AVX512_TWOS_CRC",
+	"AVX512_FLET_CRC",
+
+	"PAR_CRC_INTERNAL",
+	"PAR_INTEL_CRC_INTERNAL",
+
 	"MAXIMUM"
 };
 
+/* Implementations that need instruction set extensions. A technique may have several of them, listed from the
+   fastest to the most portable: smm_dispatch_techniques keeps in ptr_fn_smm_technique the first one supported by
+   the CPU and disables the technique when there is none. Techniques not listed here are portable C (serial).
+   With -threads, the listed implementations whose signature state has an exact merge (e_merge) are executed on row
+   shards (see smm_par_shards); the other ones run their serial kernel and the PAR_* ones are already multi-threaded.
+   e_col_merge / ui32_col_slice: the kernels whose ES is the XOR / sum of the ES of column slices of B and C (the
+   delta of the faults in B, smm_fi_delta_b). */
+static const smm_impl_t ast_smm_impl[] =
+{
+	{ TECH_INTEL_NO_DC, e_ISA_AVX | e_ISA_AVX2, smm_gemm_nn_intrincs_intel_fma, smm_gemm_nn_intrincs_intel_mul_add, e_SHARD_MERGE_XOR, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_XOR_EXTERNAL, e_ISA_AVX | e_ISA_AVX2, smm_intel_xor_external_fma, smm_intel_xor_external_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_XOR_INTERMEDIATE, e_ISA_AVX | e_ISA_AVX2, smm_intel_xor_intermediate_fma, smm_intel_xor_intermediate_mul_add, e_SHARD_MERGE_XOR, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_XOR_INTERNAL, e_ISA_AVX | e_ISA_AVX2, smm_intel_xor_internal_fma, smm_intel_xor_internal_mul_add, e_SHARD_MERGE_XOR, NULL, NULL, e_SHARD_MERGE_XOR, 8u, "AVX2" },
+	{ TECH_INTEL_ONES_EXTERNAL, e_ISA_AVX | e_ISA_AVX2, smm_intel_ones_external_fma, smm_intel_ones_external_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_ONES_INTERMEDIATE, e_ISA_AVX | e_ISA_AVX2, smm_intel_ones_intermediate_fma, smm_intel_ones_intermediate_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_ONES_INTERNAL, e_ISA_AVX | e_ISA_AVX2, smm_intel_ones_internal_fma, smm_intel_ones_internal_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_TWOS_EXTERNAL, e_ISA_AVX | e_ISA_AVX2, smm_intel_twos_external_fma, smm_intel_twos_external_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_TWOS_INTERMEDIATE, e_ISA_AVX | e_ISA_AVX2, smm_intel_twos_intermediate_fma, smm_intel_twos_intermediate_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_TWOS_INTERNAL, e_ISA_AVX | e_ISA_AVX2, smm_intel_twos_internal_fma, smm_intel_twos_internal_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_FLETCHER_EXTERNAL, e_ISA_AVX | e_ISA_AVX2, smm_intel_fletcher_external_fma, smm_intel_fletcher_external_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_FLETCHER_INTERMEDIATE, e_ISA_AVX | e_ISA_AVX2, smm_intel_fletcher_intermediate_fma, smm_intel_fletcher_intermediate_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_FLETCHER_INTERNAL, e_ISA_AVX | e_ISA_AVX2, smm_intel_fletcher_internal_fma, smm_intel_fletcher_internal_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_CRC_EXTERNAL, e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42, smm_intel_crc_external_fma, smm_intel_crc_external_mul_add, e_SHARD_MERGE_CRC, smm_intel_crc_external_shard_fma, smm_intel_crc_external_shard_mul_add, e_SHARD_MERGE_SERIAL, 0u, "AVX2 + SSE4.2" },
+	{ TECH_INTEL_CRC_INTERMEDIATE, e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42, smm_intel_crc_intermediate_fma, smm_intel_crc_intermediate_mul_add, e_SHARD_MERGE_CRC, smm_intel_crc_intermediate_shard_fma, smm_intel_crc_intermediate_shard_mul_add, e_SHARD_MERGE_SERIAL, 0u, "AVX2 + SSE4.2" },
+	{ TECH_INTEL_CRC_INTERNAL, e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42 | e_ISA_PCLMUL, smm_intel_crc_internal_fma, smm_intel_crc_internal_mul_add, e_SHARD_MERGE_CRC, smm_intel_crc_internal_shard_fma, smm_intel_crc_internal_shard_mul_add, e_SHARD_MERGE_SERIAL, 0u, "AVX2 + SSE4.2 + PCLMUL" },
+	{ TECH_INTEL_XOR_FLET, e_ISA_AVX | e_ISA_AVX2, smm_intel_xor_flet_fma, smm_intel_xor_flet_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_XOR_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42, smm_intel_xor_crc_fma, smm_intel_xor_crc_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2 + SSE4.2" },
+	{ TECH_INTEL_ONES_FLET, e_ISA_AVX | e_ISA_AVX2, smm_intel_ones_flet_fma, smm_intel_ones_flet_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_ONES_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42, smm_intel_ones_crc_fma, smm_intel_ones_crc_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2 + SSE4.2" },
+	{ TECH_INTEL_TWOS_FLET, e_ISA_AVX | e_ISA_AVX2, smm_intel_twos_flet_fma, smm_intel_twos_flet_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_TWOS_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42, smm_intel_twos_crc_fma, smm_intel_twos_crc_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2 + SSE4.2" },
+	{ TECH_INTEL_FLET_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42, smm_intel_flet_crc_fma, smm_intel_flet_crc_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2 + SSE4.2" },
+	{ TECH_INTEL_BLOCKED_NO_DC, e_ISA_AVX | e_ISA_AVX2, smm_intel_blocked_no_dc_fma, smm_intel_blocked_no_dc_mul_add, e_SHARD_MERGE_XOR, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_BLOCKED_XOR, e_ISA_AVX | e_ISA_AVX2, smm_intel_blocked_xor_fma, smm_intel_blocked_xor_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_XOR, 8u, "AVX2" },
+	{ TECH_INTEL_BLOCKED_ONES, e_ISA_AVX | e_ISA_AVX2, smm_intel_blocked_ones_fma, smm_intel_blocked_ones_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_BLOCKED_TWOS, e_ISA_AVX | e_ISA_AVX2, smm_intel_blocked_twos_fma, smm_intel_blocked_twos_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SUM, 8u, "AVX2" },
+	{ TECH_INTEL_BLOCKED_FLETCHER, e_ISA_AVX | e_ISA_AVX2, smm_intel_blocked_fletcher_fma, smm_intel_blocked_fletcher_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2" },
+	{ TECH_INTEL_BLOCKED_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42, smm_intel_blocked_crc_fma, smm_intel_blocked_crc_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2 + SSE4.2" },
+	{ TECH_AVX512_NO_DC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42, smm_avx512_no_dc_fma, smm_avx512_no_dc_mul_add, e_SHARD_MERGE_XOR, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX-512" },
+	{ TECH_AVX512_XOR, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42, smm_avx512_xor_fma, smm_avx512_xor_mul_add, e_SHARD_MERGE_XOR, NULL, NULL, e_SHARD_MERGE_XOR, 16u, "AVX-512" },
+	{ TECH_AVX512_ONES, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42, smm_avx512_ones_fma, smm_avx512_ones_mul_add, e_SHARD_MERGE_AVX512, smm_avx512_ones_shard_fma, smm_avx512_ones_shard_mul_add, e_SHARD_MERGE_SERIAL, 0u, "AVX-512" },
+	{ TECH_AVX512_TWOS, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42, smm_avx512_twos_fma, smm_avx512_twos_mul_add, e_SHARD_MERGE_SUM, NULL, NULL, e_SHARD_MERGE_SUM, 16u, "AVX-512" },
+	{ TECH_AVX512_FLETCHER, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42, smm_avx512_fletcher_fma, smm_avx512_fletcher_mul_add, e_SHARD_MERGE_AVX512, smm_avx512_fletcher_shard_fma, smm_avx512_fletcher_shard_mul_add, e_SHARD_MERGE_SERIAL, 0u, "AVX-512" },
+	{ TECH_AVX512_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42 | e_ISA_PCLMUL | e_ISA_VPCLMUL, smm_avx512_crc_fma, smm_avx512_crc_mul_add, e_SHARD_MERGE_AVX512, smm_avx512_crc_shard_fma, smm_avx512_crc_shard_mul_add, e_SHARD_MERGE_SERIAL, 0u, "AVX-512 + VPCLMULQDQ" },
+	{ TECH_AVX512_XOR_FLET, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42, smm_avx512_xor_flet_fma, smm_avx512_xor_flet_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX-512" },
+	{ TECH_AVX512_XOR_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42 | e_ISA_PCLMUL | e_ISA_VPCLMUL, smm_avx512_xor_crc_fma, smm_avx512_xor_crc_mul_add, e_SHARD_MERGE_AVX512, smm_avx512_xor_crc_shard_fma, smm_avx512_xor_crc_shard_mul_add, e_SHARD_MERGE_XOR, 16u, "AVX-512 + VPCLMULQDQ" },
+	{ TECH_AVX512_ONES_FLET, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42, smm_avx512_ones_flet_fma, smm_avx512_ones_flet_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX-512" },
+	{ TECH_AVX512_ONES_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42 | e_ISA_PCLMUL | e_ISA_VPCLMUL, smm_avx512_ones_crc_fma, smm_avx512_ones_crc_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX-512 + VPCLMULQDQ" },
+	{ TECH_AVX512_TWOS_FLET, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42, smm_avx512_twos_flet_fma, smm_avx512_twos_flet_mul_add, e_SHARD_MERGE_AVX512, smm_avx512_twos_flet_shard_fma, smm_avx512_twos_flet_shard_mul_add, e_SHARD_MERGE_SERIAL, 0u, "AVX-512" },
+	{ TECH_AVX512_TWOS_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42 | e_ISA_PCLMUL | e_ISA_VPCLMUL, smm_avx512_twos_crc_fma, smm_avx512_twos_crc_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX-512 + VPCLMULQDQ" },
+	{ TECH_AVX512_FLET_CRC, e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA | e_ISA_AVX512F | e_ISA_SSE42 | e_ISA_PCLMUL | e_ISA_VPCLMUL, smm_avx512_flet_crc_fma, smm_avx512_flet_crc_mul_add, e_SHARD_MERGE_SERIAL, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX-512 + VPCLMULQDQ" },
+	{ TECH_PAR_INTEL_CRC_INTERNAL, e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42 | e_ISA_PCLMUL, smm_par_intel_crc_internal_fma, smm_par_intel_crc_internal_mul_add, e_SHARD_MERGE_MAX, NULL, NULL, e_SHARD_MERGE_SERIAL, 0u, "AVX2 + SSE4.2 + PCLMUL" }
+};
+
 #ifdef Square_mtrx
 float32_t af32_matrix_a[MAX_DIM * MAX_DIM],
 af32_matrix_b[MAX_DIM * MAX_DIM],
@@ -656,6 +1253,54 @@ float32_t af32_matrix_a_fi[M * K],
 af32_matrix_b_fi[K * N];
 #endif
 
+/* Multiply-accumulate of the AVX kernels (variant selected by smm_dispatch_techniques), selected in main */
+static bool32_t b32_use_fma = FALSE;
+
+/* Instruction set extensions of the CPU (e_isa_flag mask), probed in main */
+static uint32_t ui32_cpu_isa = e_ISA_NONE;
+
+/* CRC32C step of the portable C techniques (see SMM_CRC32C_UI32), selected in main */
+static uint32_t (*pfn_crc32c_ui32)(uint32_t ui32_crc, uint32_t ui32_data) = singletable_crc32c_ui32;
+
+/* Packed panels of the blocked GEMM (Experiment 5) */
+static DEF_ALIGN(64) float32_t af32_blk_pack_a[BLK_MC * BLK_KC];
+static DEF_ALIGN(64) float32_t af32_blk_pack_b[BLK_KC * BLK_NC];
+#pragma omp threadprivate(af32_blk_pack_a, af32_blk_pack_b)
+
+/* Number of threads of the row shards of the SIMD techniques (-threads=N), 0: serial kernels */
+static uint32_t ui32_omp_threads = 0u;
+
+/* Signature states of the row shards of smm_par_shards, grown to the largest MMM (allocated once) */
+static smm_shard_sig_t *past_shard_sig = NULL;
+static uint32_t ui32_shard_sig_max = 0u;
+
+/* Execution of the faulty MMMs of the single bit campaign (-fi=full|delta|check), selected in main */
+static e_fi_exec e_fi_mode = e_FI_EXEC_FULL;
+
+/* Clock of the time measurements (-timer=mono|tsc), its resolution and the cost of a read, set by timer_init in main */
+static e_timer e_timer_src = e_TIMER_MONO;
+static float64_t f64_timer_ns_per_tick = 1.0;
+static float64_t f64_timer_overhead_ns = 0.0;
+
+/* Hardware counters (-perf): file descriptor of each event (-1: not counted) and of the group leader, position in
+   the group read and number of events of the group (0: counters not used), opened by perf_open in main */
+static int32_t ai32_perf_fd[e_PERF_MAX] = { -1, -1, -1, -1, -1, -1 };
+static int32_t i32_perf_fd_leader = -1;
+static uint32_t aui32_perf_slot[e_PERF_MAX];
+static uint32_t ui32_perf_events = 0u;
+static const char *kapstr_perf_event[e_PERF_MAX] = { "Cycles", "Instructions", "L1D misses", "LLC misses", "Branch misses", "SIMD FP" };
+static const char *kapstr_roof_isa[e_ROOF_MAX] = { "SSE", "AVX2", "AVX-512" };
+
+static uint64_t ui64_rng_seed = RNG_SEED_DEFAULT;  /*!< Seed of the random numbers (-seed=), written in the time CSV file */
+static st_rng_t st_rng;                            /*!< Random values and sites of the faults (stream 0), see rng_init */
+static st_rng_t ast_rng_matrix[RNG_LANES];         /*!< Generators of matrix2rand */
+
+/* Implementation selected for each technique by smm_dispatch_techniques, NULL: portable C technique */
+static const smm_impl_t *apst_tech_impl[TECH_MAX];
+
+/* Row shard of each technique (FMA or mul + add variant), NULL: the shard state is the ES of ptr_fn_smm_technique */
+static ptr_fn_smm_shard_t aptr_fn_smm_shard[TECH_MAX];
+
 #if !defined __linux__ || !defined _WIN32
 int32_t argc = 4;
 const char *argv[] = { "testing", "-t","-s=18", "-f=all" };
@@ -682,6 +1327,19 @@ int32_t main(void)
 		b32_ut_result,
 		ab32_selected_tech[TECH_MAX];
 	e_enum_size_2d e_size_max;
+	e_fma_mode e_fma = e_FMA_AUTO;
+	uint32_t ui32_isa_mask = e_ISA_ALL;
+	uint32_t ui32_threads = 0u;
+	e_fi_exec e_fi = e_FI_EXEC_FULL;
+	e_timer e_tmr = e_TIMER_MONO;
+	bool32_t b32_perf = FALSE;
+	uint64_t ui64_perf_fp = 0u;
+	smm_shape_t ast_shapes[SHAPES_MAX];
+	uint32_t ui32_shapes = 0u,
+		ui32_calls = MEASUREMENT_LOOPS * TIME_MEASUREMENT_LOOPS;
+	bool32_t b32_layers = FALSE;
+	uint64_t ui64_seed = RNG_SEED_DEFAULT;
+	e_enum_size_2d e_size;
 	uint32_t ui32_fi_max_variables = 10u,
 		ui32_fi_iterations = 10u;
 
@@ -694,7 +1352,66 @@ int32_t main(void)
 	*| STEP 1: Process configuration arguments
 	***********************************************************************************************************************/
 	printf("\n [1] Process configuration arguments");
-	e_size_max = process_args(argc, argv, &b32_time_exp, &b32_dc_exp, &b32_ut_exp, &ab32_selected_tech[0u]);
+	e_size_max = process_args(argc, argv, &b32_time_exp, &b32_dc_exp, &b32_ut_exp, &ab32_selected_tech[0u], &e_fma, &ui32_isa_mask, &ui32_threads, &e_fi, &e_tmr, &b32_perf, &ui64_perf_fp,
+		&ast_shapes[0u], &ui32_shapes, &ui32_calls, &b32_layers, &ui64_seed);
+	rng_init(ui64_seed);
+	printf("\n\t Seed of the random numbers = %llu", (unsigned long long)ui64_seed);
+
+	/* Instruction sets of this CPU (optionally limited by the user) -> implementation of each technique */
+	ui32_cpu_isa = cpu_detect_isa() & ui32_isa_mask;
+	printf("\n\t Instruction sets:%s%s%s%s%s%s%s%s%s", (ui32_cpu_isa == e_ISA_NONE) ? " baseline" : "",
+		(ui32_cpu_isa & e_ISA_SSE42) ? " SSE4.2" : "", (ui32_cpu_isa & e_ISA_PCLMUL) ? " PCLMUL" : "",
+		(ui32_cpu_isa & e_ISA_AVX) ? " AVX" : "", (ui32_cpu_isa & e_ISA_AVX2) ? " AVX2" : "",
+		(ui32_cpu_isa & e_ISA_FMA) ? " FMA" : "", (ui32_cpu_isa & e_ISA_AVX512F) ? " AVX512F" : "",
+		((ui32_cpu_isa & e_ISA_AVX512BW) && (ui32_cpu_isa & e_ISA_AVX512VL)) ? " AVX512BW/VL" : "",
+		(ui32_cpu_isa & e_ISA_VPCLMUL) ? " VPCLMULQDQ" : "");
+
+	/* Multiply-accumulate of the AVX kernels. FMA rounds once instead of twice, so C and therefore every
+	   execution signature depend on this choice: it is fixed here, before any golden or faulty execution,
+	   and selects the variant of each kernel. */
+	b32_use_fma = ((e_fma != e_FMA_OFF) && ((ui32_cpu_isa & e_ISA_FMA) != 0u)) ? TRUE : FALSE;
+	if ((e_fma == e_FMA_ON) && (b32_use_fma == FALSE))
+	{
+		printf("\n ---> FMA requested but not supported by this CPU, using MUL + ADD");
+	}
+	printf("\n\t Multiply-accumulate: %s", b32_use_fma ? "FMA" : "MUL + ADD");
+	smm_dispatch_techniques(ui32_cpu_isa, ab32_selected_tech);
+
+	/* Same CRC32C value with both implementations: only the speed of the portable C techniques changes */
+	pfn_crc32c_ui32 = ((ui32_cpu_isa & e_ISA_SSE42) != 0u) ? crc32c_sse42_ui32 : singletable_crc32c_ui32;
+	printf("\n\t CRC32C of the C techniques: %s", ((ui32_cpu_isa & e_ISA_SSE42) != 0u) ? "SSE4.2" : "look-up table");
+
+	/* Every call of the time measurements is timed with this clock */
+	e_tmr = timer_init(e_tmr);
+	printf("\n\t Timer: %s (%.3f ns per tick, %.1f ns per read)", (e_tmr == e_TIMER_TSC) ? "rdtscp" : "monotonic clock",
+		f64_timer_ns_per_tick, f64_timer_overhead_ns);
+	if (b32_perf && perf_open(ui64_perf_fp) && (ui32_threads > 0u))
+	{
+		printf("\n ---> The hardware counters only count the main thread, not the other threads of the row shards");
+	}
+
+	/* Row shards of the SIMD techniques with an exact merge of their signature state: the ES is the serial one */
+	ui32_omp_threads = ui32_threads;
+	e_fi_mode = e_fi;
+	if (ui32_omp_threads == 0u)
+	{
+		printf("\n\t Execution: serial kernels");
+	}
+	else
+	{
+		printf("\n\t Execution: row shards of %u rows, %u threads (techniques without an exact merge: serial kernel)", SMM_OMP_ROWS, ui32_omp_threads);
+#ifndef _OPENMP
+		printf("\n ---> Built without OpenMP (-fopenmp): the row shards are executed by one thread");
+#endif
+	}
+	printf("\n\t Single bit campaign: %s", (e_fi_mode == e_FI_EXEC_DELTA) ? "delta re-execution of the faults in A (row shard) and B (column slice)" :
+		(e_fi_mode == e_FI_EXEC_CHECK) ? "delta re-execution checked against full execution" : "full execution");
+#ifndef Square_mtrx
+	if (e_fi_mode != e_FI_EXEC_FULL)
+	{
+		printf("\n ---> -fi=delta|check is only used by the campaign of the square matrices: full execution");
+	}
+#endif
 
 	/***********************************************************************************************************************
 	*| STEP 2: UNIT TESTS
@@ -713,15 +1430,35 @@ int32_t main(void)
 	/***********************************************************************************************************************
 	*| STEP 3 - Execute Tests - Measure Time
 	***********************************************************************************************************************/
-	printf("\n\n [3] Measure Time (number iteration = %u)", MEASUREMENT_LOOPS);
+	printf("\n\n [3] Measure Time (%u timed calls per technique and shape)", ui32_calls);
 	if (b32_time_exp)
 	{
-		measure_time(e_size_max, ab32_selected_tech, &af32_matrix_a[0u], &af32_matrix_b[0u], &af32_matrix_c[0u]);
+		/* Without -shape / -shapes: the square sizes up to -s (the compile-time M x N x K for unbalanced matrices) */
+		if (ui32_shapes == 0u)
+		{
+#ifdef Square_mtrx
+			for (e_size = eSIZE_40_40; e_size <= ((e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u)); e_size++)
+			{
+				ast_shapes[ui32_shapes].ui32_m = kaui32_matrix_size[e_size];
+				ast_shapes[ui32_shapes].ui32_n = kaui32_matrix_size[e_size];
+				ast_shapes[ui32_shapes].ui32_k = kaui32_matrix_size[e_size];
+				ui32_shapes++;
+			}
+#else
+			(void)e_size;
+			ast_shapes[0u].ui32_m = M;
+			ast_shapes[0u].ui32_n = N;
+			ast_shapes[0u].ui32_k = K;
+			ui32_shapes = 1u;
+#endif
+		}
+		measure_time(&ast_shapes[0u], ui32_shapes, ui32_calls, b32_layers, ab32_selected_tech);
 	}
 	else
 	{
 		printf("\n ---> User argument requested to skip time measurements");
 	}
+	perf_close();
 
 
 	/***********************************************************************************************************************
@@ -781,11 +1518,24 @@ int32_t main(void)
 ** @param[in]     argv           Array of argument strings
 ** @param[in,out] pb32_time_exp  Execute time measurement experiments boolean option
 ** @param[in,out] pb32_dc_exp    Execute DC measurement experiments boolean option
+** @param[out]    pe_fma_mode    Multiply-accumulate requested for the AVX kernels
+** @param[out]    pui32_isa_mask Instruction sets allowed by the user (e_isa_flag mask)
+** @param[out]    pui32_threads  Threads of the row shards, 0: serial execution
+** @param[out]    pe_fi_exec     Execution of the faulty MMMs of the single bit campaign
+** @param[out]    pe_timer       Clock of the time measurements
+** @param[out]    pb32_perf      Read the hardware counters around each timed call
+** @param[out]    pui64_perf_fp  Raw event of the SIMD FP counter, 0: FP_ARITH_INST_RETIRED on Intel
+** @param[out]    past_shapes    Shapes of the time measurements (SHAPES_MAX)
+** @param[out]    pui32_shapes   Number of shapes, 0: square sizes up to -s
+** @param[out]    pui32_calls    Timed calls per technique and shape
+** @param[out]    pb32_layers    -layers: the shapes are the layers of the DNN (kast_dnn_layers)
+** @param[out]    pui64_seed     Seed of the random numbers (-seed=)
 **
 ** @return  e_enum_size_2d Maximum matrix size
 **
 ******************************************************************************/
-static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_time_exp, bool32_t *pb32_dc_exp, bool32_t *pb32_ut_exp, bool32_t *pab32_selected_tech)
+static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_time_exp, bool32_t *pb32_dc_exp, bool32_t *pb32_ut_exp, bool32_t *pab32_selected_tech, e_fma_mode *pe_fma_mode, uint32_t *pui32_isa_mask, uint32_t *pui32_threads, e_fi_exec *pe_fi_exec, e_timer *pe_timer, bool32_t *pb32_perf, uint64_t *pui64_perf_fp,
+	smm_shape_t *past_shapes, uint32_t *pui32_shapes, uint32_t *pui32_calls, bool32_t *pb32_layers, uint64_t *pui64_seed)
 {
 	uint32_t ui32_idx,
 		ui32_matrix_size;
@@ -798,6 +1548,21 @@ static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_ti
 		b32_ut_exp = TRUE,
 		b32_help = FALSE;
 	e_enum_technique e_tech;
+	e_fma_mode e_fma = e_FMA_AUTO;
+	uint32_t ui32_isa_mask = e_ISA_ALL,
+		ui32_threads = 0u;
+	const char *pstr_arg_threads = NULL;
+	e_fi_exec e_fi = e_FI_EXEC_FULL;
+	e_timer e_tmr = e_TIMER_MONO;
+	bool32_t b32_perf = FALSE;
+	uint64_t ui64_perf_fp = 0u;
+	uint32_t ui32_shapes = 0u,
+		ui32_calls = 0u;
+	bool32_t b32_layers = FALSE;
+	uint64_t ui64_seed = RNG_SEED_DEFAULT;
+	char str_shape[64u];
+	const char *pstr_item;
+	size_t size_item;
 	bool32_t ab32_b_tech_all[TECH_MAX],
 		ab32_b_tech_best[TECH_MAX],
 		ab32_b_tech_best_dc[TECH_MAX],
@@ -816,6 +1581,8 @@ static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_ti
 		ab32_b_tech_best_dc_time[e_tech] = FALSE;
 	}
 	ab32_b_tech_best[TECH_INTEL_NO_DC] = TRUE;
+	ab32_b_tech_best[TECH_INTEL_BLOCKED_NO_DC] = TRUE;
+	ab32_b_tech_best[TECH_AVX512_NO_DC] = TRUE;
 
 	ab32_b_tech_best_dc[TECH_COMB] = TRUE;
 	ab32_b_tech_best_dc[TECH_CRC_INTERMEDIATE_COMB] = TRUE;
@@ -864,7 +1631,7 @@ static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_ti
 				if (isdigit(*pstr_arg_size))
 				{
 					ui32_matrix_size = (uint32_t)strtoul(pstr_arg_size, NULL, 10u);
-					for (e_size_idx = eSIZE_MIN; e_size_idx <= eSIZE_MAX; e_size_idx++)
+					for (e_size_idx = eSIZE_MIN; e_size_idx < eSIZE_MAX; e_size_idx++)
 					{
 						if (kaui32_matrix_size[e_size_idx] == ui32_matrix_size)
 						{
@@ -901,6 +1668,137 @@ static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_ti
 				;
 			}
 
+			if (strcmp(pstr_arg, "-fma=off") == 0)
+			{
+				e_fma = e_FMA_OFF;
+			}
+			else if (strcmp(pstr_arg, "-fma=on") == 0)
+			{
+				e_fma = e_FMA_ON;
+			}
+			else if (strcmp(pstr_arg, "-fma=auto") == 0)
+			{
+				e_fma = e_FMA_AUTO;
+			}
+			else
+			{
+				;
+			}
+
+			pstr_arg_threads = strstr(pstr_arg, "-threads=");
+			if ((pstr_arg_threads != NULL) && isdigit(pstr_arg_threads[9u]))
+			{
+				ui32_threads = (uint32_t)strtoul(&pstr_arg_threads[9u], NULL, 10u);
+			}
+
+			if (strcmp(pstr_arg, "-fi=full") == 0)
+			{
+				e_fi = e_FI_EXEC_FULL;
+			}
+			else if (strcmp(pstr_arg, "-fi=delta") == 0)
+			{
+				e_fi = e_FI_EXEC_DELTA;
+			}
+			else if (strcmp(pstr_arg, "-fi=check") == 0)
+			{
+				e_fi = e_FI_EXEC_CHECK;
+			}
+			else
+			{
+				;
+			}
+
+			if (strcmp(pstr_arg, "-timer=mono") == 0)
+			{
+				e_tmr = e_TIMER_MONO;
+			}
+			else if (strcmp(pstr_arg, "-timer=tsc") == 0)
+			{
+				e_tmr = e_TIMER_TSC;
+			}
+			else
+			{
+				;
+			}
+
+			/* -shape=MxNxK[,MxNxK...] and -shapes=file add shapes to the list, in order */
+			if (strncmp(pstr_arg, "-shape=", 7u) == 0)
+			{
+				for (pstr_item = &pstr_arg[7u]; *pstr_item != '\0'; pstr_item += (pstr_item[size_item] == ',') ? (size_item + 1u) : size_item)
+				{
+					size_item = strcspn(pstr_item, ",");
+					snprintf(str_shape, sizeof(str_shape), "%.*s", (int)size_item, pstr_item);
+					if (ui32_shapes >= SHAPES_MAX)
+					{
+						printf("\n ---> More than %u shapes, '%s' ignored", SHAPES_MAX, str_shape);
+					}
+					else if (shape_parse(str_shape, &past_shapes[ui32_shapes]))
+					{
+						ui32_shapes++;
+					}
+					else
+					{
+						printf("\n ---> Invalid shape '%s' (MxNxK, N >= %u), ignored", str_shape, SHAPE_N_MIN);
+					}
+				}
+			}
+			else if (strncmp(pstr_arg, "-shapes=", 8u) == 0)
+			{
+				ui32_shapes = shapes_load(&pstr_arg[8u], past_shapes, ui32_shapes);
+			}
+			else if (strcmp(pstr_arg, "-layers") == 0)
+			{
+				b32_layers = TRUE;
+			}
+			else if (strncmp(pstr_arg, "-calls=", 7u) == 0)
+			{
+				ui32_calls = (uint32_t)strtoul(&pstr_arg[7u], NULL, 10u);
+				ui32_calls = (ui32_calls > 0u) ? ui32_calls : 1u;
+			}
+			else if (strncmp(pstr_arg, "-seed=", 6u) == 0)
+			{
+				ui64_seed = (uint64_t)strtoull(&pstr_arg[6u], NULL, 0);
+			}
+			else
+			{
+				;
+			}
+
+			if (strcmp(pstr_arg, "-perf") == 0)
+			{
+				b32_perf = TRUE;
+			}
+			else if (strncmp(pstr_arg, "-perf_fp=", 9u) == 0)
+			{
+				b32_perf = TRUE;
+				ui64_perf_fp = (uint64_t)strtoull(&pstr_arg[9u], NULL, 0);
+			}
+			else
+			{
+				;
+			}
+
+			if (strcmp(pstr_arg, "-isa=base") == 0)
+			{
+				ui32_isa_mask = e_ISA_NONE;
+			}
+			else if (strcmp(pstr_arg, "-isa=sse4.2") == 0)
+			{
+				ui32_isa_mask = e_ISA_SSE42 | e_ISA_PCLMUL;
+			}
+			else if (strcmp(pstr_arg, "-isa=avx2") == 0)
+			{
+				ui32_isa_mask = e_ISA_SSE42 | e_ISA_PCLMUL | e_ISA_AVX | e_ISA_AVX2 | e_ISA_FMA;
+			}
+			else if ((strcmp(pstr_arg, "-isa=avx512") == 0) || (strcmp(pstr_arg, "-isa=auto") == 0))
+			{
+				ui32_isa_mask = e_ISA_ALL;
+			}
+			else
+			{
+				;
+			}
+
 			if (strcmp(argv[ui32_idx], "-h") == 0)
 			{
 				b32_help = TRUE;
@@ -924,6 +1822,32 @@ static e_enum_size_2d process_args(int32_t argc, char *argv[], bool32_t *pb32_ti
 	*pb32_time_exp = b32_time_exp;
 	*pb32_dc_exp = b32_dc_exp;
 	*pb32_ut_exp = b32_ut_exp;
+	*pe_fma_mode = e_fma;
+	*pui32_isa_mask = ui32_isa_mask;
+	*pui32_threads = ui32_threads;
+	*pe_fi_exec = e_fi;
+	*pe_timer = e_tmr;
+	*pb32_perf = b32_perf;
+	*pui64_perf_fp = ui64_perf_fp;
+	/* -layers replaces the shapes of -shape / -shapes by the layers of the DNN, with less calls by default */
+	if (b32_layers)
+	{
+		if (ui32_shapes > 0u)
+		{
+			printf("\n ---> -layers given, the shapes of -shape / -shapes are ignored");
+		}
+		memcpy(past_shapes, &kast_dnn_layers[0u], sizeof(kast_dnn_layers));
+		ui32_shapes = DNN_LAYERS;
+	}
+	if (ui32_calls == 0u)
+	{
+		ui32_calls = b32_layers ? DNN_LAYERS_CALLS : (MEASUREMENT_LOOPS * TIME_MEASUREMENT_LOOPS);
+	}
+
+	*pui32_shapes = ui32_shapes;
+	*pui32_calls = ui32_calls;
+	*pb32_layers = b32_layers;
+	*pui64_seed = ui64_seed;
 
 	return e_size;
 }
@@ -936,12 +1860,148 @@ static void_t print_help_commands(const char *pstr_exec_name)
 	printf("\n\t -dc \t Execute Diagnostic Coverage (DC) measurement experiments");
 	printf("\n\t -s=size \t Maximum size of images. Size can be one of those values: 20, 40, 80, 160, 320, 640");
 	printf("\n\t -f=selection \t Filter techniques to the given selection: all, best, best_dc, best_dc_time");
+	printf("\n\t -fma=mode \t Multiply-accumulate of the AVX kernels: auto (FMA if supported, default), on, off (MUL + ADD)");
+	printf("\n\t\t\t  FMA changes the rounding of C and therefore the execution signatures: use -fma=off to reproduce");
+	printf("\n\t\t\t  the signatures of machines without FMA");
+	printf("\n\t -isa=level \t Highest instruction set used by the techniques: auto (detected, default), avx512, avx2, sse4.2, base");
+	printf("\n\t\t\t  Techniques without an implementation for the selected level are skipped");
+	printf("\n\t -threads=N \t Execute the SIMD techniques on row shards of %u rows by N threads (OpenMP)", SMM_OMP_ROWS);
+	printf("\n\t\t\t  The signature states of the shards are merged exactly: the ES is the one of the serial kernel.");
+	printf("\n\t\t\t  Techniques without an exact merge (see readme) execute their serial kernel");
+	printf("\n\t -fi=mode \t Faulty MMMs of the single bit campaign: full (default), delta, check");
+	printf("\n\t\t\t  delta: a fault in A only executes again the row shard of its row, a fault in B the column slice");
+	printf("\n\t\t\t  of its column (same ES as full). Techniques without an exact merge (see readme): full execution");
+	printf("\n\t\t\t  check: delta and the full execution of -fi=full, the detected / undetected results are compared");
+	printf("\n\t -timer=clock \t Clock of the time measurements: mono (CLOCK_MONOTONIC_RAW, default), tsc (rdtscp, invariant TSC)");
+	printf("\n\t\t\t  Every call is timed: median, MAD, p95, p99, max and overhead vs INTEL_NO_DC in the time CSV file");
+	printf("\n\t -perf \t\t Read the hardware counters around each timed call (Linux perf_event_open): cycles, instructions,");
+	printf("\n\t\t\t  L1D and LLC misses, branch misses and SIMD FP instructions per call, and IPC, in the time CSV file");
+	printf("\n\t -perf_fp=raw \t -perf with the given raw event as SIMD FP counter (default: FP_ARITH_INST_RETIRED on Intel)");
+	printf("\n\t -shape=MxNxK \t Time measurements of the given GEMM shapes instead of the square sizes, e.g. -shape=32x29x144,18x900x1024");
+	printf("\n\t -shapes=file \t Shapes read from a file, one per line: \"M N K\", \"MxNxK\" or \"M=32 N=921600 K=27\" (# comments)");
+	printf("\n\t -layers \t Time measurements of the %u convolution layers of the DNN (GEMM shapes), with the time and GFLOP/s", DNN_LAYERS);
+	printf("\n\t\t\t  of each layer and of the whole network (sum of the layers) per technique");
+	printf("\n\t -calls=N \t Timed calls per technique and shape (default %u, %u with -layers)", MEASUREMENT_LOOPS * TIME_MEASUREMENT_LOOPS, DNN_LAYERS_CALLS);
+	printf("\n\t -seed=N \t Seed of the random numbers (matrices, random values of the faults), written in the time CSV file (default %llu)", (unsigned long long)RNG_SEED_DEFAULT);
 	printf("\n\t Note: No argument means all experiments");
 	printf("\n\t Example:");
 	printf("\n\t\t %s -t -s=320 -f=best_dc", pstr_exec_name);
 	printf("\n\t\t\t  Perform time measurements for all techniques that provide best DC (100%%) (the selection) with matrix size up to 320x320");
 }
 
+/******************************************************************************
+**				Name:    shape_parse
+******************************************************************************/
+/*!
+** @brief  Parse a GEMM shape: "M=32 N=921600 K=27" (any order),
+**         or the first three numbers of the text in M, N, K order ("32x921600x27", "32 921600 27", "32,921600,27")
+**
+** @param[in]  pstr_shape  Text of the shape
+** @param[out] pst_shape   Shape
+**
+** @return  bool32_t TRUE if the shape is valid (M, K >= 1, N >= SHAPE_N_MIN)
+**
+******************************************************************************/
+static bool32_t shape_parse(const char *pstr_shape, smm_shape_t* const pst_shape)
+{
+	static const char kastr_key[3u][3u] = { "M=", "N=", "K=" };
+	unsigned long aul_dim[3u] = { 0u, 0u, 0u };
+	const char *pstr = pstr_shape;
+	char *pstr_end;
+	uint32_t ui32_idx;
+
+	assert((pstr_shape != NULL) && (pst_shape != NULL));
+	if ((strstr(pstr_shape, "M=") != NULL) && (strstr(pstr_shape, "N=") != NULL) && (strstr(pstr_shape, "K=") != NULL))
+	{
+		for (ui32_idx = 0u; ui32_idx < 3u; ui32_idx++)
+		{
+			aul_dim[ui32_idx] = strtoul(&strstr(pstr_shape, kastr_key[ui32_idx])[2u], NULL, 10u);
+		}
+	}
+	else
+	{
+		for (ui32_idx = 0u; ui32_idx < 3u; ui32_idx++)
+		{
+			while ((*pstr != '\0') && !isdigit((unsigned char)*pstr))
+			{
+				pstr++;
+			}
+			aul_dim[ui32_idx] = strtoul(pstr, &pstr_end, 10u);
+			if (pstr_end == pstr)
+			{
+				return FALSE;
+			}
+			pstr = pstr_end;
+		}
+	}
+	if ((aul_dim[0u] == 0u) || (aul_dim[1u] < SHAPE_N_MIN) || (aul_dim[2u] == 0u) ||
+		(aul_dim[0u] > UINT32_MAX) || (aul_dim[1u] > UINT32_MAX) || (aul_dim[2u] > UINT32_MAX))
+	{
+		return FALSE;
+	}
+	pst_shape->ui32_m = (uint32_t)aul_dim[0u];
+	pst_shape->ui32_n = (uint32_t)aul_dim[1u];
+	pst_shape->ui32_k = (uint32_t)aul_dim[2u];
+
+	return TRUE;
+}
+
+/******************************************************************************
+**				Name:    shapes_load
+******************************************************************************/
+/*!
+** @brief  Append the shapes of a file (-shapes=file) to the list: one shape per line (see shape_parse), empty
+**         lines and lines starting with '#' are skipped
+**
+** @param[in]     pstr_file    Name of the file
+** @param[in,out] past_shapes  Shapes (SHAPES_MAX)
+** @param[in]     ui32_shapes  Shapes already in the list
+**
+** @return  uint32_t Shapes in the list
+**
+******************************************************************************/
+static uint32_t shapes_load(const char *pstr_file, smm_shape_t* const past_shapes, uint32_t ui32_shapes)
+{
+	FILE *p_file;
+	char str_line[256u];
+	const char *pstr;
+	uint32_t ui32_line = 0u;
+
+	if ((p_file = fopen(pstr_file, "r")) == NULL)
+	{
+		printf("\n ---> Cannot open the shape file '%s'", pstr_file);
+		return ui32_shapes;
+	}
+	while (fgets(str_line, sizeof(str_line), p_file) != NULL)
+	{
+		ui32_line++;
+		for (pstr = str_line; isspace((unsigned char)*pstr); pstr++)
+		{
+			;
+		}
+		if ((*pstr == '\0') || (*pstr == '#'))
+		{
+			continue;
+		}
+		if (ui32_shapes >= SHAPES_MAX)
+		{
+			printf("\n ---> More than %u shapes, '%s' line %u and next ones ignored", SHAPES_MAX, pstr_file, ui32_line);
+			break;
+		}
+		if (shape_parse(pstr, &past_shapes[ui32_shapes]))
+		{
+			ui32_shapes++;
+		}
+		else
+		{
+			printf("\n ---> Invalid shape in '%s' line %u (M N K, N >= %u), ignored", pstr_file, ui32_line, SHAPE_N_MIN);
+		}
+	}
+	fclose(p_file);
+
+	return ui32_shapes;
+}
+
 /******************************************************************************
 **				Name:    execute_unit_test
 ******************************************************************************/
@@ -954,6 +2014,14 @@ static void_t print_help_commands(const char *pstr_exec_name)
 ** @param[in,out] paf32_mc  Pointer to matrix C used in the unit tests
 ** @param[in,out] paf32_mc  Pointer to matrix C used as reference in the unit tests
 **
+** @note   The golden implementation uses the same multiply-accumulate as the kernels (smm_no_dc_fma when
+**         FMA is selected for the SIMD kernels, smm_no_dc for the portable C ones), so the comparison stays
+**         bit-exact in both modes. The multi-threaded techniques (PAR_*) must also return the execution signature
+**         of their serial technique for shapes with partial shards and for several numbers of threads, and the
+**         SIMD techniques with an exact shard merge the execution signature and C of their serial kernel with threads
+**         (row shards of smm_execute). The delta re-executions of the single bit campaign (smm_fi_delta_a / _b)
+**         must return the execution signature of the full faulty MMM.
+**
 ** @return  bool32_t Unit test execution results
 ** @retval  true  OK
 ** @retval  false FAIL
@@ -961,11 +2029,44 @@ static void_t print_help_commands(const char *pstr_exec_name)
 ******************************************************************************/
 static bool32_t execute_unit_test(bool32_t ab32_selected_tech[TECH_MAX], float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc, float32_t* const paf32_mc_ref)
 {
+	/* Multi-threaded techniques and their serial technique */
+	static const e_enum_technique kae_par_tech[][2u] =
+	{
+		{ TECH_PAR_CRC_INTERNAL, TECH_CRC_INTERNAL },
+		{ TECH_PAR_INTEL_CRC_INTERNAL, TECH_INTEL_CRC_INTERNAL }
+	};
+	/* M x N x K: one partial shard, full and partial shards, several shards */
+	static const uint32_t kaui32_par_shape[][3u] = { { 1u, 1u, 1u }, { 31u, 5u, 3u }, { 33u, 17u, 9u }, { 97u, 40u, 23u }, { 200u, 64u, 48u } };
+	/* M x N x K of the row shards (N >= 8 as the kernels): one partial shard, full and partial shards, N % 8 and
+	   N % 16 tails of the AVX2 / AVX-512 kernels */
+	static const uint32_t kaui32_shard_shape[][3u] = { { 1u, 8u, 1u }, { 31u, 9u, 3u }, { 33u, 17u, 9u }, { 97u, 40u, 23u }, { 200u, 64u, 48u }, { 50u, 150u, 300u }, { 70u, 37u, 19u }, { 65u, 100u, 13u } };
+	static const uint32_t kaui32_par_threads[] = { 1u, 2u, 3u, 7u };
+	/* Single bit faults of the delta re-execution: first, middle and last element, bits of the mantissa, exponent and sign */
+	static const uint32_t kaui32_fi_bit[] = { 0u, 23u, 31u };
+	const uint32_t ui32_threads_user = ui32_omp_threads;
+	smm_fi_golden_t st_golden;
+	smm_fi_scratch_t st_scratch;
+	float32_t *paf32_mc_in,
+		*paf32_ma_fi,
+		*paf32_mb_fi;
+	uint32_t ui32_fi,
+		ui32_bit,
+		ui32_elem,
+		ui32_es_delta;
 	bool32_t b_result = TRUE,
-		b32_cmp;
-	uint32_t ui32_idx;
+		b32_cmp,
+		b32_ref_fma;
+	uint32_t ui32_idx,
+		ui32_shape,
+		ui32_thr,
+		ui32_es_serial,
+		ui32_es_par,
+		ui32_m,
+		ui32_n,
+		ui32_k;
 	e_enum_technique e_tech;
 	int32_t i32_ret;
+	uint32_t(*ptr_fn_golden)(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc) = b32_use_fma ? smm_no_dc_fma : smm_no_dc;
 
 	/* 1. Check input parameters */
 	assert(paf32_ma != NULL);
@@ -983,7 +2084,7 @@ static bool32_t execute_unit_test(bool32_t ab32_selected_tech[TECH_MAX], float32
 		paf32_mc[ui32_idx] = 0.0f;
 		paf32_mc_ref[ui32_idx] = 0.0f;
 	}
-	smm_no_dc(MAX_DIM, MAX_DIM, MAX_DIM, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc_ref[0]);
+	ptr_fn_golden(MAX_DIM, MAX_DIM, MAX_DIM, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc_ref[0]);
 #else
 	for (ui32_idx = 0u; ui32_idx < (M * K); ui32_idx++)
 	{
@@ -1001,47 +2102,262 @@ static bool32_t execute_unit_test(bool32_t ab32_selected_tech[TECH_MAX], float32
 		paf32_mc_ref[ui32_idx] = 0.0f;
 	}
 
-	smm_no_dc(M, N, K, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc_ref[0]);
+	ptr_fn_golden(M, N, K, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc_ref[0]);
 #endif
 
 
 
 
 	/* 3. Execute unit tests */   // TECH_MAX TECH_INTEL_COMB
+	b32_ref_fma = b32_use_fma;
 	for (e_tech = TECH_INTEL_NO_DC; e_tech < TECH_INTEL_COMB; e_tech++)
 	{
 		if (ab32_selected_tech[e_tech])
 		{
+			/* Portable C kernels (no SIMD implementation) multiply and add */
+			if (b32_ref_fma != (b32_use_fma && (apst_tech_impl[e_tech] != NULL)))
+			{
+				b32_ref_fma = !b32_ref_fma;
+				ptr_fn_golden = b32_ref_fma ? smm_no_dc_fma : smm_no_dc;
+#ifdef Square_mtrx
+				matrix2zeros(&paf32_mc_ref[0], MAX_DIM, MAX_DIM);
+				ptr_fn_golden(MAX_DIM, MAX_DIM, MAX_DIM, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc_ref[0]);
+#else
+				matrix2zeros(&paf32_mc_ref[0], M, N);
+				ptr_fn_golden(M, N, K, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc_ref[0]);
+#endif
+			}
 #ifdef Square_mtrx
 			matrix2zeros(&paf32_mc[0], MAX_DIM, MAX_DIM);
-			ptr_fn_smm_technique[e_tech](MAX_DIM, MAX_DIM, MAX_DIM, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc[0]);
+			smm_execute(e_tech, MAX_DIM, MAX_DIM, MAX_DIM, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc[0]);
 			i32_ret = memcmp((const void_t*)paf32_mc_ref, (const void_t*)paf32_mc, (size_t)(MAX_DIM * MAX_DIM * sizeof(float32_t)));
 #else
 			matrix2zeros(&paf32_mc[0], M, N);
-			ptr_fn_smm_technique[e_tech](M, N, K, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc[0]);
+			smm_execute(e_tech, M, N, K, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc[0]);
 			i32_ret = memcmp((const void_t*)paf32_mc_ref, (const void_t*)paf32_mc, (size_t)(M * N * sizeof(float32_t)));
 #endif
 			b32_cmp = (i32_ret == 0);
+			b_result = b_result && b32_cmp;
 			printf("\n\t Unit Test %2u / %2u (%25s): %4s", (e_tech + 1u), (TECH_MAX + 1u), pstr_technique[e_tech], b32_cmp ? "OK" : "FAIL");
 		}
 	}
 
+	/* 4. Multi-threaded techniques: same execution signature and C as the serial technique */
+	for (ui32_idx = 0u; ui32_idx < (sizeof(kae_par_tech) / sizeof(kae_par_tech[0u])); ui32_idx++)
+	{
+		e_tech = kae_par_tech[ui32_idx][0u];
+		if (ab32_selected_tech[e_tech] && (ptr_fn_smm_technique[kae_par_tech[ui32_idx][1u]] != NULL))
+		{
+			b32_cmp = TRUE;
+			for (ui32_shape = 0u; ui32_shape < (sizeof(kaui32_par_shape) / sizeof(kaui32_par_shape[0u])); ui32_shape++)
+			{
+				ui32_m = kaui32_par_shape[ui32_shape][0u];
+				ui32_n = kaui32_par_shape[ui32_shape][1u];
+				ui32_k = kaui32_par_shape[ui32_shape][2u];
+				matrix2zeros(&paf32_mc_ref[0], ui32_m, ui32_n);
+				ui32_es_serial = ptr_fn_smm_technique[kae_par_tech[ui32_idx][1u]](ui32_m, ui32_n, ui32_k, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc_ref[0]);
+				for (ui32_thr = 0u; ui32_thr < (sizeof(kaui32_par_threads) / sizeof(kaui32_par_threads[0u])); ui32_thr++)
+				{
+					ui32_omp_threads = kaui32_par_threads[ui32_thr];
+					matrix2zeros(&paf32_mc[0], ui32_m, ui32_n);
+					ui32_es_par = smm_execute(e_tech, ui32_m, ui32_n, ui32_k, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc[0]);
+					i32_ret = memcmp((const void_t*)paf32_mc_ref, (const void_t*)paf32_mc, (size_t)(ui32_m * ui32_n * sizeof(float32_t)));
+					if ((ui32_es_par != ui32_es_serial) || (i32_ret != 0))
+					{
+						printf("\n ---> %s: execution signature 0x%08X instead of 0x%08X (%ux%ux%u, %u threads)", pstr_technique[e_tech],
+							ui32_es_par, ui32_es_serial, ui32_m, ui32_n, ui32_k, ui32_omp_threads);
+						b32_cmp = FALSE;
+					}
+				}
+			}
+			ui32_omp_threads = ui32_threads_user;
+			b_result = b_result && b32_cmp;
+			printf("\n\t Unit Test ES    (%25s == %s): %4s", pstr_technique[e_tech], pstr_technique[kae_par_tech[ui32_idx][1u]], b32_cmp ? "OK" : "FAIL");
+		}
+	}
+
+	/* 5. SIMD techniques with an exact shard merge: same execution signature and C as the serial kernel with threads */
+	for (e_tech = TECH_INTEL_NO_DC; e_tech < TECH_MAX; e_tech++)
+	{
+		if (ab32_selected_tech[e_tech] && smm_fi_delta_supported(e_tech))
+		{
+			b32_cmp = TRUE;
+			for (ui32_shape = 0u; ui32_shape < (sizeof(kaui32_shard_shape) / sizeof(kaui32_shard_shape[0u])); ui32_shape++)
+			{
+				ui32_m = kaui32_shard_shape[ui32_shape][0u];
+				ui32_n = kaui32_shard_shape[ui32_shape][1u];
+				ui32_k = kaui32_shard_shape[ui32_shape][2u];
+				matrix2zeros(&paf32_mc_ref[0], ui32_m, ui32_n);
+				ui32_es_serial = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc_ref[0]);
+				for (ui32_thr = 0u; ui32_thr < (sizeof(kaui32_par_threads) / sizeof(kaui32_par_threads[0u])); ui32_thr++)
+				{
+					ui32_omp_threads = kaui32_par_threads[ui32_thr];
+					matrix2zeros(&paf32_mc[0], ui32_m, ui32_n);
+					ui32_es_par = smm_execute(e_tech, ui32_m, ui32_n, ui32_k, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc[0]);
+					i32_ret = memcmp((const void_t*)paf32_mc_ref, (const void_t*)paf32_mc, (size_t)(ui32_m * ui32_n * sizeof(float32_t)));
+					if ((ui32_es_par != ui32_es_serial) || (i32_ret != 0))
+					{
+						printf("\n ---> %s: execution signature 0x%08X instead of 0x%08X (%ux%ux%u, %u threads)", pstr_technique[e_tech],
+							ui32_es_par, ui32_es_serial, ui32_m, ui32_n, ui32_k, ui32_omp_threads);
+						b32_cmp = FALSE;
+					}
+				}
+			}
+			ui32_omp_threads = ui32_threads_user;
+			b_result = b_result && b32_cmp;
+			printf("\n\t Unit Test ES    (%25s kernel == shards): %4s", pstr_technique[e_tech], b32_cmp ? "OK" : "FAIL");
+		}
+	}
+
+	/* 6. Delta re-execution of the campaigns: same execution signature as the full faulty MMM, for one fault
+	      (first, middle, last element) and for two faults (first and last element: two row shards / column slices) */
+	for (e_tech = TECH_INTEL_NO_DC; e_tech < TECH_MAX; e_tech++)
+	{
+		if (ab32_selected_tech[e_tech] && (apst_tech_impl[e_tech] != NULL) && (smm_fi_delta_supported(e_tech) || (apst_tech_impl[e_tech]->e_col_merge != e_SHARD_MERGE_SERIAL)))
+		{
+			b32_cmp = TRUE;
+			for (ui32_shape = 0u; ui32_shape < (sizeof(kaui32_shard_shape) / sizeof(kaui32_shard_shape[0u])); ui32_shape++)
+			{
+				ui32_m = kaui32_shard_shape[ui32_shape][0u];
+				ui32_n = kaui32_shard_shape[ui32_shape][1u];
+				ui32_k = kaui32_shard_shape[ui32_shape][2u];
+				st_golden.past_shard = (smm_shard_sig_t*)malloc(((ui32_m + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS) * sizeof(smm_shard_sig_t));
+				st_golden.past_prefix = (smm_shard_sig_t*)malloc(((ui32_m + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS) * sizeof(smm_shard_sig_t));
+				st_golden.past_suffix = (smm_shard_sig_t*)malloc(((ui32_m + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS) * sizeof(smm_shard_sig_t));
+				st_golden.paui32_slice = (uint32_t*)malloc(((ui32_n / 8u) + 1u) * sizeof(uint32_t));
+				paf32_mc_in = (float32_t*)malloc((size_t)ui32_m * ui32_n * sizeof(float32_t));
+				paf32_ma_fi = (float32_t*)malloc((size_t)ui32_m * ui32_k * sizeof(float32_t));
+				paf32_mb_fi = (float32_t*)malloc((size_t)ui32_k * ui32_n * sizeof(float32_t));
+				ui32_elem = (ui32_m > ui32_n) ? ui32_m : ui32_n;
+				ui32_elem = (ui32_elem > ui32_k) ? ui32_elem : ui32_k;
+				st_scratch.paf32_mb_part = (float32_t*)malloc((size_t)SMM_OMP_ROWS * ui32_elem * sizeof(float32_t));
+				st_scratch.paf32_mc_part = (float32_t*)malloc((size_t)SMM_OMP_ROWS * ui32_elem * sizeof(float32_t));
+				assert((st_golden.past_shard != NULL) && (st_golden.past_prefix != NULL) && (st_golden.past_suffix != NULL) && (st_golden.paui32_slice != NULL) &&
+					(paf32_mc_in != NULL) && (paf32_ma_fi != NULL) && (paf32_mb_fi != NULL) && (st_scratch.paf32_mb_part != NULL) && (st_scratch.paf32_mc_part != NULL));
+
+				matrix2zeros(&paf32_mc[0], ui32_m, ui32_n);
+				(void_t)smm_fi_golden(e_tech, ui32_m, ui32_n, ui32_k, 1.0f, &paf32_ma[0], &paf32_mb[0], &paf32_mc[0], paf32_mc_in, &st_golden, &st_scratch);
+				for (ui32_fi = 0u; ui32_fi < 4u; ui32_fi++)
+				{
+					for (ui32_bit = 0u; ui32_bit < (sizeof(kaui32_fi_bit) / sizeof(kaui32_fi_bit[0u])); ui32_bit++)
+					{
+						if (st_golden.ui32_n_shards > 0u)
+						{
+							ui32_elem = (((ui32_fi < 2u) ? ui32_fi : 2u) * ((ui32_m * ui32_k) - 1u)) / 2u;
+							memcpy(paf32_ma_fi, &paf32_ma[0], (size_t)ui32_m * ui32_k * sizeof(float32_t));
+							mem_fi(paf32_ma_fi, (ui32_elem * sizeof(float32_t) * CHAR_BIT) + kaui32_fi_bit[ui32_bit]);
+							if (ui32_fi == 3u)
+							{
+								mem_fi(paf32_ma_fi, kaui32_fi_bit[ui32_bit]);
+							}
+							ui32_es_delta = smm_fi_delta_a(e_tech, ui32_m, ui32_n, ui32_k, 1.0f, &paf32_ma[0], paf32_ma_fi, &paf32_mb[0], paf32_mc_in, &st_golden, &st_scratch);
+							memcpy(&paf32_mc_ref[0], paf32_mc_in, (size_t)ui32_m * ui32_n * sizeof(float32_t));
+							ui32_es_serial = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, 1.0f, paf32_ma_fi, &paf32_mb[0], &paf32_mc_ref[0]);
+							if (ui32_es_delta != ui32_es_serial)
+							{
+								printf("\n ---> %s: delta of A[%u][%u]%s bit %u 0x%08X instead of 0x%08X (%ux%ux%u)", pstr_technique[e_tech],
+									ui32_elem / ui32_k, ui32_elem % ui32_k, (ui32_fi == 3u) ? " and A[0][0]" : "", kaui32_fi_bit[ui32_bit], ui32_es_delta, ui32_es_serial, ui32_m, ui32_n, ui32_k);
+								b32_cmp = FALSE;
+							}
+						}
+						if (st_golden.ui32_n_slices > 0u)
+						{
+							ui32_elem = (((ui32_fi < 2u) ? ui32_fi : 2u) * ((ui32_k * ui32_n) - 1u)) / 2u;
+							memcpy(paf32_mb_fi, &paf32_mb[0], (size_t)ui32_k * ui32_n * sizeof(float32_t));
+							mem_fi(paf32_mb_fi, (ui32_elem * sizeof(float32_t) * CHAR_BIT) + kaui32_fi_bit[ui32_bit]);
+							if (ui32_fi == 3u)
+							{
+								mem_fi(paf32_mb_fi, kaui32_fi_bit[ui32_bit]);
+							}
+							ui32_es_delta = smm_fi_delta_b(e_tech, ui32_m, ui32_n, ui32_k, 1.0f, &paf32_ma[0], &paf32_mb[0], paf32_mb_fi, paf32_mc_in, &st_golden, &st_scratch);
+							memcpy(&paf32_mc_ref[0], paf32_mc_in, (size_t)ui32_m * ui32_n * sizeof(float32_t));
+							ui32_es_serial = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, 1.0f, &paf32_ma[0], paf32_mb_fi, &paf32_mc_ref[0]);
+							if (ui32_es_delta != ui32_es_serial)
+							{
+								printf("\n ---> %s: delta of B[%u][%u]%s bit %u 0x%08X instead of 0x%08X (%ux%ux%u)", pstr_technique[e_tech],
+									ui32_elem / ui32_n, ui32_elem % ui32_n, (ui32_fi == 3u) ? " and B[0][0]" : "", kaui32_fi_bit[ui32_bit], ui32_es_delta, ui32_es_serial, ui32_m, ui32_n, ui32_k);
+								b32_cmp = FALSE;
+							}
+						}
+					}
+				}
+				free(st_golden.past_shard);
+				free(st_golden.past_prefix);
+				free(st_golden.past_suffix);
+				free(st_golden.paui32_slice);
+				free(paf32_mc_in);
+				free(paf32_ma_fi);
+				free(paf32_mb_fi);
+				free(st_scratch.paf32_mb_part);
+				free(st_scratch.paf32_mc_part);
+			}
+			b_result = b_result && b32_cmp;
+			printf("\n\t Unit Test ES    (%25s delta == full): %4s", pstr_technique[e_tech], b32_cmp ? "OK" : "FAIL");
+		}
+	}
+
 	return b_result;
 }
 
-static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_tech[TECH_MAX], float32_t* const paf32_ma, float32_t* const paf32_mb, float32_t* const paf32_mc)
+/******************************************************************************
+**				Name:    measure_time
+******************************************************************************/
+/*!
+** @brief  Time every selected technique on every shape: A and B random, C reset every TIME_MEASUREMENT_LOOPS
+**         calls, each call timed (and its hardware counters read with -perf). The buffers of a shape are
+**         allocated (MEM_ALIGN) before its techniques and freed after them. INTEL_NO_DC is the first technique
+**         of each shape and the reference of the overhead. The GFLOP/s count 2 x M x N x K operations per call.
+**         Roofline (roofline_measure before the shapes): the bytes moved are the compulsory traffic of the shape,
+**         4 x (M x K + K x N + 2 x M x N) (A and B read, C read and written); the roof of a technique is
+**         min(peak of its instruction set (roofline_isa), FLOP/byte x bandwidth) and it is memory bound when the
+**         bandwidth ceiling is the lower one. A shape that fits in the caches can exceed its memory roof (% of roof > 100).
+**         With several shapes, the sums of the medians of each technique (time of a pass of the network with
+**         -layers) are written at the end.
+**
+** @param[in] past_shapes         Shapes
+** @param[in] ui32_shapes         Number of shapes
+** @param[in] ui32_calls          Timed calls per technique and shape
+** @param[in] b32_layers          The shapes are the layers of the DNN (kast_dnn_layers)
+** @param[in] ab32_selected_tech  Techniques selected by the user
+**
+** @return  int32_t EXIT_SUCCESS, EXIT_FAILURE if the time file cannot be opened
+**
+******************************************************************************/
+static int32_t measure_time(const smm_shape_t* const past_shapes, uint32_t ui32_shapes, uint32_t ui32_calls, bool32_t b32_layers, bool32_t ab32_selected_tech[TECH_MAX])
 {
 	e_enum_technique e_tech;
-	uint32_t ui32_idx,
-		ui32_t_loop;
-	float32_t f32_alpha = 1.0f,
-		f32_time_min,
-		f32_time_max,
-		f32_time_avg;
-	float32_t af32_time_ref[eSIZE_MAX];
-	e_enum_size_2d e_size;
-	DEF_TIME_VAR(tmr_start);
-	DEF_TIME_VAR(tmr_end);
+	uint32_t ui32_shape,
+		ui32_call;
+	const smm_shape_t *pst_shape;
+	float32_t f32_alpha = 1.0f;
+	float32_t *paf32_ma,
+		*paf32_mb,
+		*paf32_mc;
+	float64_t f64_median_ref,
+		f64_ratio,
+		f64_gflops,
+		f64_flop,
+		f64_flop_total = 0.0,
+		f64_bytes,
+		f64_bytes_total = 0.0,
+		f64_roof,
+		*paf64_time;
+	roofline_t st_roof;
+	e_roof_isa e_roof;
+	bool32_t b32_memory_bound;
+	float64_t af64_total_min[TECH_MAX],
+		af64_total_median[TECH_MAX],
+		af64_roof_ns_total[TECH_MAX];
+	uint32_t ui32_shapes_timed = 0u;
+	bool32_t *pab32_skipped;
+	time_stats_t st_stats;
+	uint64_t ui64_tick_start,
+		ui64_tick_end;
+	perf_counts_t st_perf_start,
+		st_perf_end,
+		st_perf_sum;
+	float64_t af64_perf[e_PERF_MAX];
+	e_perf_event e_event;
 	DEF_TIME_VAR(tmr_start_exp);
 	DEF_TIME_VAR(tmr_end_exp);
 	float64_t time_interval;
@@ -1054,16 +2370,17 @@ static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_te
 	time_t time_now = time(NULL);
 #endif
 
-	/* 1. Initialize matrixes */
-#ifdef Square_mtrx
-	matrix2rand(&paf32_ma[0], MAX_DIM, MAX_DIM);
-	matrix2rand(&paf32_mb[0], MAX_DIM, MAX_DIM);
-	matrix2zeros(&paf32_mc[0], MAX_DIM, MAX_DIM);
-#else
-	matrix2rand(&paf32_ma[0], M, K);
-	matrix2rand(&paf32_mb[0], K, N);
-	matrix2zeros(&paf32_mc[0], M, N);
-#endif
+	/* 1. Ceilings of the roofline */
+	roofline_measure(&st_roof);
+	printf("\n\t Roofline (%s): bandwidth %.1f GB/s (triad)", b32_use_fma ? "FMA" : "MUL+ADD", st_roof.f64_bw_gbs);
+	for (e_roof = e_ROOF_SSE; e_roof < e_ROOF_MAX; e_roof++)
+	{
+		if (st_roof.af64_peak_gflops[e_roof] > 0.0)
+		{
+			printf(", peak %s %.1f GFLOP/s (ridge %.2f FLOP/byte)", kapstr_roof_isa[e_roof], st_roof.af64_peak_gflops[e_roof],
+				(st_roof.f64_bw_gbs > 0.0) ? (st_roof.af64_peak_gflops[e_roof] / st_roof.f64_bw_gbs) : 0.0);
+		}
+	}
 
 	/* 2. Open output file (csv) */
 #ifdef _WIN32
@@ -1081,7 +2398,14 @@ static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_te
 		perror("File opening failed");
 		return EXIT_FAILURE;
 	}
-	fprintf(p_file, "Technique, Size, Time");
+	fprintf(p_file, "Technique, M, N, K, Calls, Min, Median, MAD, P95, P99, Max, Overhead vs INTEL_NO_DC (usec, %s %.1f ns per read, %s, %u threads, seed %llu)",
+		(e_timer_src == e_TIMER_TSC) ? "rdtscp" : "monotonic clock", f64_timer_overhead_ns, b32_use_fma ? "FMA" : "MUL+ADD", ui32_omp_threads, (unsigned long long)ui64_rng_seed);
+	fprintf(p_file, ", GFLOP/s, Bytes, FLOP/byte, Roof GFLOP/s, %% of roof, Bound (peaks SSE %.1f / AVX2 %.1f / AVX-512 %.1f GFLOP/s, triad %.1f GB/s), Peak ISA",
+		st_roof.af64_peak_gflops[e_ROOF_SSE], st_roof.af64_peak_gflops[e_ROOF_AVX2], st_roof.af64_peak_gflops[e_ROOF_AVX512], st_roof.f64_bw_gbs);
+	if (ui32_perf_events > 0u)
+	{
+		fprintf(p_file, ", Cycles, Instructions, IPC, L1D misses, LLC misses, Branch misses, SIMD FP (per call)");
+	}
 #endif
 
 
@@ -1100,88 +2424,205 @@ static int32_t measure_time(e_enum_size_2d e_size_max, bool32_t ab32_selected_te
 		perror("File opening failed");
 		return EXIT_FAILURE;
 	}
-	fprintf(p_file, "Technique, Size, Time");
+	fprintf(p_file, "Technique, M, N, K, Calls, Min, Median, MAD, P95, P99, Max, Overhead vs INTEL_NO_DC (usec, %s %.1f ns per read, %s, %u threads, seed %llu)",
+		(e_timer_src == e_TIMER_TSC) ? "rdtscp" : "monotonic clock", f64_timer_overhead_ns, b32_use_fma ? "FMA" : "MUL+ADD", ui32_omp_threads, (unsigned long long)ui64_rng_seed);
+	fprintf(p_file, ", GFLOP/s, Bytes, FLOP/byte, Roof GFLOP/s, %% of roof, Bound (peaks SSE %.1f / AVX2 %.1f / AVX-512 %.1f GFLOP/s, triad %.1f GB/s), Peak ISA",
+		st_roof.af64_peak_gflops[e_ROOF_SSE], st_roof.af64_peak_gflops[e_ROOF_AVX2], st_roof.af64_peak_gflops[e_ROOF_AVX512], st_roof.f64_bw_gbs);
+	if (ui32_perf_events > 0u)
+	{
+		fprintf(p_file, ", Cycles, Instructions, IPC, L1D misses, LLC misses, Branch misses, SIMD FP (per call)");
+	}
 #endif
 
 
-	/* 3. Execute time measurement */
-	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
+	/* 3. Execute time measurement: every call is timed, INTEL_NO_DC (first technique) is the reference of the overhead */
+	paf64_time = (float64_t*)malloc(ui32_calls * sizeof(float64_t));
+	assert(paf64_time != NULL);
+	pab32_skipped = (bool32_t*)calloc(ui32_shapes, sizeof(bool32_t));
+	assert(pab32_skipped != NULL);
+	memset(&af64_total_min[0u], 0, sizeof(af64_total_min));
+	memset(&af64_total_median[0u], 0, sizeof(af64_total_median));
+	memset(&af64_roof_ns_total[0u], 0, sizeof(af64_roof_ns_total));
 	GET_TIME(tmr_start_exp);
-	for (e_tech = TECH_INTEL_NO_DC; e_tech < TECH_INTEL_COMB; e_tech++)
+	for (ui32_shape = 0u; ui32_shape < ui32_shapes; ui32_shape++)
 	{
-		if (ab32_selected_tech[e_tech] || (e_tech == TECH_NONE))
+		pst_shape = &past_shapes[ui32_shape];
+		printf("\n\t %s %2u / %2u: A=[%u x %u], B=[%u x %u]", b32_layers ? "Layer" : "Shape", (ui32_shape + 1u), ui32_shapes,
+			pst_shape->ui32_m, pst_shape->ui32_k, pst_shape->ui32_k, pst_shape->ui32_n);
+		f64_flop = 2.0 * (float64_t)pst_shape->ui32_m * (float64_t)pst_shape->ui32_n * (float64_t)pst_shape->ui32_k;
+		f64_bytes = (float64_t)sizeof(float32_t) * (((float64_t)pst_shape->ui32_m * (float64_t)pst_shape->ui32_k) +
+			((float64_t)pst_shape->ui32_k * (float64_t)pst_shape->ui32_n) + (2.0 * (float64_t)pst_shape->ui32_m * (float64_t)pst_shape->ui32_n));
+		printf(", %.2f FLOP/byte, memory roof %.1f GFLOP/s", f64_flop / f64_bytes, (f64_flop / f64_bytes) * st_roof.f64_bw_gbs);
+
+		/* 3.1 Buffers of the shape */
+		paf32_ma = (float32_t*)mem_alloc_aligned((size_t)pst_shape->ui32_m * pst_shape->ui32_k * sizeof(float32_t));
+		paf32_mb = (float32_t*)mem_alloc_aligned((size_t)pst_shape->ui32_k * pst_shape->ui32_n * sizeof(float32_t));
+		paf32_mc = (float32_t*)mem_alloc_aligned((size_t)pst_shape->ui32_m * pst_shape->ui32_n * sizeof(float32_t));
+		if ((paf32_ma == NULL) || (paf32_mb == NULL) || (paf32_mc == NULL))
+		{
+			printf("\n ---> Not enough memory for the shape, skipped");
+			pab32_skipped[ui32_shape] = TRUE;
+			mem_free_aligned(paf32_ma);
+			mem_free_aligned(paf32_mb);
+			mem_free_aligned(paf32_mc);
+			continue;
+		}
+		matrix2rand(&paf32_ma[0], pst_shape->ui32_m, pst_shape->ui32_k);
+		matrix2rand(&paf32_mb[0], pst_shape->ui32_k, pst_shape->ui32_n);
+		f64_flop_total += f64_flop;
+		f64_bytes_total += f64_bytes;
+		ui32_shapes_timed++;
+
+		/* 3.2 Techniques */
+		f64_median_ref = 0.0;
+		for (e_tech = TECH_INTEL_NO_DC; e_tech < TECH_INTEL_COMB; e_tech++)
 		{
-			printf("\n\t Experiment %2u / %2u (%25s):", (e_tech + 1u), (TECH_MAX + 1u), pstr_technique[e_tech]);
-			for (e_size = eSIZE_40_40; e_size <= e_size_max; e_size++)
+			if (ab32_selected_tech[e_tech] || ((e_tech == TECH_INTEL_NO_DC) && (ptr_fn_smm_technique[e_tech] != NULL)))
 			{
-#ifdef Square_mtrx
-				printf("\n\t\t [%3u x %3u],", kaui32_matrix_size[e_size], kaui32_matrix_size[e_size]);
-#else
-				printf("\n\t\t A=[%3u x %3u], B=[%3u x %3u],", M, K, K, N);
-#endif
-				f32_time_min = FLT_MAX;
-				f32_time_max = 0.0f;
-				f32_time_avg = 0.0f;
+				/* Roof of the technique: peak of its instruction set or bandwidth ceiling */
+				e_roof = roofline_isa(e_tech);
+				b32_memory_bound = ((st_roof.f64_bw_gbs > 0.0) && (((f64_flop / f64_bytes) * st_roof.f64_bw_gbs) < st_roof.af64_peak_gflops[e_roof])) ? TRUE : FALSE;
+				f64_roof = b32_memory_bound ? ((f64_flop / f64_bytes) * st_roof.f64_bw_gbs) : st_roof.af64_peak_gflops[e_roof];
+				af64_roof_ns_total[e_tech] += f64_flop / f64_roof;
+				printf("\n\t\t %25s:", pstr_technique[e_tech]);
 #if defined __linux__ || defined _WIN32
-				fprintf(p_file, "\n%s,%u,", pstr_technique[e_tech], kaui32_matrix_size[e_size]);
+				fprintf(p_file, "\n%s,%u,%u,%u,", pstr_technique[e_tech], pst_shape->ui32_m, pst_shape->ui32_n, pst_shape->ui32_k);
 #endif
-				for (ui32_idx = 0u; ui32_idx < MEASUREMENT_LOOPS; ui32_idx++)
+				matrix2zeros(&paf32_mc[0], pst_shape->ui32_m, pst_shape->ui32_n);
+				memset(&st_perf_sum, 0, sizeof(st_perf_sum));
+				for (ui32_call = 0u; ui32_call < ui32_calls; ui32_call++)
 				{
-					GET_TIME(tmr_start);
-					/* Gets the starting time in microseconds */
-    					//start_usec = PAPI_get_real_usec();
-					for (ui32_t_loop = 0u; ui32_t_loop < TIME_MEASUREMENT_LOOPS; ui32_t_loop++)
+					if (ui32_perf_events > 0u)
 					{
-#ifdef Square_mtrx
-						ptr_fn_smm_technique[e_tech](kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-#else
-						ptr_fn_smm_technique[e_tech](M, N, K, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-#endif
+						perf_read(&st_perf_start);
+					}
+					ui64_tick_start = timer_ticks();
+					smm_execute(e_tech, pst_shape->ui32_m, pst_shape->ui32_n, pst_shape->ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+					ui64_tick_end = timer_ticks();
+					if (ui32_perf_events > 0u)
+					{
+						perf_read(&st_perf_end);
+						for (e_event = e_PERF_CYCLES; e_event < e_PERF_MAX; e_event++)
+						{
+							st_perf_sum.aui64_count[e_event] += st_perf_end.aui64_count[e_event] - st_perf_start.aui64_count[e_event];
+						}
+						st_perf_sum.ui64_enabled += st_perf_end.ui64_enabled - st_perf_start.ui64_enabled;
+						st_perf_sum.ui64_running += st_perf_end.ui64_running - st_perf_start.ui64_running;
+					}
+					paf64_time[ui32_call] = ((float64_t)(ui64_tick_end - ui64_tick_start) * f64_timer_ns_per_tick) / (float64_t)TIME_USEC2NSEC;
+
+					/* The techniques accumulate in C */
+					if (((ui32_call + 1u) % TIME_MEASUREMENT_LOOPS) == 0u)
+					{
+						matrix2zeros(&paf32_mc[0], pst_shape->ui32_m, pst_shape->ui32_n);
 					}
-					GET_TIME(tmr_end);
-					/* Gets the ending time in clock cycles */
-    					//end_usec = PAPI_get_real_usec();
-					GET_TIME_DIFF(tmr_start, tmr_end, time_interval);
-					time_interval *= ((float64_t)TIME_SEC2USEC) / (float64_t)TIME_MEASUREMENT_LOOPS;
-					//printf("%15.4f,", time_interval);
-					//printf("%lld\n", end_usec - start_usec);
+				}
+				time_stats(paf64_time, ui32_calls, &st_stats);
+				if (e_tech == TECH_INTEL_NO_DC)
+				{
+					f64_median_ref = st_stats.f64_median;
+				}
+				f64_ratio = (f64_median_ref > 0.0) ? (st_stats.f64_median / f64_median_ref) : 0.0;
+				f64_gflops = (st_stats.f64_median > 0.0) ? (f64_flop / (st_stats.f64_median * (float64_t)TIME_USEC2NSEC)) : 0.0;
+				af64_total_min[e_tech] += st_stats.f64_min;
+				af64_total_median[e_tech] += st_stats.f64_median;
+				printf(" median = %12.3f, MAD = %10.3f, p95 = %12.3f, p99 = %12.3f, max = %12.3f [usec], overhead = x%5.2f, %7.2f GFLOP/s (%5.1f%% of %s roof, %s bound)",
+					st_stats.f64_median, st_stats.f64_mad, st_stats.f64_p95, st_stats.f64_p99, st_stats.f64_max, f64_ratio, f64_gflops,
+					(100.0 * f64_gflops) / f64_roof, kapstr_roof_isa[e_roof], b32_memory_bound ? "memory" : "compute");
 #if defined __linux__ || defined _WIN32
-					fprintf(p_file, "%15.4f,", time_interval);
-					//fprintf(p_file, "%lld,", end_usec - start_usec);
+				fprintf(p_file, "%u,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.4f,%.3f,%.0f,%.3f,%.3f,%.2f,%s,%s", st_stats.ui32_n, st_stats.f64_min, st_stats.f64_median,
+					st_stats.f64_mad, st_stats.f64_p95, st_stats.f64_p99, st_stats.f64_max, f64_ratio, f64_gflops,
+					f64_bytes, f64_flop / f64_bytes, f64_roof, (100.0 * f64_gflops) / f64_roof, b32_memory_bound ? "memory" : "compute", kapstr_roof_isa[e_roof]);
 #endif
-
-#ifdef Square_mtrx
-					matrix2zeros(&paf32_mc[0], MAX_DIM, MAX_DIM);
-#else
-					matrix2zeros(&paf32_mc[0], M, N);
+				/* Counts per call, scaled when the group was multiplexed with other events (running < enabled) */
+				if (ui32_perf_events > 0u)
+				{
+					for (e_event = e_PERF_CYCLES; e_event < e_PERF_MAX; e_event++)
+					{
+						af64_perf[e_event] = (st_perf_sum.ui64_running > 0u) ? (((float64_t)st_perf_sum.aui64_count[e_event] * (float64_t)st_perf_sum.ui64_enabled) / ((float64_t)st_perf_sum.ui64_running * (float64_t)ui32_calls)) : 0.0;
+					}
+					printf("\n\t\t\t IPC = %5.2f,", (af64_perf[e_PERF_CYCLES] > 0.0) ? (af64_perf[e_PERF_INSTRUCTIONS] / af64_perf[e_PERF_CYCLES]) : 0.0);
+					for (e_event = e_PERF_CYCLES; e_event < e_PERF_MAX; e_event++)
+					{
+						if (ai32_perf_fd[e_event] >= 0)
+						{
+							printf(" %s = %.0f,", kapstr_perf_event[e_event], af64_perf[e_event]);
+						}
+#if defined __linux__ || defined _WIN32
+						if (ai32_perf_fd[e_event] >= 0)
+						{
+							fprintf(p_file, ",%.1f", af64_perf[e_event]);
+						}
+						else
+						{
+							fprintf(p_file, ",");
+						}
+						if (e_event == e_PERF_INSTRUCTIONS)
+						{
+							fprintf(p_file, ",%.3f", (af64_perf[e_PERF_CYCLES] > 0.0) ? (af64_perf[e_PERF_INSTRUCTIONS] / af64_perf[e_PERF_CYCLES]) : 0.0);
+						}
 #endif
-					// The min, max and average values will be evaluated in excel instead of in the Zynq.
-					//f32_time_min = ((float32_t)time_interval < f32_time_min) ? (float32_t)time_interval : f32_time_min;
-					//f32_time_max = ((float32_t)time_interval > f32_time_max) ? (float32_t)time_interval : f32_time_max;
-					//f32_time_avg += (float32_t)time_interval;
+					}
+					if (st_perf_sum.ui64_running < st_perf_sum.ui64_enabled)
+					{
+						printf(" (counted %.0f%% of the time)", (100.0 * (float64_t)st_perf_sum.ui64_running) / (float64_t)st_perf_sum.ui64_enabled);
+					}
 				}
-				f32_time_avg /= (float_t)MEASUREMENT_LOOPS;
-				if (e_tech == TECH_NONE)
+			}
+			else
+			{
+				//printf(" -> Skipped, not selected in techniques filter");
+			}
+		}
+		mem_free_aligned(paf32_ma);
+		mem_free_aligned(paf32_mb);
+		mem_free_aligned(paf32_mc);
+	}
+	free(paf64_time);
+
+	/* 4. Totals of the shapes (pass of the network with -layers): sums of the min and median times, the shapes skipped
+	 *    for lack of memory are not counted. Rows "Total" of the time file, without the statistics that do not add up.
+	 *    The roof of the total is the one of the sum of the times at the roof of each shape. When shapes were skipped the
+	 *    total is not the one of the network: it is printed as partial with the skipped shapes, rows "Partial total" */
+	if ((ui32_shapes_timed > 1u) || ((ui32_shapes_timed > 0u) && (ui32_shapes_timed < ui32_shapes)))
+	{
+		printf("\n\t %s%s (%u / %u %s", (ui32_shapes_timed < ui32_shapes) ? "Partial " : "", b32_layers ? "Network" : "Total",
+			ui32_shapes_timed, ui32_shapes, b32_layers ? "layers" : "shapes");
+		if (ui32_shapes_timed < ui32_shapes)
+		{
+			printf(", skipped:");
+			for (ui32_shape = 0u; ui32_shape < ui32_shapes; ui32_shape++)
+			{
+				if (pab32_skipped[ui32_shape])
 				{
-					af32_time_ref[e_size] = f32_time_avg;
+					printf(" %u (%ux%ux%u)", (ui32_shape + 1u), past_shapes[ui32_shape].ui32_m, past_shapes[ui32_shape].ui32_n, past_shapes[ui32_shape].ui32_k);
 				}
-				//printf("\n\t\t [%3u x %3u] min = %15.1f [usec], max = %15.1f [usec], avg = %15.1f [usec], ratio_avg = x%5.2f", kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], f32_time_min, f32_time_max, f32_time_avg, (af32_time_ref[e_size] > 0.0f) ? (f32_time_avg / af32_time_ref[e_size]) : 0.0f);
-				//printf("=PROMEDIO(B%u:K%u),",e_tech+e_size+25+e_tech*e_size,e_tech+e_size+25+e_tech*e_size);
-				//printf("=DESVEST.M(B%u:K%u),",e_tech+e_size+25+e_tech*e_size,e_tech+e_size+25+e_tech*e_size);
-				//printf("=MAX(B%u:K%u),",e_tech+e_size+25+e_tech*e_size,e_tech+e_size+25+e_tech*e_size);
-				//printf("=MIN(B%u:K%u),",e_tech+e_size+25+e_tech*e_size,e_tech+e_size+25+e_tech*e_size);
-				//printf("%u,",(af32_time_ref[e_size] > 0.0f) ? (f32_time_avg / af32_time_ref[e_size]) : 0.0f);
 			}
 		}
-		else
+		printf("):");
+		for (e_tech = TECH_INTEL_NO_DC; e_tech < TECH_INTEL_COMB; e_tech++)
 		{
-			//printf(" -> Skipped, not selected in techniques filter");
+			if (af64_total_median[e_tech] > 0.0)
+			{
+				f64_ratio = (af64_total_median[TECH_INTEL_NO_DC] > 0.0) ? (af64_total_median[e_tech] / af64_total_median[TECH_INTEL_NO_DC]) : 0.0;
+				f64_gflops = f64_flop_total / (af64_total_median[e_tech] * (float64_t)TIME_USEC2NSEC);
+				e_roof = roofline_isa(e_tech);
+				printf("\n\t\t %25s: median = %14.3f [usec], overhead = x%5.2f, %7.2f GFLOP/s (%5.1f%% of %s roof)", pstr_technique[e_tech],
+					af64_total_median[e_tech], f64_ratio, f64_gflops, (100.0 * f64_gflops * af64_roof_ns_total[e_tech]) / f64_flop_total, kapstr_roof_isa[e_roof]);
+#if defined __linux__ || defined _WIN32
+				fprintf(p_file, "\n%s,%s,,,%u,%.4f,%.4f,,,,,%.4f,%.3f,%.0f,%.3f,%.3f,%.2f,,%s", pstr_technique[e_tech],
+					(ui32_shapes_timed < ui32_shapes) ? "Partial total" : "Total", ui32_calls,
+					af64_total_min[e_tech], af64_total_median[e_tech], f64_ratio, f64_gflops, f64_bytes_total, f64_flop_total / f64_bytes_total,
+					f64_flop_total / af64_roof_ns_total[e_tech], (100.0 * f64_gflops * af64_roof_ns_total[e_tech]) / f64_flop_total, kapstr_roof_isa[e_roof]);
+#endif
+			}
 		}
 	}
+	free(pab32_skipped);
 #if defined __linux__ || defined _WIN32
 	fclose(p_file);
 #endif
-        GET_TIME(tmr_end_exp);
+	GET_TIME(tmr_end_exp);
 	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
 	printf("\n\t\t Experiments executed in %10.f [sec]", time_interval);
 
@@ -1221,6 +2662,10 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 	DEF_TIME_VAR(tmr_start_exp);
 	DEF_TIME_VAR(tmr_end_exp);
 	float64_t time_interval;
+	/* Delta re-execution of the faults in A and B (-fi=delta|check, see smm_fi_campaign_detect) */
+	smm_fi_campaign_t st_fi;
+	bool32_t b32_detected_a,
+		b32_detected_b;
 
 
 #ifndef Square_mtrx
@@ -1233,6 +2678,8 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
 	GET_TIME(tmr_start_exp);
 
+	smm_fi_campaign_alloc(&st_fi);
+
 #ifdef Square_mtrx
 	matrix2zeros(&paf32_ma_fi[0u], MAX_DIM, MAX_DIM);
 	matrix2zeros(&paf32_mb_fi[0u], MAX_DIM, MAX_DIM);
@@ -1257,7 +2704,8 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 	//TECH_INTEL_XOR_CRC TECH_INTEL_ONES_INTERNAL TECH_INTEL_XOR_EXTERNAL TECH_INTEL_COMB
 	for (e_tech = TECH_INTEL_XOR_EXTERNAL; e_tech < TECH_INTEL_COMB; e_tech++)
 	{
-		if (ab32_selected_tech[e_tech])
+		/* Techniques without execution signature have nothing to detect */
+		if (ab32_selected_tech[e_tech] && (e_tech != TECH_INTEL_BLOCKED_NO_DC) && (e_tech != TECH_AVX512_NO_DC))
 		{
 #ifdef _WIN32
 			FILE *p_file;
@@ -1366,25 +2814,26 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 				printf("\n\t\t [%3u x %3u],", kaui32_matrix_size[e_size], kaui32_matrix_size[e_size]);
 
 				/* 1. Store the Execution Signature (ES) for comparing with the value obtained after the fault injection*/
-				aui32_dc_value[e_FI_VAR_NONE] = ptr_fn_smm_technique[e_tech](kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
+				aui32_dc_value[e_FI_VAR_NONE] = smm_fi_campaign_golden(e_tech, kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc, &st_fi);
 				for (ui32_idx_bit = 0u; ui32_idx_bit < ui32_combinations; ui32_idx_bit++) {
 					mem_fi(&paf32_ma_fi[0], ui32_idx_bit);
 					mem_fi(&paf32_mb_fi[0], ui32_idx_bit);
 
-					aui32_dc_value[e_FI_VAR_A] = ptr_fn_smm_technique[e_tech](kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-					aui32_dc_value[e_FI_VAR_B] = ptr_fn_smm_technique[e_tech](kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
+					/* Fault in A: only the row shard of the faulty element is executed (delta), fault in B: only its column slice */
+					b32_detected_a = smm_fi_campaign_detect(e_tech, kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc, aui32_dc_value[e_FI_VAR_NONE], &st_fi);
+					b32_detected_b = smm_fi_campaign_detect(e_tech, kaui32_matrix_size[e_size], f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc, aui32_dc_value[e_FI_VAR_NONE], &st_fi);
 
 					ui32_dc_cnt_all += 2u;
 					//ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
 					//ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
 
-					if (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) {
+					if (b32_detected_a) {
 						ui32_dc_cnt += 1u;
 					}
 					else {
 						fprintf(p_file_idx_fi, "%u,", ui32_idx_bit);
 					}
-					if (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) {
+					if (b32_detected_b) {
 						ui32_dc_cnt += 1u;
 					}
 					else {
@@ -1395,15 +2844,19 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 					mem_fi(&paf32_mb_fi[0], ui32_idx_bit);
 				}
 				fprintf(p_file, "\n%s, %u, %u, %u", pstr_technique[e_tech], kaui32_matrix_size[e_size], ui32_dc_cnt_all, ui32_dc_cnt);
+				if ((st_fi.b32_delta_a || st_fi.b32_delta_b) && (e_fi_mode == e_FI_EXEC_CHECK))
+				{
+					printf(" %s: delta / full mismatches = %u", pstr_technique[e_tech], st_fi.ui32_mismatch);
+				}
 			}
 #else
 			// 1. Store the Execution Signature (ES) for comparing with the value obtained after the fault injection
-			aui32_dc_value[e_FI_VAR_NONE] = ptr_fn_smm_technique[e_tech](M, N, K, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
+			aui32_dc_value[e_FI_VAR_NONE] = smm_execute(e_tech, M, N, K, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
 			fprintf(p_file, "diagnostic_technique,detected_errors_a,total_detected_errors,number_of_fi,M, N, K,idx_fi_initial,idx_fi_final_a,idx_fi_final_b,launch number,");
 			fprintf(p_file, "\n%s, ", pstr_technique[e_tech]);
 			for (ui32_idx_bit = ui32_idx_bit_aux; ui32_idx_bit < ui32_comb_a_max; ui32_idx_bit++) {
 				mem_fi(&paf32_ma_fi[0], ui32_idx_bit);
-				aui32_dc_value[e_FI_VAR_A] = ptr_fn_smm_technique[e_tech](M, N, K, f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
+				aui32_dc_value[e_FI_VAR_A] = smm_execute(e_tech, M, N, K, f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
 				if (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) {
 					ui32_dc_cnt += 1u;
 				}
@@ -1419,7 +2872,7 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 			for (ui32_idx_bit = ui32_idx_bit_aux; ui32_idx_bit < ui32_comb_b_max; ui32_idx_bit++)
 			{
 				mem_fi(&paf32_mb_fi[0], ui32_idx_bit);
-				aui32_dc_value[e_FI_VAR_B] = ptr_fn_smm_technique[e_tech](M, N, K, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
+				aui32_dc_value[e_FI_VAR_B] = smm_execute(e_tech, M, N, K, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
 				if (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) {
 					ui32_dc_cnt += 1u;
 				}
@@ -1438,6 +2891,8 @@ static int32_t measure_dc__error_bit_parallelized(e_enum_size_2d e_size_max, boo
 	}
 
 
+	smm_fi_campaign_free(&st_fi);
+
 	GET_TIME(tmr_end_exp);
 	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
 	printf("\n Experiments executed in %10.8lf [sec]", time_interval);
@@ -1465,6 +2920,8 @@ static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_
 		*pui32_b;
 	float32_t f32_alpha = 1.0f,
 		f32_dc;
+	/* Delta re-execution of the faulty MMMs (-fi=delta|check, see smm_fi_campaign_detect) */
+	smm_fi_campaign_t st_fi;
 	DEF_TIME_VAR(tmr_start);
 	DEF_TIME_VAR(tmr_end);
 	DEF_TIME_VAR(tmr_start_exp);
@@ -1499,6 +2956,7 @@ static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_
 
 	/* 3. Execute DC measurement */
 	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
+	smm_fi_campaign_alloc(&st_fi);
 	GET_TIME(tmr_start_exp);
 	for (e_tech = TECH_NONE; e_tech < TECH_MAX; e_tech++)
 	{
@@ -1507,31 +2965,30 @@ static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_
 			printf("\n\t Experiment %2u / %2u (%25s): ", (e_tech + 1u), (TECH_MAX + 1u), pstr_technique[e_tech]);
 			for (e_size = eSIZE_MIN; e_size <= e_size_max; e_size++)
 			{
-				size_a = M * K * sizeof(float32_t);
-				size_b = K * N * sizeof(float32_t);
+				/* Square matrices: the golden and the faulty MMMs have the same shape (delta re-execution) */
 				ui32_matrix_size = kaui32_matrix_size[e_size];
+				size_a = ui32_matrix_size * ui32_matrix_size * sizeof(float32_t);
+				size_b = ui32_matrix_size * ui32_matrix_size * sizeof(float32_t);
 				ui32_dc_cnt = 0u;
 				ui32_dc_cnt_all = 0u;
 
-				matrix2zeros(&paf32_ma[0u], M, K);
-				matrix2zeros(&paf32_mb[0u], K, N);
-				matrix2zeros(&paf32_mc[0u], M, N);
+				matrix2zeros(&paf32_ma[0u], ui32_matrix_size, ui32_matrix_size);
+				matrix2zeros(&paf32_mb[0u], ui32_matrix_size, ui32_matrix_size);
+				matrix2zeros(&paf32_mc[0u], ui32_matrix_size, ui32_matrix_size);
 
-				ui32_combinations_a = (M*K);
+				ui32_combinations_a = (ui32_matrix_size * ui32_matrix_size);
 				//Before: printf("\n\t\t [%3u x %3u]  Execution progress of 2 x (%6u) = %8u random value replacement error = [", ui32_matrix_size, ui32_matrix_size, ui32_combinations, (2u * ui32_combinations));
-				printf("\n\t\t  A =[%3u x %3u] B =[%3u x %3u],  Execution progress of 2 x (%6u x %6u) = %12u single-bit error injections = [", M, K, K, N, ui32_combinations_a, ui32_combinations_a, (2u * ui32_combinations_a * ui32_combinations_a));
+				printf("\n\t\t  A =[%3u x %3u] B =[%3u x %3u],  Execution progress of %6u random value replacement errors in A = [", ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, ui32_combinations_a);
 				GET_TIME(tmr_start);
-				aui32_dc_value[e_FI_VAR_NONE] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
+				aui32_dc_value[e_FI_VAR_NONE] = smm_fi_campaign_golden(e_tech, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc, &st_fi);
 				for (ui32_idx_value = 0u; ui32_idx_value < ui32_combinations_a; ui32_idx_value++)
 				{
 					memcpy(&paf32_ma_fi[0u], &paf32_ma[0u], size_a);
 					pui32_a = (uint32_t *)&paf32_ma_fi[ui32_idx_value];
-					*pui32_a = (uint32_t)rand();
-
-					aui32_dc_value[e_FI_VAR_A] = ptr_fn_smm_technique[e_tech](M, K, N, f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
+					*pui32_a = rng_u32(&st_rng);
 
 					ui32_dc_cnt_all += 2u;
-					ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
+					ui32_dc_cnt += smm_fi_campaign_detect(e_tech, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc, aui32_dc_value[e_FI_VAR_NONE], &st_fi) ? 1u : 0u;
 					/*if ((ui32_idx_value % (ui32_combinations / 10u) == 0u))
 					{
 					printf("%1u", ui32_idx_value / (ui32_combinations / 10u));
@@ -1542,12 +2999,10 @@ static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_
 				{
 					memcpy(&paf32_mb_fi[0u], &paf32_mb[0u], size_b);
 					pui32_b = (uint32_t *)&paf32_mb_fi[ui32_idx_value];
-					*pui32_b = (uint32_t)rand();
-
-					aui32_dc_value[e_FI_VAR_B] = ptr_fn_smm_technique[e_tech](M, K, N, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
+					*pui32_b = rng_u32(&st_rng);
 
 					ui32_dc_cnt_all += 2u;
-					ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
+					ui32_dc_cnt += smm_fi_campaign_detect(e_tech, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc, aui32_dc_value[e_FI_VAR_NONE], &st_fi) ? 1u : 0u;
 					/*if ((ui32_idx_value % (ui32_combinations / 10u) == 0u))
 					{
 					printf("%1u", ui32_idx_value / (ui32_combinations / 10u));
@@ -1558,6 +3013,10 @@ static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_
 				GET_TIME_DIFF(tmr_start, tmr_end, time_interval);
 				// Before: printf("]; Diagnostic coverage = %5.2f %%; Exec Time = %6.2f [sec]", f32_dc, time_interval);
 				printf("%5.2f, Exec Time = %6.2f", f32_dc, time_interval);
+				if ((st_fi.b32_delta_a || st_fi.b32_delta_b) && (e_fi_mode == e_FI_EXEC_CHECK))
+				{
+					printf(", delta / full mismatches = %u", st_fi.ui32_mismatch);
+				}
 #ifdef _WIN32
 				fprintf(p_file, "\n%s,%u,%f", pstr_technique[e_tech], kaui32_matrix_size[e_size], f32_dc);
 #endif
@@ -1571,6 +3030,7 @@ static int32_t measure_dc__error_random_value(e_enum_size_2d e_size_max, bool32_
 #ifdef _WIN32
 	fclose(p_file);
 #endif
+	smm_fi_campaign_free(&st_fi);
 
 	GET_TIME(tmr_end_exp);
 	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
@@ -1595,6 +3055,8 @@ static int32_t measure_dc__error_random_values(e_enum_size_2d e_size_max, bool32
 		aui32_dc_value[e_FI_VAR_MAX];
 	float32_t f32_alpha = 1.0f,
 		f32_dc;
+	/* Delta re-execution of the faulty MMMs (-fi=delta|check, see smm_fi_campaign_detect) */
+	smm_fi_campaign_t st_fi;
 	DEF_TIME_VAR(tmr_start);
 	DEF_TIME_VAR(tmr_end);
 	DEF_TIME_VAR(tmr_start_exp);
@@ -1629,6 +3091,7 @@ static int32_t measure_dc__error_random_values(e_enum_size_2d e_size_max, bool32
 
 	/* 3. Execute DC measurement */
 	e_size_max = (e_size_max < eSIZE_MAX) ? e_size_max : (eSIZE_MAX - 1u);
+	smm_fi_campaign_alloc(&st_fi);
 	GET_TIME(tmr_start_exp);
 	for (e_tech = TECH_NONE; e_tech < TECH_MAX; e_tech++)
 	{
@@ -1661,18 +3124,19 @@ static int32_t measure_dc__error_random_values(e_enum_size_2d e_size_max, bool32
 							memcpy(&paf32_mc[0u], &paf32_mc_rand[0], size);
 						}
 
-						aui32_dc_value[e_FI_VAR_NONE] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
+						/* Same A, B and C from the second iteration on: golden execution (and checkpoints) only when they change */
+						if (ui32_idx_iteration < 2u)
+						{
+							aui32_dc_value[e_FI_VAR_NONE] = smm_fi_campaign_golden(e_tech, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc, &st_fi);
+						}
 						memcpy(&paf32_ma_fi[0u], &paf32_ma[0u], size);
 						memcpy(&paf32_mb_fi[0u], &paf32_mb[0u], size);
 						mem_fi_random_value(&paf32_ma_fi[0], ui32_matrix_size * ui32_matrix_size, ui32_idx_length, b32_consecutive);
 						mem_fi_random_value(&paf32_mb_fi[0], ui32_matrix_size * ui32_matrix_size, ui32_idx_length, b32_consecutive);
 
-						aui32_dc_value[e_FI_VAR_A] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc);
-						aui32_dc_value[e_FI_VAR_B] = ptr_fn_smm_technique[e_tech](ui32_matrix_size, ui32_matrix_size, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc);
-
 						ui32_dc_cnt_all += 2u;
-						ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_A]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
-						ui32_dc_cnt = (aui32_dc_value[e_FI_VAR_NONE] != aui32_dc_value[e_FI_VAR_B]) ? (ui32_dc_cnt + 1u) : ui32_dc_cnt;
+						ui32_dc_cnt += smm_fi_campaign_detect(e_tech, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_ma_fi, (float32_t* const)paf32_mb, (float32_t* const)paf32_mb, (float32_t* const)paf32_mc, aui32_dc_value[e_FI_VAR_NONE], &st_fi) ? 1u : 0u;
+						ui32_dc_cnt += smm_fi_campaign_detect(e_tech, ui32_matrix_size, f32_alpha, (float32_t* const)paf32_ma, (float32_t* const)paf32_ma, (float32_t* const)paf32_mb, (float32_t* const)paf32_mb_fi, (float32_t* const)paf32_mc, aui32_dc_value[e_FI_VAR_NONE], &st_fi) ? 1u : 0u;
 					}
 					if (((ui32_idx_length) % ((ui32_n_length)) == 0u))
 					{
@@ -1686,6 +3150,10 @@ static int32_t measure_dc__error_random_values(e_enum_size_2d e_size_max, bool32
 				fprintf(p_file, "\n%s,%u,%f", pstr_technique[e_tech], kaui32_matrix_size[e_size], f32_dc);
 #endif
 				printf("]; Diagnostic coverage = %5.2f %%; Exec Time = %6.1f [sec]", f32_dc, time_interval);
+				if ((st_fi.b32_delta_a || st_fi.b32_delta_b) && (e_fi_mode == e_FI_EXEC_CHECK))
+				{
+					printf(", delta / full mismatches = %u", st_fi.ui32_mismatch);
+				}
 			}
 		}
 		else
@@ -1696,6 +3164,7 @@ static int32_t measure_dc__error_random_values(e_enum_size_2d e_size_max, bool32
 #ifdef _WIN32
 	fclose(p_file);
 #endif
+	smm_fi_campaign_free(&st_fi);
 	GET_TIME(tmr_end_exp);
 	GET_TIME_DIFF(tmr_start_exp, tmr_end_exp, time_interval);
 	printf("\n\t\t Experiments executed in %10.f [sec]", time_interval);
@@ -1722,14 +3191,14 @@ static void_t mem_fi_random_value(float32_t* const paf32_m, uint32_t ui32_max_di
 
 	if (b32_consecutive)
 	{
-		ui32_idx_error = ((uint32_t)rand() % ui32_max_dim);
+		ui32_idx_error = rng_range(&st_rng, ui32_max_dim);
 		//printf("\n ui32_idx_error = %u / %u; ui32_n_length = %u", ui32_idx_error, ui32_max_dim, ui32_n_length);
 		for (ui32_idx = 0u; ui32_idx < ui32_n_length; ui32_idx++)
 		{
 			if ((ui32_idx_error + ui32_idx) < ui32_max_dim)
 			{
 				//printf("fi-");
-				pui32_m[ui32_idx_error + ui32_idx] = (uint32_t)rand();
+				pui32_m[ui32_idx_error + ui32_idx] = rng_u32(&st_rng);
 			}
 		}
 	}
@@ -1738,9 +3207,9 @@ static void_t mem_fi_random_value(float32_t* const paf32_m, uint32_t ui32_max_di
 		for (ui32_idx = 0u; ui32_idx < ui32_n_length; ui32_idx++)
 		{
 			//printf("fi-");
-			ui32_idx_error = ((uint32_t)rand() % ui32_max_dim);
+			ui32_idx_error = rng_range(&st_rng, ui32_max_dim);
 			//printf("\n ui32_idx_error = %u / %u; ", ui32_idx_error, ui32_max_dim);
-			pui32_m[ui32_idx_error] = (uint32_t)rand();
+			pui32_m[ui32_idx_error] = rng_u32(&st_rng);
 		}
 	}
 }
@@ -1758,14 +3227,161 @@ static void_t matrix2zeros(float32_t * paf32_matrix, uint32_t ui32_max_rows, uin
 
 static void_t matrix2rand(float32_t * paf32_matrix, uint32_t ui32_max_rows, uint32_t ui32_max_columns)
 {
+	const uint32_t ui32_size = ui32_max_rows * ui32_max_columns;
 	uint32_t ui32_idx;
 
-	for (ui32_idx = 0u; ui32_idx < (ui32_max_rows * ui32_max_columns); ui32_idx++)
+	/* Values in [0, 2^31) as (float32_t)rand(). Element i from the generator i % RNG_LANES and every generator
+	   advanced by whole steps: the matrices of rng_u32_x8 in Parallelized_One_bit_error.c */
+	for (ui32_idx = 0u; ui32_idx < ui32_size; ui32_idx++)
+	{
+		*paf32_matrix++ = (float32_t)(rng_u32(&ast_rng_matrix[ui32_idx % RNG_LANES]) >> 1);
+	}
+	for (; (ui32_idx % RNG_LANES) != 0u; ui32_idx++)
+	{
+		(void)rng_u32(&ast_rng_matrix[ui32_idx % RNG_LANES]);
+	}
+}
+
+/******************************************************************************
+**				Name:    rng_init
+******************************************************************************/
+/*!
+** @brief  Seed the random numbers of the experiments: random values and sites of the faults (st_rng, stream 0)
+**         and the RNG_LANES streams of matrix2rand. The same seed gives the same matrices and the same faults.
+**
+** @param[in]  ui64_seed  Seed (-seed=), recorded in the time CSV file
+**
+******************************************************************************/
+static void_t rng_init(uint64_t ui64_seed)
+{
+	uint32_t ui32_lane;
+
+	ui64_rng_seed = ui64_seed;
+	rng_seed(&st_rng, ui64_seed, 0u);
+	for (ui32_lane = 0u; ui32_lane < RNG_LANES; ui32_lane++)
+	{
+		rng_seed(&ast_rng_matrix[ui32_lane], ui64_seed, RNG_STREAM_MATRIX + ui32_lane);
+	}
+}
+
+/******************************************************************************
+**				Name:    rng_seed
+******************************************************************************/
+/*!
+** @brief  Seed a xoshiro128** generator with the stream ui32_stream of the seed (splitmix64 of seed and stream)
+**
+** @param[out] pst_rng      Generator
+** @param[in]  ui64_seed    Seed
+** @param[in]  ui32_stream  Stream (faults, lane of matrix2rand)
+**
+******************************************************************************/
+static void_t rng_seed(st_rng_t *pst_rng, uint64_t ui64_seed, uint32_t ui32_stream)
+{
+	uint64_t ui64_x = ui64_seed ^ ((uint64_t)ui32_stream * 0xD1B54A32D192ED03ull),
+		ui64_z;
+	uint32_t ui32_idx;
+
+	for (ui32_idx = 0u; ui32_idx < 4u; ui32_idx += 2u)
+	{
+		ui64_x += 0x9E3779B97F4A7C15ull;
+		ui64_z = ui64_x;
+		ui64_z = (ui64_z ^ (ui64_z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		ui64_z = (ui64_z ^ (ui64_z >> 27)) * 0x94D049BB133111EBull;
+		ui64_z ^= (ui64_z >> 31);
+		pst_rng->aui32_s[ui32_idx] = (uint32_t)ui64_z;
+		pst_rng->aui32_s[ui32_idx + 1u] = (uint32_t)(ui64_z >> 32);
+	}
+	/* All zero state never leaves zero */
+	if ((pst_rng->aui32_s[0u] | pst_rng->aui32_s[1u] | pst_rng->aui32_s[2u] | pst_rng->aui32_s[3u]) == 0u)
 	{
-		*paf32_matrix++ = (float32_t)rand();
+		pst_rng->aui32_s[0u] = 1u;
 	}
 }
 
+/******************************************************************************
+**				Name:    rng_u32
+******************************************************************************/
+/*!
+** @brief  Next 32 bit random number (xoshiro128**, all 32 bits random unlike rand())
+**
+** @param[in,out] pst_rng  Generator
+**
+** @return  uint32_t Random number
+**
+******************************************************************************/
+static inline uint32_t rng_u32(st_rng_t *pst_rng)
+{
+	uint32_t *paui32_s = &pst_rng->aui32_s[0u];
+	const uint32_t ui32_result = RNG_ROTL(paui32_s[1u] * 5u, 7u) * 9u,
+		ui32_t = paui32_s[1u] << 9;
+
+	paui32_s[2u] ^= paui32_s[0u];
+	paui32_s[3u] ^= paui32_s[1u];
+	paui32_s[1u] ^= paui32_s[2u];
+	paui32_s[0u] ^= paui32_s[3u];
+	paui32_s[2u] ^= ui32_t;
+	paui32_s[3u] = RNG_ROTL(paui32_s[3u], 11u);
+
+	return ui32_result;
+}
+
+/******************************************************************************
+**				Name:    rng_range
+******************************************************************************/
+/*!
+** @brief  Random number in [0, ui32_range) (multiply and shift, no division)
+**
+** @param[in,out] pst_rng     Generator
+** @param[in]     ui32_range  Number of values
+**
+** @return  uint32_t Random number
+**
+******************************************************************************/
+static inline uint32_t rng_range(st_rng_t *pst_rng, uint32_t ui32_range)
+{
+	return (uint32_t)(((uint64_t)rng_u32(pst_rng) * ui32_range) >> 32);
+}
+
+/*==============================================================================================================
+**									Name: mem_alloc_aligned
+==============================================================================================================*/
+/*!
+** @brief Allocate a buffer aligned to MEM_ALIGN bytes (buffers of the shapes of the time measurements)
+**
+** @param[in] size 		Size in bytes
+**
+** @return void_t*  	Buffer (free with mem_free_aligned), NULL if there is not enough memory
+==============================================================================================================*/
+static void_t* mem_alloc_aligned(size_t size)
+{
+#if defined _WIN32
+	return _aligned_malloc(size, MEM_ALIGN);
+#elif defined __linux__
+	void_t *pv_mem = NULL;
+
+	return (posix_memalign(&pv_mem, MEM_ALIGN, size) == 0) ? pv_mem : NULL;
+#else
+	return malloc(size);    /* Standalone: the heap of the BSP is already 8-byte aligned, the kernels use unaligned loads */
+#endif
+}
+
+/*==============================================================================================================
+**									Name: mem_free_aligned
+==============================================================================================================*/
+/*!
+** @brief Free a buffer of mem_alloc_aligned
+**
+** @param[in] pv_mem 	Buffer (NULL: nothing to free)
+==============================================================================================================*/
+static void_t mem_free_aligned(void_t* pv_mem)
+{
+#if defined _WIN32
+	_aligned_free(pv_mem);
+#else
+	free(pv_mem);
+#endif
+}
+
 static inline uint32_t singletable_crc32c_ui32(uint32_t ui32_crc, uint32_t ui32_data)
 {
 	ui32_to_ui8_t u;
@@ -1781,38 +3397,259 @@ static inline uint32_t singletable_crc32c_ui32(uint32_t ui32_crc, uint32_t ui32_
 }
 
 /*==============================================================================================================
-* 											Experiment 0
+**									Name: crc32c_combine
 ==============================================================================================================*/
-
-/* ==============================================================================================================
-* 	Name: smm_no_dc
-* ============================================================================================================== */
-static uint32_t smm_no_dc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc)
+/*!
+** @brief CRC32C of the concatenation of two streams from the CRC32C of each stream (zlib crc32_combine).
+** 		  Both CRCs are chains started at INITIAL_REMAINDER without final XOR, as the ones of the techniques
+** 		  (singletable_crc32c_ui32 / _mm_crc32_u32). The first CRC is shifted over ui64_len2 zero bytes, i.e.
+** 		  multiplied by x^(8 x ui64_len2) mod P: crc32c_xpow and one carry-less multiplication (crc32c_shift_clmul)
+** 		  when SSE4.2 and PCLMULQDQ are available, crc32c_multmodp otherwise. O(log(len)), independent of the data.
+**
+** @param[in] ui32_crc1 	CRC of the first stream
+** @param[in] ui32_crc2 	CRC of the second stream
+** @param[in] ui64_len2 	Length of the second stream in bytes
+**
+** @return uint32_t  	CRC of the first stream followed by the second one
+==============================================================================================================*/
+static uint32_t crc32c_combine(uint32_t ui32_crc1, uint32_t ui32_crc2, uint64_t ui64_len2)
 {
-	uint32_t ui32_idx_i,
-		ui32_idx_j,
-		ui32_idx_k;
+	const uint32_t ui32_isa_clmul = e_ISA_AVX | e_ISA_AVX2 | e_ISA_SSE42 | e_ISA_PCLMUL;
 
-	for (ui32_idx_i = 0u; ui32_idx_i < ui32_m; ui32_idx_i++)
+	if (ui64_len2 == 0u)
 	{
-		for (ui32_idx_k = 0u; ui32_idx_k < ui32_k; ui32_idx_k++)
-		{
-			PUT_IN_REGISTER float32_t A_PART = f32_alpha * paf32_ma[(ui32_idx_i * ui32_k) + ui32_idx_k];
-			for (ui32_idx_j = 0u; ui32_idx_j < ui32_n; ui32_idx_j++)
-			{
-				paf32_mc[(ui32_idx_i * ui32_n) + ui32_idx_j] += A_PART * paf32_mb[(ui32_idx_k * ui32_n) + ui32_idx_j];
-			}
-		}
+		return ui32_crc1;
 	}
-	return 0u;
+
+	/* Initial value of the second chain: shift(crc1 ^ init) ^ crc2 */
+	ui32_crc1 ^= INITIAL_REMAINDER;
+	if ((ui64_len2 >= 5u) && ((ui32_cpu_isa & ui32_isa_clmul) == ui32_isa_clmul))
+	{
+		ui32_crc1 = crc32c_shift_zeros_clmul(ui32_crc1, ui64_len2);
+	}
+	else
+	{
+		ui32_crc1 = crc32c_multmodp(crc32c_xpow(8u * ui64_len2), ui32_crc1);
+	}
+
+	return ui32_crc1 ^ ui32_crc2;
 }
 
-/* ==============================================================================================================
-* 	Name: smm_no_dc_opt
-* ============================================================================================================== */
-static uint32_t smm_no_dc_opt(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc)
+/*==============================================================================================================
+**									Name: crc32c_combine_zero
+==============================================================================================================*/
+/*!
+** @brief crc32c_combine of two CRC32C started at 0 instead of INITIAL_REMAINDER (folded streams of the AVX-512
+** 		  techniques, smm_avx512_crc_lanes): the first CRC is only shifted over the second stream
+**
+** @param[in] ui32_crc1 	CRC (initial value 0) of the first stream
+** @param[in] ui32_crc2 	CRC (initial value 0) of the second stream
+** @param[in] ui64_len2 	Length of the second stream in bytes
+**
+** @return uint32_t  	CRC (initial value 0) of the first stream followed by the second one
+==============================================================================================================*/
+static uint32_t crc32c_combine_zero(uint32_t ui32_crc1, uint32_t ui32_crc2, uint64_t ui64_len2)
 {
-	uint32_t ui32_idx_i = 0u,
+	return (ui64_len2 == 0u) ? (ui32_crc1 ^ ui32_crc2) : crc32c_combine(ui32_crc1 ^ INITIAL_REMAINDER, ui32_crc2, ui64_len2);
+}
+
+/*==============================================================================================================
+**									Name: smm_crc32c_repeat
+==============================================================================================================*/
+/*!
+** @brief CRC32C (initial value 0) of ui64_count copies of a block, by doubling: O(log(count)) crc32c_combine_zero
+**
+** @param[in] ui32_crc 		CRC (initial value 0) of the block
+** @param[in] ui64_len 		Length of the block in bytes
+** @param[in] ui64_count 	Number of copies
+**
+** @return uint32_t  	CRC (initial value 0) of the copies
+==============================================================================================================*/
+static uint32_t smm_crc32c_repeat(uint32_t ui32_crc, uint64_t ui64_len, uint64_t ui64_count)
+{
+	uint32_t ui32_rep = 0u;
+
+	while (ui64_count != 0u)
+	{
+		if ((ui64_count & 1u) != 0u)
+		{
+			ui32_rep = crc32c_combine_zero(ui32_rep, ui32_crc, ui64_len);
+		}
+		ui32_crc = crc32c_combine_zero(ui32_crc, ui32_crc, ui64_len);
+		ui64_len *= 2u;
+		ui64_count >>= 1u;
+	}
+	return ui32_rep;
+}
+
+/*==============================================================================================================
+**									Name: crc32c_multmodp
+==============================================================================================================*/
+/*!
+** @brief Product of two polynomials modulo the CRC32C polynomial (bit reflected, bit 31: x^0)
+**
+** @param[in] ui32_a 	First polynomial
+** @param[in] ui32_b 	Second polynomial
+**
+** @return uint32_t  	a(x) * b(x) mod P(x)
+==============================================================================================================*/
+static uint32_t crc32c_multmodp(uint32_t ui32_a, uint32_t ui32_b)
+{
+	uint32_t ui32_m = 0x80000000u,
+		ui32_p = 0u;
+
+	while (ui32_m != 0u)
+	{
+		if ((ui32_a & ui32_m) != 0u)
+		{
+			ui32_p ^= ui32_b;
+			if ((ui32_a & (ui32_m - 1u)) == 0u)
+			{
+				break;
+			}
+		}
+		ui32_m >>= 1u;
+		ui32_b = ((ui32_b & 1u) != 0u) ? ((ui32_b >> 1u) ^ 0x82F63B78u) : (ui32_b >> 1u);
+	}
+	return ui32_p;
+}
+
+/*==============================================================================================================
+**									Name: crc32c_xpow
+==============================================================================================================*/
+/*!
+** @brief x^e modulo the CRC32C polynomial (bit reflected), by square and multiply
+**
+** @param[in] ui64_e 	Exponent
+**
+** @return uint32_t  	x^e mod P(x)
+==============================================================================================================*/
+static uint32_t crc32c_xpow(uint64_t ui64_e)
+{
+	uint32_t ui32_p = 0x80000000u,   /* x^0 */
+		ui32_x2n = 0x40000000u;     /* x^(2^n), n = 0 */
+
+	while (ui64_e != 0u)
+	{
+		if ((ui64_e & 1u) != 0u)
+		{
+			ui32_p = crc32c_multmodp(ui32_x2n, ui32_p);
+		}
+		ui32_x2n = crc32c_multmodp(ui32_x2n, ui32_x2n);
+		ui64_e >>= 1u;
+	}
+	return ui32_p;
+}
+
+/*==============================================================================================================
+**									Name: crc32c_sse42_ui32
+==============================================================================================================*/
+/*!
+** @brief CRC32C of a 32-bit word with the crc32 instruction: same value as singletable_crc32c_ui32
+**
+** @param[in] ui32_crc 		CRC
+** @param[in] ui32_data 	Data
+**
+** @return uint32_t  	Updated CRC
+==============================================================================================================*/
+static TARGET_SSE42 uint32_t crc32c_sse42_ui32(uint32_t ui32_crc, uint32_t ui32_data)
+{
+	return _mm_crc32_u32(ui32_crc, ui32_data);
+}
+
+/*==============================================================================================================
+**									Name: crc32c_m256
+==============================================================================================================*/
+/*!
+** @brief CRC32C of the 8 words of a vector (4 x crc32 of 64 bits): same value as 8 x _mm_crc32_u32, without
+** 		  going through memory
+**
+** @param[in] ui32_crc 		CRC
+** @param[in] m256i_v 		Data
+**
+** @return uint32_t  	Updated CRC
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t crc32c_m256(uint32_t ui32_crc, __m256i m256i_v)
+{
+	__m128i m128i_lo = _mm256_castsi256_si128(m256i_v),
+		m128i_hi = _mm256_extracti128_si256(m256i_v, 1);
+	uint64_t ui64_crc = ui32_crc;
+
+	ui64_crc = _mm_crc32_u64(ui64_crc, (uint64_t)_mm_cvtsi128_si64(m128i_lo));
+	ui64_crc = _mm_crc32_u64(ui64_crc, (uint64_t)_mm_extract_epi64(m128i_lo, 1));
+	ui64_crc = _mm_crc32_u64(ui64_crc, (uint64_t)_mm_cvtsi128_si64(m128i_hi));
+	ui64_crc = _mm_crc32_u64(ui64_crc, (uint64_t)_mm_extract_epi64(m128i_hi, 1));
+	return (uint32_t)ui64_crc;
+}
+
+/*==============================================================================================================
+**									Name: crc32c_shift_clmul
+==============================================================================================================*/
+/*!
+** @brief CRC32C shifted over len zero bytes with one carry-less multiplication: crc32(0, crc * k) with
+** 		  k = crc32c_xpow(8 * len - 33) (len >= 5)
+**
+** @param[in] ui32_crc 		CRC
+** @param[in] m128i_k 		Shift constant (low 32 bits)
+**
+** @return uint32_t  	Shifted CRC
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2_CLMUL uint32_t crc32c_shift_clmul(uint32_t ui32_crc, __m128i m128i_k)
+{
+	__m128i m128i_prod = _mm_clmulepi64_si128(_mm_cvtsi32_si128((int32_t)ui32_crc), m128i_k, 0x00);
+
+	return (uint32_t)_mm_crc32_u64(0u, (uint64_t)_mm_cvtsi128_si64(m128i_prod));
+}
+
+/*==============================================================================================================
+**									Name: crc32c_shift_zeros_clmul
+==============================================================================================================*/
+/*!
+** @brief CRC32C shifted over len zero bytes (len >= 5): crc32c_shift_clmul with k = crc32c_xpow(8 * len - 33)
+**
+** @param[in] ui32_crc 		CRC
+** @param[in] ui64_len 		Number of zero bytes
+**
+** @return uint32_t  	Shifted CRC
+==============================================================================================================*/
+static TARGET_AVX2_CLMUL uint32_t crc32c_shift_zeros_clmul(uint32_t ui32_crc, uint64_t ui64_len)
+{
+	return crc32c_shift_clmul(ui32_crc, _mm_cvtsi32_si128((int32_t)crc32c_xpow((8u * ui64_len) - 33u)));
+}
+
+/*==============================================================================================================
+* 											Experiment 0
+==============================================================================================================*/
+
+/* ==============================================================================================================
+* 	Name: smm_no_dc
+* ============================================================================================================== */
+static uint32_t smm_no_dc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc)
+{
+	uint32_t ui32_idx_i,
+		ui32_idx_j,
+		ui32_idx_k;
+
+	for (ui32_idx_i = 0u; ui32_idx_i < ui32_m; ui32_idx_i++)
+	{
+		for (ui32_idx_k = 0u; ui32_idx_k < ui32_k; ui32_idx_k++)
+		{
+			PUT_IN_REGISTER float32_t A_PART = f32_alpha * paf32_ma[(ui32_idx_i * ui32_k) + ui32_idx_k];
+			for (ui32_idx_j = 0u; ui32_idx_j < ui32_n; ui32_idx_j++)
+			{
+				paf32_mc[(ui32_idx_i * ui32_n) + ui32_idx_j] += A_PART * paf32_mb[(ui32_idx_k * ui32_n) + ui32_idx_j];
+			}
+		}
+	}
+	return 0u;
+}
+
+/* ==============================================================================================================
+* 	Name: smm_no_dc_opt
+* ============================================================================================================== */
+static uint32_t smm_no_dc_opt(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc)
+{
+	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
 		ui32_idx_k = 0u,
 		ui32_idx_a = 0u,
@@ -1848,6 +3685,32 @@ static uint32_t smm_no_dc_opt(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k,
 	return 0u;
 }
 
+/* ==============================================================================================================
+* 	Name: smm_no_dc_fma
+*
+* 	Brief: Golden implementation with fused multiply-add (same k order as smm_no_dc, one rounding per update).
+* 		   Reference of the AVX kernels when they run with FMA (b32_use_fma).
+* ============================================================================================================== */
+static TARGET_AVX2 uint32_t smm_no_dc_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc)
+{
+	uint32_t ui32_idx_i,
+		ui32_idx_j,
+		ui32_idx_k;
+
+	for (ui32_idx_i = 0u; ui32_idx_i < ui32_m; ui32_idx_i++)
+	{
+		for (ui32_idx_k = 0u; ui32_idx_k < ui32_k; ui32_idx_k++)
+		{
+			PUT_IN_REGISTER float32_t A_PART = f32_alpha * paf32_ma[(ui32_idx_i * ui32_k) + ui32_idx_k];
+			for (ui32_idx_j = 0u; ui32_idx_j < ui32_n; ui32_idx_j++)
+			{
+				paf32_mc[(ui32_idx_i * ui32_n) + ui32_idx_j] = _mm_cvtss_f32(_mm_fmadd_ss(_mm_set_ss(A_PART), _mm_set_ss(paf32_mb[(ui32_idx_k * ui32_n) + ui32_idx_j]), _mm_set_ss(paf32_mc[(ui32_idx_i * ui32_n) + ui32_idx_j])));
+			}
+		}
+	}
+	return 0u;
+}
+
 /*==============================================================================================================
 * 								 Experiment 1: Individual checksum
 ==============================================================================================================*/
@@ -2810,14 +4673,14 @@ static uint32_t smm_crc_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32
 			ui32_idx_b_ref += ui32_n;
 		}
 		/* CRC */
-		ui32_crc_a = singletable_crc32c_ui32(ui32_crc_a, (uint32_t) * (uint32_t*)&f32_a_part);
-		ui32_crc_b = singletable_crc32c_ui32(ui32_crc_b, (uint32_t) * (uint32_t*)&f32_b);
-		ui32_crc_c = singletable_crc32c_ui32(ui32_crc_c, (uint32_t) * (uint32_t*)&f32_c);
+		ui32_crc_a = SMM_CRC32C_UI32(ui32_crc_a, (uint32_t) * (uint32_t*)&f32_a_part);
+		ui32_crc_b = SMM_CRC32C_UI32(ui32_crc_b, (uint32_t) * (uint32_t*)&f32_b);
+		ui32_crc_c = SMM_CRC32C_UI32(ui32_crc_c, (uint32_t) * (uint32_t*)&f32_c);
 
 		ui32_idx_c_ref += ui32_n;
 	}
-	ui32_crc = singletable_crc32c_ui32(ui32_crc_a, ui32_crc_b);
-	ui32_crc = singletable_crc32c_ui32(ui32_crc, ui32_crc_c);
+	ui32_crc = SMM_CRC32C_UI32(ui32_crc_a, ui32_crc_b);
+	ui32_crc = SMM_CRC32C_UI32(ui32_crc, ui32_crc_c);
 	return ui32_crc;
 }
 
@@ -2876,16 +4739,16 @@ static uint32_t smm_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t
 				f32_c = paf32_mc[ui32_idx_c];
 			}
 			/* CRC */
-			ui32_crc_a = singletable_crc32c_ui32(ui32_crc_a, (uint32_t) * (uint32_t*)&f32_a_part);
-			ui32_crc_b = singletable_crc32c_ui32(ui32_crc_b, (uint32_t) * (uint32_t*)&f32_b);
-			ui32_crc_c = singletable_crc32c_ui32(ui32_crc_c, (uint32_t) * (uint32_t*)&f32_c);
+			ui32_crc_a = SMM_CRC32C_UI32(ui32_crc_a, (uint32_t) * (uint32_t*)&f32_a_part);
+			ui32_crc_b = SMM_CRC32C_UI32(ui32_crc_b, (uint32_t) * (uint32_t*)&f32_b);
+			ui32_crc_c = SMM_CRC32C_UI32(ui32_crc_c, (uint32_t) * (uint32_t*)&f32_c);
 
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
-	ui32_crc = singletable_crc32c_ui32(ui32_crc_a, ui32_crc_b);
-	ui32_crc = singletable_crc32c_ui32(ui32_crc, ui32_crc_c);
+	ui32_crc = SMM_CRC32C_UI32(ui32_crc_a, ui32_crc_b);
+	ui32_crc = SMM_CRC32C_UI32(ui32_crc, ui32_crc_c);
 	return ui32_crc;
 }
 
@@ -2907,6 +4770,32 @@ static uint32_t smm_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t
 ** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
 ==============================================================================================================*/
 static uint32_t smm_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc)
+{
+	uint32_t aui32_crc[e_CRC_STREAM_MAX];
+	uint32_t ui32_crc;
+
+	smm_crc_internal_rows(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, aui32_crc);
+	ui32_crc = SMM_CRC32C_UI32(aui32_crc[e_CRC_STREAM_A], aui32_crc[e_CRC_STREAM_B]);
+	ui32_crc = SMM_CRC32C_UI32(ui32_crc, aui32_crc[e_CRC_STREAM_C]);
+	return ui32_crc;
+}
+
+/* ==============================================================================================================
+* 	Name: smm_crc_internal_rows
+* ============================================================================================================== */
+/*!
+** @brief MMM of smm_crc_internal that returns the CRC chains of A, B and C instead of the execution signature
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[out] aui32_crc 	CRC chains (e_crc_stream), started at INITIAL_REMAINDER
+==============================================================================================================*/
+static void_t smm_crc_internal_rows(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t* const paf32_ma, const float32_t* const paf32_mb, float32_t* const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX])
 {
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -2919,8 +4808,7 @@ static uint32_t smm_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32
 
 	uint32_t ui32_crc_a = INITIAL_REMAINDER,
 		ui32_crc_b = INITIAL_REMAINDER,
-		ui32_crc_c = INITIAL_REMAINDER,
-		ui32_crc = INITIAL_REMAINDER;
+		ui32_crc_c = INITIAL_REMAINDER;
 
 	float32_t f32_a_part = 0.0f,
 		f32_b = 0.0f,
@@ -2937,7 +4825,7 @@ static uint32_t smm_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32
 		for (ui32_idx_k = 0u; ui32_idx_k < ui32_k; ui32_idx_k++, ui32_idx_a++)
 		{
 			PUT_IN_REGISTER f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			ui32_crc_a = singletable_crc32c_ui32(ui32_crc_a, (uint32_t) * (uint32_t*)&f32_a_part);
+			ui32_crc_a = SMM_CRC32C_UI32(ui32_crc_a, (uint32_t) * (uint32_t*)&f32_a_part);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j < ui32_n; ui32_idx_j++, ui32_idx_b++, ui32_idx_c++)
 			{
@@ -2945,16 +4833,16 @@ static uint32_t smm_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32
 				paf32_mc[ui32_idx_c] += f32_a_part * f32_b;
 				f32_c = paf32_mc[ui32_idx_c];
 				/* CRC */
-				ui32_crc_b = singletable_crc32c_ui32(ui32_crc_b, (uint32_t) * (uint32_t*)&f32_b);
-				ui32_crc_c = singletable_crc32c_ui32(ui32_crc_c, (uint32_t) * (uint32_t*)&f32_c);
+				ui32_crc_b = SMM_CRC32C_UI32(ui32_crc_b, (uint32_t) * (uint32_t*)&f32_b);
+				ui32_crc_c = SMM_CRC32C_UI32(ui32_crc_c, (uint32_t) * (uint32_t*)&f32_c);
 			}
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
-	ui32_crc = singletable_crc32c_ui32(ui32_crc_a, ui32_crc_b);
-	ui32_crc = singletable_crc32c_ui32(ui32_crc, ui32_crc_c);
-	return ui32_crc;
+	aui32_crc[e_CRC_STREAM_A] = ui32_crc_a;
+	aui32_crc[e_CRC_STREAM_B] = ui32_crc_b;
+	aui32_crc[e_CRC_STREAM_C] = ui32_crc_c;
 }
 
 /*==============================================================================================================
@@ -3081,7 +4969,7 @@ static uint32_t smm_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, f
 			ui32_xor = (ui32_xor_a ^ ui32_xor_b) ^ ui32_xor_c;
 
 			/* CRC */
-			ui32_crc = singletable_crc32c_ui32(ui32_crc, ui32_xor);
+			ui32_crc = SMM_CRC32C_UI32(ui32_crc, ui32_xor);
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
@@ -3239,7 +5127,7 @@ static uint32_t smm_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k,
 			Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
 
 			/* CRC */
-			ui32_crc = singletable_crc32c_ui32(ui32_crc, Ones_Checksum.ui32[0]);
+			ui32_crc = SMM_CRC32C_UI32(ui32_crc, Ones_Checksum.ui32[0]);
 
 			ui32_idx_b_ref += ui32_n;
 		}
@@ -3379,7 +5267,7 @@ static uint32_t smm_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k,
 			Twos_Checksum = (~Twos_Checksum) + 1;
 
 			/* CRC */
-			ui32_crc = singletable_crc32c_ui32(ui32_crc, Twos_Checksum);
+			ui32_crc = SMM_CRC32C_UI32(ui32_crc, Twos_Checksum);
 
 			ui32_idx_b_ref += ui32_n;
 		}
@@ -3446,7 +5334,7 @@ static uint32_t smm_flet_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k,
 			Fletcher.ui32 = (Fletcher_a.ui32 ^ Fletcher_b.ui32) ^ Fletcher_c.ui32;
 
 			/* CRC */
-			ui32_crc = singletable_crc32c_ui32(ui32_crc, Fletcher.ui32);
+			ui32_crc = SMM_CRC32C_UI32(ui32_crc, Fletcher.ui32);
 
 			ui32_idx_b_ref += ui32_n;
 		}
@@ -3477,6 +5365,78 @@ static inline uint32_t Fletcher32c_ui32(ui32_to_ui16_t Fletcher, uint32_t ui32_d
 	return Fletcher.ui32;
 }
 
+/*==============================================================================================================
+**									Name: fletcher_mod65535_epi32
+==============================================================================================================*/
+/*!
+** @brief Modulo 65535 of 4 unsigned 32-bit lanes without division (same value as v % 65535): 2^16 = 1 (mod 65535),
+** 		  so the high half is added to the low half twice (result <= 65535) and 65535 is mapped to 0.
+** 		  The Fletcher lanes of the AVX kernels are reduced after every vector: the 32-bit additions wrap
+** 		  (2^32 = 1 mod 65535), so a deferred reduction would change the checksum values.
+**
+** @param[in] m128i_v 	Lanes
+**
+** @return __m128i  	Lanes modulo 65535
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 __m128i fletcher_mod65535_epi32(__m128i m128i_v)
+{
+	const __m128i m128i_ffff = _mm_set1_epi32(0xFFFF);
+
+	m128i_v = _mm_add_epi32(_mm_and_si128(m128i_v, m128i_ffff), _mm_srli_epi32(m128i_v, 16));
+	m128i_v = _mm_add_epi32(_mm_and_si128(m128i_v, m128i_ffff), _mm_srli_epi32(m128i_v, 16));
+	return _mm_andnot_si128(_mm_cmpeq_epi32(m128i_v, m128i_ffff), m128i_v);
+}
+
+/*==============================================================================================================
+**									Name: ones_fold_epi64
+==============================================================================================================*/
+/*!
+** @brief End-around carry of 4 unsigned 64-bit one's complement sums: 2^32 = 1 (mod 2^32 - 1), so the high half
+** 		  is added to the low half. The result is below 2^33 and keeps the value modulo 2^32 - 1.
+**
+** @param[in] m256i_sum 	64-bit sums
+**
+** @return __m256i  		Folded sums
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 __m256i ones_fold_epi64(__m256i m256i_sum)
+{
+	const __m256i m256i_lo32 = _mm256_set1_epi64x(0xFFFFFFFFll);
+
+	return _mm256_add_epi64(_mm256_and_si256(m256i_sum, m256i_lo32), _mm256_srli_epi64(m256i_sum, 32));
+}
+
+/*==============================================================================================================
+**									Name: ones_lane_ui32
+==============================================================================================================*/
+/*!
+** @brief Final value of a one's complement lane of the AVX kernels, which computes x = ~(x + b) (end-around carry)
+** 		  for every input b. As ~x = -x (mod 2^32 - 1), the lane value is the alternating sum of its inputs,
+** 		  negated when the number of inputs is odd. Zero has two encodings: 0xFFFFFFFF is only produced
+** 		  by a zero input on a lane equal to 0, so it depends on the parity of the trailing run of zero inputs.
+**
+** @param[in] ui64_sum 		Alternating sum of the inputs (b, ~b, b, ...)
+** @param[in] b32_negate 	TRUE if the number of inputs is odd
+** @param[in] b32_zero_odd 	TRUE if the lane ends with an odd run of zero inputs
+**
+** @return uint32_t  		Lane value
+==============================================================================================================*/
+static uint32_t ones_lane_ui32(uint64_t ui64_sum, bool32_t b32_negate, bool32_t b32_zero_odd)
+{
+	uint32_t ui32_value;
+
+	ui64_sum = (ui64_sum & 0xFFFFFFFFu) + (ui64_sum >> 32);
+	ui64_sum = (ui64_sum & 0xFFFFFFFFu) + (ui64_sum >> 32);
+	ui32_value = (0xFFFFFFFFu == (uint32_t)ui64_sum) ? 0u : (uint32_t)ui64_sum;
+
+	if (0u == ui32_value) {
+		ui32_value = (FALSE != b32_zero_odd) ? 0xFFFFFFFFu : 0u;
+	}
+	else if (FALSE != b32_negate) {
+		ui32_value = ~ui32_value;
+	}
+	return ui32_value;
+}
+
 /*==============================================================================================================
 * 							Experiment 3 : Additionals cheksums added by JOP
 ==============================================================================================================*/
@@ -3496,7 +5456,6 @@ static uint32_t smm_crc_intermediate_comb(uint32_t ui32_m, uint32_t ui32_n, uint
 	float32_t f32_a_part;
 	uint32_t  ui32_XOR = 0u;
 	uint32_t  ui32_crc = INITIAL_REMAINDER;
-	ui32_to_ui8_t u;
 
 	// Verification of the input values
 	assert(paf32_ma != NULL);
@@ -3518,7 +5477,7 @@ static uint32_t smm_crc_intermediate_comb(uint32_t ui32_m, uint32_t ui32_n, uint
 				ui32_XOR ^= *((uint32_t *)&paf32_mc[ui32_idx_c]);
 			}
 			/* CRC */
-			SINGLETABLE_CRC32_UI32(ui32_crc, ui32_XOR, u);
+			ui32_crc = SMM_CRC32C_UI32(ui32_crc, ui32_XOR);
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
@@ -3542,7 +5501,6 @@ static uint32_t smm_crc_internal_comb(uint32_t ui32_m, uint32_t ui32_n, uint32_t
 		ui32_idx_c_ref = 0u;
 	uint32_t ui32_XOR = 0u;
 	uint32_t ui32_crc = INITIAL_REMAINDER;
-	ui32_to_ui8_t u;
 
 	float32_t f32_a_part = 0.0f,
 		f32_b = 0.0f,
@@ -3571,7 +5529,7 @@ static uint32_t smm_crc_internal_comb(uint32_t ui32_m, uint32_t ui32_n, uint32_t
 				ui32_XOR ^= *((uint32_t *)&f32_c);
 
 				/* CRC */
-				SINGLETABLE_CRC32_UI32(ui32_crc, ui32_XOR, u);
+				ui32_crc = SMM_CRC32C_UI32(ui32_crc, ui32_XOR);
 			}
 			ui32_idx_b_ref += ui32_n;
 		}
@@ -3596,7 +5554,6 @@ static uint32_t smm_comb(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, floa
 		ui32_xor_c = 0u,
 		ui32_xor;
 	uint32_t ui32_crc = INITIAL_REMAINDER;
-	ui32_to_ui8_t u;
 
 	float32_t f32_a_part = 0.0f,
 		f32_b = 0.0f,
@@ -3626,7 +5583,7 @@ static uint32_t smm_comb(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, floa
 			}
 			/* CRC */
 			ui32_xor = (ui32_xor_a ^ ui32_xor_b) ^ ui32_xor_c;
-			SINGLETABLE_CRC32_UI32(ui32_crc, ui32_xor, u);
+			ui32_crc = SMM_CRC32C_UI32(ui32_crc, ui32_xor);
 
 			ui32_idx_b_ref += ui32_n;
 		}
@@ -3639,24 +5596,27 @@ static uint32_t smm_comb(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, floa
 * 											Experiment 4
 ==============================================================================================================*/
 #ifdef _WIN32
-#ifdef _WIN32
 //  Windows
 #define cpuid(info, x)    __cpuidex(info, x, 0)
+#define xgetbv(x)         _xgetbv(x)
 #else
 //  GCC Intrinsics
-void cpuid(int info[4], int InfoType) {
+static void cpuid(int info[4], int InfoType) {
 	__cpuid_count(InfoType, 0, info[0], info[1], info[2], info[3]);
 }
+static uint64_t xgetbv(uint32_t ui32_xcr) {
+	uint32_t ui32_eax, ui32_edx;
+	__asm__ __volatile__("xgetbv" : "=a"(ui32_eax), "=d"(ui32_edx) : "c"(ui32_xcr));
+	return ((uint64_t)ui32_edx << 32u) | ui32_eax;
+}
 #endif
-#endif // _AVX
 
-#ifdef _WIN32
 //  Misc.
 static int HW_MMX, HW_x64, HW_RDRAND, HW_BMI1, HW_BMI2, HW_ADX, HW_PREFETCHWT1;
 static int HW_ABM;      // Advanced Bit Manipulation
 
 //  SIMD: 128-bit
-static int HW_SSE, HW_SSE2, HW_SSE3, HW_SSSE3, HW_SSE41, HW_SSE42, HW_SSE4a, HW_AES, HW_SHA;
+static int HW_SSE, HW_SSE2, HW_SSE3, HW_SSSE3, HW_SSE41, HW_SSE42, HW_SSE4a, HW_AES, HW_SHA, HW_PCLMUL;
 
 //  SIMD: 256-bit
 static int HW_AVX, HW_XOP, HW_FMA3, HW_FMA4, HW_AVX2;
@@ -3671,12 +5631,23 @@ static int HW_AVX512BW;   //  AVX512 Byte + Word
 static int HW_AVX512DQ;   //  AVX512 Doubleword + Quadword
 static int HW_AVX512IFMA; //  AVX512 Integer 52-bit Fused Multiply-Add
 static int HW_AVX512VBMI; //  AVX512 Vector Byte Manipulation Instructions
+static int HW_VPCLMULQDQ; //  256/512-bit carry-less multiplication
+
+//  OS support: the YMM / ZMM registers are saved on context switches (XCR0)
+static int HW_OS_AVX, HW_OS_AVX512;
+
+//  Time stamp counter: rdtscp instruction, constant rate in every P / C state (invariant TSC)
+static int HW_RDTSCP, HW_INVARIANT_TSC;
+
+//  Vendor (raw events of the hardware counters)
+static int HW_INTEL;
 
 
 void check_cpu_features(void) {
 	int info[4];
 	cpuid(info, 0);
 	int nIds = info[0];
+	HW_INTEL = ((uint32_t)info[1] == 0x756E6547u) && ((uint32_t)info[3] == 0x49656E69u) && ((uint32_t)info[2] == 0x6C65746Eu); /* "GenuineIntel" */
 
 	cpuid(info, 0x80000000);
 	unsigned nExIds = info[0];
@@ -3693,11 +5664,19 @@ void check_cpu_features(void) {
 		HW_SSE41 = (info[2] & ((uint32_t)1 << 19)) != 0;
 		HW_SSE42 = (info[2] & ((uint32_t)1 << 20)) != 0;
 		HW_AES = (info[2] & ((uint32_t)1 << 25)) != 0;
+		HW_PCLMUL = (info[2] & ((uint32_t)1 << 1)) != 0;
 
 		HW_AVX = (info[2] & ((uint32_t)1 << 28)) != 0;
 		HW_FMA3 = (info[2] & ((uint32_t)1 << 12)) != 0;
 
 		HW_RDRAND = (info[2] & ((uint32_t)1 << 30)) != 0;
+
+		if ((info[2] & ((uint32_t)1 << 27)) != 0) /* OSXSAVE */
+		{
+			uint64_t ui64_xcr0 = xgetbv(0u);
+			HW_OS_AVX = (ui64_xcr0 & 0x06u) == 0x06u;         /* XMM + YMM */
+			HW_OS_AVX512 = (ui64_xcr0 & 0xE6u) == 0xE6u;      /* XMM + YMM + opmask + ZMM */
+		}
 	}
 	if (nIds >= 0x00000007) {
 		cpuid(info, 0x00000007);
@@ -3718,6 +5697,7 @@ void check_cpu_features(void) {
 		HW_AVX512DQ = (info[1] & ((uint32_t)1 << 17)) != 0;
 		HW_AVX512IFMA = (info[1] & ((uint32_t)1 << 21)) != 0;
 		HW_AVX512VBMI = (info[2] & ((uint32_t)1 << 1)) != 0;
+		HW_VPCLMULQDQ = (info[2] & ((uint32_t)1 << 10)) != 0;
 	}
 	if (nExIds >= 0x80000001) {
 		cpuid(info, 0x80000001);
@@ -3726,6 +5706,11 @@ void check_cpu_features(void) {
 		HW_SSE4a = (info[2] & ((uint32_t)1 << 6)) != 0;
 		HW_FMA4 = (info[2] & ((uint32_t)1 << 16)) != 0;
 		HW_XOP = (info[2] & ((uint32_t)1 << 11)) != 0;
+		HW_RDTSCP = (info[3] & ((uint32_t)1 << 27)) != 0;
+	}
+	if (nExIds >= 0x80000007) {
+		cpuid(info, 0x80000007);
+		HW_INVARIANT_TSC = (info[3] & ((uint32_t)1 << 8)) != 0;
 	}
 }
 int is_avx() {
@@ -3739,820 +5724,1358 @@ int is_avx() {
 
 	return result;
 }
-#endif
 
 /*==============================================================================================================
-**									Name: smm_intel_xor_external
+**									Name: cpu_detect_isa
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the external loop
-**
-** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
-** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
-** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @brief Probe the instruction set extensions of the CPU executing the binary. AVX and AVX-512 are only reported
+** 		  when the operating system saves their registers.
 **
-** @return __m256  	m256_xor	Return the Execution signature of the MMM
+** @return uint32_t  	e_isa_flag mask
 ==============================================================================================================*/
-static uint32_t smm_intel_xor_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static uint32_t cpu_detect_isa(void_t)
 {
-	/* XOR checksum */
-	__m256i m256_xor_a = _mm256_setzero_si256(),
-		m256_xor_b = _mm256_setzero_si256(),
-		m256_xor_c = _mm256_setzero_si256(),
-		m256_xor = _mm256_setzero_si256();
+	uint32_t ui32_isa = e_ISA_NONE;
 
-	/* XOR checksum */
-	uint32_t ui32_xor_a = 0u,
-		ui32_xor_b = 0u,
-		ui32_xor_c = 0u,
-		ui32_xor = 0u;
+	check_cpu_features();
+	ui32_isa |= HW_SSE42 ? e_ISA_SSE42 : e_ISA_NONE;
+	ui32_isa |= HW_PCLMUL ? e_ISA_PCLMUL : e_ISA_NONE;
+	if (HW_OS_AVX)
+	{
+		ui32_isa |= HW_AVX ? e_ISA_AVX : e_ISA_NONE;
+		ui32_isa |= (HW_AVX && HW_AVX2) ? e_ISA_AVX2 : e_ISA_NONE;
+		ui32_isa |= (HW_AVX && HW_FMA3) ? e_ISA_FMA : e_ISA_NONE;
+		ui32_isa |= (HW_AVX && HW_VPCLMULQDQ && HW_PCLMUL) ? e_ISA_VPCLMUL : e_ISA_NONE;
+	}
+	if (HW_OS_AVX && HW_OS_AVX512)
+	{
+		ui32_isa |= HW_AVX512F ? e_ISA_AVX512F : e_ISA_NONE;
+		ui32_isa |= (HW_AVX512F && HW_AVX512BW) ? e_ISA_AVX512BW : e_ISA_NONE;
+		ui32_isa |= (HW_AVX512F && HW_AVX512VL) ? e_ISA_AVX512VL : e_ISA_NONE;
+	}
 
-	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
+	return ui32_isa;
+}
 
-	uint32_t ui32_idx_i = 0u,
-		ui32_idx_j = 0u,
-		ui32_idx_k = 0u,
-		ui32_idx_a = 0u,
-		ui32_idx_b = 0u,
-		ui32_idx_c = 0u,
-		ui32_idx_b_ref = 0u,
-		ui32_idx_c_ref = 0u;
+/*==============================================================================================================
+**									Name: timer_mono_ticks
+==============================================================================================================*/
+/*!
+** @brief Read the monotonic clock: CLOCK_MONOTONIC_RAW (not slewed by NTP) on Linux, QueryPerformanceCounter on
+** 		  Windows, the global timer on the Xilinx boards
+**
+** @return uint64_t  	Ticks of the monotonic clock
+==============================================================================================================*/
+static uint64_t timer_mono_ticks(void_t)
+{
+#if defined __linux__
+	struct timespec st_ts;
 
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
+	clock_gettime(CLOCK_MONOTONIC_RAW, &st_ts);
+	return ((uint64_t)st_ts.tv_sec * 1000000000u) + (uint64_t)st_ts.tv_nsec;
+#elif defined _WIN32
+	LARGE_INTEGER li_count;
 
-	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
-	{
-		ui32_idx_b_ref = 0u;
-		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
-		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
+	QueryPerformanceCounter(&li_count);
+	return (uint64_t)li_count.QuadPart;
+#else
+	XTime tmr_now;
 
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
-			{
-				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
-				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
-				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
-			}
+	XTime_GetTime(&tmr_now);
+	return (uint64_t)tmr_now;
+#endif
+}
 
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-				}
-			}
-			ui32_idx_b_ref += ui32_n;
-		}
-		ui32_xor ^= (uint32_t) *((uint32_t*)&f32_a_part);
-		m256_xor_b = _mm256_xor_si256(m256_xor_b, _mm256_castps_si256(b256));
-		m256_xor_c = _mm256_xor_si256(m256_xor_b, _mm256_castps_si256(result256));
-		ui32_idx_c_ref += ui32_n;
-	}
-	m256_xor = _mm256_xor_si256(m256_xor_b, m256_xor_c);
+/*==============================================================================================================
+**									Name: timer_ticks
+==============================================================================================================*/
+/*!
+** @brief Read the clock of the time measurements (e_timer_src). rdtscp waits until the previous instructions
+** 		  have executed and the lfence keeps the next ones after the read, so the timed call is neither
+** 		  started before the first read nor finished after the second one.
+**
+** @return uint64_t  	Ticks, f64_timer_ns_per_tick nanoseconds each
+==============================================================================================================*/
+static uint64_t timer_ticks(void_t)
+{
+#if defined __linux__ || defined _WIN32
+	uint64_t ui64_ticks;
+	uint32_t ui32_aux;
 
-	uint32_t val[8];
-	memcpy(val, &m256_xor, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	if (e_timer_src == e_TIMER_TSC)
 	{
-		ui32_xor ^= (uint32_t) *((uint32_t*)&val[ui32_idx_i]);
+		ui64_ticks = __rdtscp(&ui32_aux);
+		_mm_lfence();
+		return ui64_ticks;
 	}
-	return ui32_xor;
-
+#endif
+	return timer_mono_ticks();
 }
 
 /*==============================================================================================================
-**									Name: smm_intel_xor_intermediate
+**									Name: timer_init
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the intermediate loop
+** @brief Select the clock of the time measurements. The TSC is only used with rdtscp and an invariant TSC
+** 		  (same rate in every P / C state); its frequency is measured against the monotonic clock during
+** 		  TIMER_CALIBRATION_NS. The cost of a read is the median of back to back reads.
 **
-** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
-** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
-** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha Correction factor
-** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] e_timer_req 	Clock requested by the user (-timer=mono|tsc)
 **
-** @return uint32_t  	ui32_xor	Return the Execution signature of the MMM
+** @return e_timer  	Clock selected (e_TIMER_MONO if the TSC cannot be used)
 ==============================================================================================================*/
-static uint32_t smm_intel_xor_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static e_timer timer_init(e_timer e_timer_req)
 {
-	/* XOR checksum */
-	__m256i m256_xor_b = _mm256_setzero_si256(),
-		m256_xor_c = _mm256_setzero_si256(),
-		m256_xor;
-
-	/* XOR checksum */
-	uint32_t ui32_xor_a = 0u,
-		ui32_xor_b = 0u,
-		ui32_xor_c = 0u,
-		ui32_xor = 0u;
-
-	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
-
-	uint32_t ui32_idx_i = 0u,
-		ui32_idx_j = 0u,
-		ui32_idx_k = 0u,
-		ui32_idx_a = 0u,
-		ui32_idx_b = 0u,
-		ui32_idx_c = 0u,
-		ui32_idx_b_ref = 0u,
-		ui32_idx_c_ref = 0u;
+	float64_t af64_read[TIMER_OVERHEAD_READS];
+	time_stats_t st_stats;
+	uint64_t ui64_tick,
+		ui64_tick_next;
+	uint32_t ui32_idx;
 
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
+	/* 1. Monotonic clock */
+	e_timer_src = e_TIMER_MONO;
+#if defined __linux__
+	f64_timer_ns_per_tick = 1.0;
+#elif defined _WIN32
+	{
+		LARGE_INTEGER li_freq;
+		QueryPerformanceFrequency(&li_freq);
+		f64_timer_ns_per_tick = 1.0e9 / (float64_t)li_freq.QuadPart;
+	}
+#else
+	f64_timer_ns_per_tick = 1.0e9 / CPU_CLK_FREQ_HZ
+#endif
 
-	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	/* 2. TSC: ticks counted during a fixed interval of the monotonic clock */
+#if defined __linux__ || defined _WIN32
+	if (e_timer_req == e_TIMER_TSC)
 	{
-		ui32_idx_b_ref = 0u;
-		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		check_cpu_features();
+		if (HW_RDTSCP && HW_INVARIANT_TSC)
 		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
-
-			// Evaluation of the ES (A value)
-			ui32_xor_a ^= (uint32_t) *((uint32_t*)&f32_a_part);
-
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			uint64_t ui64_mono_start,
+				ui64_mono_end,
+				ui64_tsc_start,
+				ui64_tsc_end;
+
+			e_timer_src = e_TIMER_TSC;
+			ui64_mono_start = timer_mono_ticks();
+			ui64_tsc_start = timer_ticks();
+			do
 			{
-				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
-				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
-				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
-			}
-
-			// Evaluation of the ES (B value)
-			m256_xor_b = _mm256_xor_si256(m256_xor_b, _mm256_castps_si256(b256));
-
-			// Evaluation of the ES (C value)
-			m256_xor_c = _mm256_xor_si256(m256_xor_c, _mm256_castps_si256(result256));
-
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* XOR checksum */
-					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-				}
-			}
-			ui32_idx_b_ref += ui32_n;
+				ui64_mono_end = timer_mono_ticks();
+			} while (((float64_t)(ui64_mono_end - ui64_mono_start) * f64_timer_ns_per_tick) < TIMER_CALIBRATION_NS);
+			ui64_tsc_end = timer_ticks();
+			f64_timer_ns_per_tick = ((float64_t)(ui64_mono_end - ui64_mono_start) * f64_timer_ns_per_tick) / (float64_t)(ui64_tsc_end - ui64_tsc_start);
+		}
+		else
+		{
+			printf("\n ---> The CPU has no rdtscp or no invariant TSC, using the monotonic clock");
 		}
-		ui32_idx_c_ref += ui32_n;
 	}
-	ui32_xor ^= (ui32_xor_b ^ ui32_xor_a) ^ ui32_xor_c;
-
-	m256_xor = _mm256_xor_si256(m256_xor_b, m256_xor_c);
+#endif
 
-	uint32_t val[8];
-	memcpy(val, &m256_xor, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	/* 3. Cost of a read */
+	ui64_tick = timer_ticks();
+	for (ui32_idx = 0u; ui32_idx < TIMER_OVERHEAD_READS; ui32_idx++)
 	{
-		ui32_xor ^= (uint32_t) *((uint32_t*)&val[ui32_idx_i]);
+		ui64_tick_next = timer_ticks();
+		af64_read[ui32_idx] = (float64_t)(ui64_tick_next - ui64_tick) * f64_timer_ns_per_tick;
+		ui64_tick = ui64_tick_next;
 	}
+	time_stats(&af64_read[0u], TIMER_OVERHEAD_READS, &st_stats);
+	f64_timer_overhead_ns = st_stats.f64_median;
 
-	return ui32_xor;
+	return e_timer_src;
 }
 
 /*==============================================================================================================
-**									Name: smm_intel_xor_internal
+**									Name: time_cmp_f64
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
-**
-** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
-** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
-** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @brief qsort comparison of two float64_t (ascending order)
+==============================================================================================================*/
+static int time_cmp_f64(const void *pv_a, const void *pv_b)
+{
+	const float64_t f64_a = *(const float64_t*)pv_a,
+		f64_b = *(const float64_t*)pv_b;
+
+	return (f64_a > f64_b) - (f64_a < f64_b);
+}
+
+/*==============================================================================================================
+**									Name: time_stats
+==============================================================================================================*/
+/*!
+** @brief Order statistics of the timed calls: min, median, median absolute deviation, nearest-rank p95 / p99
+** 		  and max. The median and the MAD are not moved by the few calls interrupted by the OS, unlike the mean.
 **
-** @return uint32_t  	ui32_xor	Return the Execution signature of the MMM
+** @param[in,out] paf64_samples 	Samples (sorted, then overwritten with the absolute deviations)
+** @param[in] ui32_n 				Number of samples (> 0)
+** @param[out] pst_stats 			Statistics, same unit as the samples
 ==============================================================================================================*/
-static uint32_t smm_intel_xor_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static void_t time_stats(float64_t* const paf64_samples, uint32_t ui32_n, time_stats_t* const pst_stats)
 {
-	/* XOR checksum */
-	__m256i m256_xor_b = _mm256_setzero_si256(),
-		m256_xor_c = _mm256_setzero_si256(),
-		m256_xor;
+	uint32_t ui32_idx;
 
-	/* XOR checksum */
-	uint32_t ui32_xor_a = 0u,
-		ui32_xor_b = 0u,
-		ui32_xor_c = 0u,
-		ui32_xor = 0u;
+	assert((paf64_samples != NULL) && (ui32_n > 0u) && (pst_stats != NULL));
+	qsort(paf64_samples, ui32_n, sizeof(float64_t), time_cmp_f64);
+	pst_stats->ui32_n = ui32_n;
+	pst_stats->f64_min = paf64_samples[0u];
+	pst_stats->f64_median = TIME_MEDIAN_SORTED(paf64_samples, ui32_n);
+	pst_stats->f64_p95 = TIME_RANK_SORTED(paf64_samples, ui32_n, 95u);
+	pst_stats->f64_p99 = TIME_RANK_SORTED(paf64_samples, ui32_n, 99u);
+	pst_stats->f64_max = paf64_samples[ui32_n - 1u];
 
-	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
+	for (ui32_idx = 0u; ui32_idx < ui32_n; ui32_idx++)
+	{
+		paf64_samples[ui32_idx] = fabs(paf64_samples[ui32_idx] - pst_stats->f64_median);
+	}
+	qsort(paf64_samples, ui32_n, sizeof(float64_t), time_cmp_f64);
+	pst_stats->f64_mad = TIME_MEDIAN_SORTED(paf64_samples, ui32_n);
+}
 
-	uint32_t ui32_idx_i = 0u,
-		ui32_idx_j = 0u,
-		ui32_idx_k = 0u,
-		ui32_idx_a = 0u,
-		ui32_idx_b = 0u,
-		ui32_idx_c = 0u,
-		ui32_idx_b_ref = 0u,
-		ui32_idx_c_ref = 0u;
+/*==============================================================================================================
+**									Name: perf_open
+==============================================================================================================*/
+/*!
+** @brief Open the hardware counters of the time measurements (-perf) as one perf_event_open group of the calling
+** 		  thread, user space only, led by the cycles: the group is read with a single read() and all its events
+** 		  count the same instructions. Events the kernel or the CPU cannot count are left out of the group; the
+** 		  SIMD FP event is FP_ARITH_INST_RETIRED (single precision) on Intel or the raw event given by the user.
+**
+** @param[in] ui64_raw_fp 	Raw event of the SIMD FP counter, 0: FP_ARITH_INST_RETIRED on Intel, not counted otherwise
+**
+** @return bool32_t  	TRUE if the counters are used
+==============================================================================================================*/
+static bool32_t perf_open(uint64_t ui64_raw_fp)
+{
+#ifdef __linux__
+	struct perf_event_attr st_attr;
+	e_perf_event e_event;
 
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
+	check_cpu_features();
+	if ((ui64_raw_fp == 0u) && HW_INTEL)
+	{
+		ui64_raw_fp = PERF_RAW_INTEL_FP_SINGLE;
+	}
 
-	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	ui32_perf_events = 0u;
+	i32_perf_fd_leader = -1;
+	printf("\n\t Hardware counters:");
+	for (e_event = e_PERF_CYCLES; e_event < e_PERF_MAX; e_event++)
 	{
-		ui32_idx_b_ref = 0u;
-		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		memset(&st_attr, 0, sizeof(st_attr));
+		st_attr.size = sizeof(st_attr);
+		st_attr.type = PERF_TYPE_HARDWARE;
+		st_attr.disabled = (i32_perf_fd_leader < 0) ? 1u : 0u;
+		st_attr.exclude_kernel = 1u;
+		st_attr.exclude_hv = 1u;
+		st_attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+		switch (e_event)
 		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
-
-			// Evaluation of the ES (A value)
-			ui32_xor_a ^= (uint32_t) *((uint32_t*)&f32_a_part);
-
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
-			{
-				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
-				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
+		case e_PERF_CYCLES:
+			st_attr.config = PERF_COUNT_HW_CPU_CYCLES;
+			break;
+		case e_PERF_INSTRUCTIONS:
+			st_attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+			break;
+		case e_PERF_L1D_MISSES:
+			st_attr.type = PERF_TYPE_HW_CACHE;
+			st_attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8u) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16u);
+			break;
+		case e_PERF_LLC_MISSES:
+			st_attr.config = PERF_COUNT_HW_CACHE_MISSES;
+			break;
+		case e_PERF_BRANCH_MISSES:
+			st_attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+			break;
+		default:
+			st_attr.type = PERF_TYPE_RAW;
+			st_attr.config = ui64_raw_fp;
+			break;
+		}
 
-				result256 = _mm256_add_ps(result256, c256);
-				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+		ai32_perf_fd[e_event] = -1;
+		if ((e_event != e_PERF_SIMD_FP) || (ui64_raw_fp != 0u))
+		{
+			ai32_perf_fd[e_event] = (int32_t)syscall(__NR_perf_event_open, &st_attr, 0, -1, i32_perf_fd_leader, 0);
+		}
+		if (ai32_perf_fd[e_event] >= 0)
+		{
+			i32_perf_fd_leader = (i32_perf_fd_leader < 0) ? ai32_perf_fd[e_event] : i32_perf_fd_leader;
+			aui32_perf_slot[e_event] = ui32_perf_events;
+			ui32_perf_events++;
+			printf(" %s", kapstr_perf_event[e_event]);
+		}
+	}
 
-				// Evaluation of the ES (B value)
-				m256_xor_b = _mm256_xor_si256(m256_xor_b, _mm256_castps_si256(b256));
+	if (ui32_perf_events == 0u)
+	{
+		printf(" none");
+		printf("\n ---> perf_event_open failed (no PMU, or kernel.perf_event_paranoid > 2), time measurements without counters");
+		return FALSE;
+	}
+	ioctl(i32_perf_fd_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+	ioctl(i32_perf_fd_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	return TRUE;
+#else
+	(void)ui64_raw_fp;
+	printf("\n ---> The hardware counters (-perf) are only read on Linux");
+	return FALSE;
+#endif
+}
 
-				// Evaluation of the ES (C value)
-				m256_xor_c = _mm256_xor_si256(m256_xor_c, _mm256_castps_si256(result256));
-			}
+/*==============================================================================================================
+**									Name: perf_read
+==============================================================================================================*/
+/*!
+** @brief Read the hardware counter group opened by perf_open (one read() of the group leader)
+**
+** @param[out] pst_counts 	Counts of the events of the group and enabled / running times
+==============================================================================================================*/
+static void_t perf_read(perf_counts_t* const pst_counts)
+{
+	e_perf_event e_event;
+	uint64_t aui64_group[3u + e_PERF_MAX];  /* nr, time enabled, time running, values */
 
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* XOR checksum */
-					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-				}
+	memset(pst_counts, 0, sizeof(*pst_counts));
+#ifdef __linux__
+	if ((ui32_perf_events > 0u) && (read(i32_perf_fd_leader, aui64_group, sizeof(aui64_group)) > 0))
+	{
+		pst_counts->ui64_enabled = aui64_group[1u];
+		pst_counts->ui64_running = aui64_group[2u];
+		for (e_event = e_PERF_CYCLES; e_event < e_PERF_MAX; e_event++)
+		{
+			if (ai32_perf_fd[e_event] >= 0)
+			{
+				pst_counts->aui64_count[e_event] = aui64_group[3u + aui32_perf_slot[e_event]];
 			}
-			ui32_idx_b_ref += ui32_n;
 		}
-		ui32_idx_c_ref += ui32_n;
 	}
-	ui32_xor ^= (ui32_xor_b ^ ui32_xor_a) ^ ui32_xor_c;
+#else
+	(void)e_event;
+	(void)aui64_group;
+#endif
+}
 
-	m256_xor = _mm256_xor_si256(m256_xor_b, m256_xor_c);
+/*==============================================================================================================
+**									Name: perf_close
+==============================================================================================================*/
+/*!
+** @brief Close the hardware counters opened by perf_open
+==============================================================================================================*/
+static void_t perf_close(void_t)
+{
+	e_perf_event e_event;
 
-	uint32_t val[8];
-	memcpy(val, &m256_xor, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	for (e_event = e_PERF_CYCLES; e_event < e_PERF_MAX; e_event++)
 	{
-		ui32_xor ^= (uint32_t) *((uint32_t*)&val[ui32_idx_i]);
+#ifdef __linux__
+		if (ai32_perf_fd[e_event] >= 0)
+		{
+			close(ai32_perf_fd[e_event]);
+		}
+#endif
+		ai32_perf_fd[e_event] = -1;
 	}
-
-	return ui32_xor;
+	i32_perf_fd_leader = -1;
+	ui32_perf_events = 0u;
 }
+
 /*==============================================================================================================
-**									Name: smm_intel_twos_external
+**									Name: roofline_measure
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the external loop
-**
-** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
-** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
-** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @brief Ceilings of the roofline of the host, with the threads of the techniques (-threads=N, 1 without):
+** 		  - peaks: multiply-accumulates of each instruction set available (SSE, AVX2, AVX-512), FMA or MUL + ADD
+** 		    as the kernels (b32_use_fma), ROOF_MADD_ACC independent accumulators. A technique is placed under
+** 		    the peak of the instruction set of its implementation (roofline_isa);
+** 		  - bandwidth: STREAM triad a = b + s x c on ROOF_STREAM_ELEMS floats, 12 bytes per element (the
+** 		    write-allocate of a is not counted, as in STREAM).
+** 		  Best of ROOF_REPEAT runs of each one.
 **
-** @return __m256  	m256_twos	Return the Execution signature of the MMM
+** @param[out] pst_roof 	Peaks [GFLOP/s] and bandwidth [GB/s]
 ==============================================================================================================*/
-static uint32_t smm_intel_twos_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static void_t roofline_measure(roofline_t* const pst_roof)
 {
-	/* Twos checksum */
-	__m256i m256i_twos_b = _mm256_setzero_si256(),
-		m256i_twos_c = _mm256_setzero_si256(),
-		m256i_twos;
-
-	/* Two's complement checksum */
-	uint32_t Twos_Checksum_a = 0u,
-		Twos_Checksum_b = 0u,
-		Twos_Checksum_c = 0u,
-		Twos_Checksum = 0u;
-
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
-	__m256i m256i_singleOne = _mm256_set1_epi32(1);
-
-	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
-
-	uint32_t ui32_idx_i = 0u,
-		ui32_idx_j = 0u,
-		ui32_idx_k = 0u,
-		ui32_idx_a = 0u,
-		ui32_idx_b = 0u,
-		ui32_idx_c = 0u,
-		ui32_idx_b_ref = 0u,
-		ui32_idx_c_ref = 0u;
-
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
-
-	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	static float32_t(* const kaptr_fn_peak[e_ROOF_MAX])(uint64_t ui64_iter) = { roofline_peak_sse, roofline_peak_avx2, roofline_peak_avx512 };
+	static const uint32_t kaui32_lanes[e_ROOF_MAX] = { 4u, 8u, 16u };
+	const uint32_t kaui32_isa[e_ROOF_MAX] = { e_ISA_NONE, e_ISA_AVX | e_ISA_AVX2, e_ISA_AVX512F };
+	e_roof_isa e_roof;
+	float32_t f32_sink,
+		*paf32_a,
+		*paf32_b,
+		*paf32_c;
+	float64_t f64_flop,
+		f64_ns;
+	uint64_t ui64_tick_start;
+	uint32_t ui32_rep;
+	int32_t i32_threads = (ui32_omp_threads > 1u) ? (int32_t)ui32_omp_threads : 1;
+	int64_t i64_idx;
+	volatile float32_t f32_keep;
+
+	assert(pst_roof != NULL);
+
+	/* 1. Peak of each instruction set of the techniques (SSE is the baseline of x86-64) */
+	for (e_roof = e_ROOF_SSE; e_roof < e_ROOF_MAX; e_roof++)
 	{
-		ui32_idx_b_ref = 0u;
-		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		pst_roof->af64_peak_gflops[e_roof] = 0.0;
+		if ((kaui32_isa[e_roof] & ~ui32_cpu_isa) != 0u)
 		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
-
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			continue;
+		}
+		f64_flop = 2.0 * (float64_t)ROOF_MADD_ITER * (float64_t)ROOF_MADD_ACC * (float64_t)kaui32_lanes[e_roof] * (float64_t)i32_threads;
+		for (ui32_rep = 0u; ui32_rep < ROOF_REPEAT; ui32_rep++)
+		{
+			f32_sink = 0.0f;
+			ui64_tick_start = timer_ticks();
+#pragma omp parallel num_threads(i32_threads) reduction(+:f32_sink)
 			{
-				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
-				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
-				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+				f32_sink += kaptr_fn_peak[e_roof](ROOF_MADD_ITER);
 			}
-
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-				}
+			f64_ns = (float64_t)(timer_ticks() - ui64_tick_start) * f64_timer_ns_per_tick;
+			f32_keep = f32_sink;
+			if ((f64_ns > 0.0) && ((f64_flop / f64_ns) > pst_roof->af64_peak_gflops[e_roof]))
+			{
+				pst_roof->af64_peak_gflops[e_roof] = f64_flop / f64_ns;
 			}
-			ui32_idx_b_ref += ui32_n;
 		}
-
-		// Evaluation of the ES (A value)
-		Twos_Checksum_a += (uint32_t) * (uint32_t*)&f32_a_part;
-		Twos_Checksum_a = (~Twos_Checksum_a) + 1;
-
-		// Evaluation of the ES (B value)
-		m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
-		m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
-		m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
-
-		// Evaluation of the ES (C value)
-		m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
-		m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
-		m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
-
-		ui32_idx_c_ref += ui32_n;
 	}
-	Twos_Checksum = Twos_Checksum_a;
-
-	m256i_twos = _mm256_add_epi32(m256i_twos_b, m256i_twos_c);
-	m256i_twos = _mm256_xor_si256(m256i_twos, m256i_Ones);
-	m256i_twos = _mm256_add_epi32(m256i_twos, m256i_singleOne);
 
-	uint32_t val[8];
-	memcpy(val, &m256i_twos, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	/* 2. Bandwidth: triad on arrays larger than the caches, first touched by the threads that use them */
+	pst_roof->f64_bw_gbs = 0.0;
+	paf32_a = (float32_t*)mem_alloc_aligned(ROOF_STREAM_ELEMS * sizeof(float32_t));
+	paf32_b = (float32_t*)mem_alloc_aligned(ROOF_STREAM_ELEMS * sizeof(float32_t));
+	paf32_c = (float32_t*)mem_alloc_aligned(ROOF_STREAM_ELEMS * sizeof(float32_t));
+	if ((paf32_a != NULL) && (paf32_b != NULL) && (paf32_c != NULL))
 	{
-		/* Two's complement checksum */
-		Twos_Checksum += (uint32_t) * (uint32_t*)&val[ui32_idx_i];
-		Twos_Checksum = (~Twos_Checksum) + 1;
+#pragma omp parallel for schedule(static) num_threads(i32_threads)
+		for (i64_idx = 0; i64_idx < (int64_t)ROOF_STREAM_ELEMS; i64_idx++)
+		{
+			paf32_a[i64_idx] = 0.0f;
+			paf32_b[i64_idx] = 1.0f;
+			paf32_c[i64_idx] = 2.0f;
+		}
+		for (ui32_rep = 0u; ui32_rep < ROOF_REPEAT; ui32_rep++)
+		{
+			ui64_tick_start = timer_ticks();
+#pragma omp parallel for schedule(static) num_threads(i32_threads)
+			for (i64_idx = 0; i64_idx < (int64_t)ROOF_STREAM_ELEMS; i64_idx++)
+			{
+				paf32_a[i64_idx] = paf32_b[i64_idx] + (3.0f * paf32_c[i64_idx]);
+			}
+			f64_ns = (float64_t)(timer_ticks() - ui64_tick_start) * f64_timer_ns_per_tick;
+			if ((f64_ns > 0.0) && (((3.0 * sizeof(float32_t) * (float64_t)ROOF_STREAM_ELEMS) / f64_ns) > pst_roof->f64_bw_gbs))
+			{
+				pst_roof->f64_bw_gbs = (3.0 * sizeof(float32_t) * (float64_t)ROOF_STREAM_ELEMS) / f64_ns;
+			}
+		}
+		f32_keep = paf32_a[ROOF_STREAM_ELEMS / 2u];
 	}
-	return Twos_Checksum;
+	else
+	{
+		printf("\n ---> Not enough memory for the bandwidth microbenchmark, roofline without memory ceiling");
+	}
+	(void)f32_keep;
+	mem_free_aligned(paf32_a);
+	mem_free_aligned(paf32_b);
+	mem_free_aligned(paf32_c);
 }
 
 /*==============================================================================================================
-**									Name: smm_intel_twos_intermediate
+**									Name: roofline_isa
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the intermediate loop
+** @brief Instruction set of the compute ceiling of a technique: the widest one of the implementation selected by
+** 		  smm_dispatch_techniques (ui32_isa of apst_tech_impl). Portable C techniques are under the SSE peak.
 **
-** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
-** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
-** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha Correction factor
-** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] e_tech 	Technique
 **
-** @return uint32_t  	ui32_twos	Return the Execution signature of the MMM
+** @return e_roof_isa  	Peak of the technique in roofline_t
 ==============================================================================================================*/
-static uint32_t smm_intel_twos_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static e_roof_isa roofline_isa(e_enum_technique e_tech)
 {
-	/* Twos checksum */
-	__m256i m256i_twos_b = _mm256_setzero_si256(),
-		m256i_twos_c = _mm256_setzero_si256(),
-		m256i_twos;
-
-	/* Two's complement checksum */
-	uint32_t Twos_Checksum_a = 0u,
-		Twos_Checksum_b = 0u,
-		Twos_Checksum_c = 0u,
-		Twos_Checksum = 0u;
+	e_roof_isa e_roof = e_ROOF_SSE;
 
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
-	__m256i m256i_singleOne = _mm256_set1_epi32(1);
+	if (apst_tech_impl[e_tech] != NULL)
+	{
+		if ((apst_tech_impl[e_tech]->ui32_isa & e_ISA_AVX512F) != 0u)
+		{
+			e_roof = e_ROOF_AVX512;
+		}
+		else if ((apst_tech_impl[e_tech]->ui32_isa & e_ISA_AVX2) != 0u)
+		{
+			e_roof = e_ROOF_AVX2;
+		}
+	}
+	return e_roof;
+}
 
-	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
+/*==============================================================================================================
+**									Name: roofline_peak_sse
+==============================================================================================================*/
+/*!
+** @brief Peak loops of roofline_measure: ui64_iter x ROOF_MADD_ACC independent multiply-accumulates
+** 		  acc = acc x 0.9999999 + 1e-7 (no overflow nor denormals), 4, 8 or 16 lanes. The baseline (SSE) has
+** 		  no FMA: MUL + ADD.
+**
+** @param[in] ui64_iter 	Iterations
+**
+** @return float32_t  	Sum of the accumulators (keeps the loop)
+==============================================================================================================*/
+static float32_t roofline_peak_sse(uint64_t ui64_iter)
+{
+	__m128 am128_acc[ROOF_MADD_ACC];
+	__m128 m128_mul = _mm_set1_ps(0.9999999f),
+		m128_add = _mm_set1_ps(1.0e-7f);
+	uint64_t ui64_it;
+	uint32_t ui32_acc;
 
-	uint32_t ui32_idx_i = 0u,
-		ui32_idx_j = 0u,
-		ui32_idx_k = 0u,
-		ui32_idx_a = 0u,
-		ui32_idx_b = 0u,
-		ui32_idx_c = 0u,
-		ui32_idx_b_ref = 0u,
-		ui32_idx_c_ref = 0u;
+	for (ui32_acc = 0u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
+	{
+		am128_acc[ui32_acc] = _mm_set1_ps((float32_t)ui32_acc);
+	}
+	for (ui64_it = 0u; ui64_it < ui64_iter; ui64_it++)
+	{
+		for (ui32_acc = 0u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
+		{
+			am128_acc[ui32_acc] = _mm_add_ps(_mm_mul_ps(am128_acc[ui32_acc], m128_mul), m128_add);
+		}
+	}
+	for (ui32_acc = 1u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
+	{
+		am128_acc[0u] = _mm_add_ps(am128_acc[0u], am128_acc[ui32_acc]);
+	}
+	return _mm_cvtss_f32(am128_acc[0u]);
+}
 
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
+static TARGET_AVX2 float32_t roofline_peak_avx2(uint64_t ui64_iter)
+{
+	__m256 am256_acc[ROOF_MADD_ACC];
+	__m256 m256_mul = _mm256_set1_ps(0.9999999f),
+		m256_add = _mm256_set1_ps(1.0e-7f);
+	uint64_t ui64_it;
+	uint32_t ui32_acc;
 
-	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	for (ui32_acc = 0u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
 	{
-		ui32_idx_b_ref = 0u;
-		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		am256_acc[ui32_acc] = _mm256_set1_ps((float32_t)ui32_acc);
+	}
+	/* Loop selected outside, as the variants of the kernels (SMM_MADD_VARIANTS) */
+	if (b32_use_fma)
+	{
+		for (ui64_it = 0u; ui64_it < ui64_iter; ui64_it++)
 		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
-
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			for (ui32_acc = 0u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
 			{
-				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
-				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
-				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+				am256_acc[ui32_acc] = _mm256_fmadd_ps(am256_acc[ui32_acc], m256_mul, m256_add);
 			}
-
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-				}
+		}
+	}
+	else
+	{
+		for (ui64_it = 0u; ui64_it < ui64_iter; ui64_it++)
+		{
+			for (ui32_acc = 0u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
+			{
+				am256_acc[ui32_acc] = _mm256_add_ps(_mm256_mul_ps(am256_acc[ui32_acc], m256_mul), m256_add);
 			}
+		}
+	}
+	for (ui32_acc = 1u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
+	{
+		am256_acc[0u] = _mm256_add_ps(am256_acc[0u], am256_acc[ui32_acc]);
+	}
+	return _mm256_cvtss_f32(am256_acc[0u]);
+}
 
-			// Evaluation of the ES (A value)
-			Twos_Checksum_a += (uint32_t) * (uint32_t*)&f32_a_part;
-			Twos_Checksum_a = (~Twos_Checksum_a) + 1;
-
-			// Evaluation of the ES (B value)
-			m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
-			m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
-			m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
-
-			// Evaluation of the ES (C value)
-			m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
-			m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
-			m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
+static TARGET_AVX512 float32_t roofline_peak_avx512(uint64_t ui64_iter)
+{
+	__m512 am512_acc[ROOF_MADD_ACC];
+	__m512 m512_mul = _mm512_set1_ps(0.9999999f),
+		m512_add = _mm512_set1_ps(1.0e-7f);
+	uint64_t ui64_it;
+	uint32_t ui32_acc;
 
-			ui32_idx_b_ref += ui32_n;
+	for (ui32_acc = 0u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
+	{
+		am512_acc[ui32_acc] = _mm512_set1_ps((float32_t)ui32_acc);
+	}
+	if (b32_use_fma)
+	{
+		for (ui64_it = 0u; ui64_it < ui64_iter; ui64_it++)
+		{
+			for (ui32_acc = 0u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
+			{
+				am512_acc[ui32_acc] = _mm512_fmadd_ps(am512_acc[ui32_acc], m512_mul, m512_add);
+			}
 		}
-		ui32_idx_c_ref += ui32_n;
 	}
-	Twos_Checksum += Twos_Checksum_b + Twos_Checksum_a;
-	Twos_Checksum = (~Twos_Checksum) + 1;
-	Twos_Checksum += Twos_Checksum_c;
-	Twos_Checksum = (~Twos_Checksum) + 1;
+	else
+	{
+		for (ui64_it = 0u; ui64_it < ui64_iter; ui64_it++)
+		{
+			for (ui32_acc = 0u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
+			{
+				am512_acc[ui32_acc] = _mm512_add_ps(_mm512_mul_ps(am512_acc[ui32_acc], m512_mul), m512_add);
+			}
+		}
+	}
+	for (ui32_acc = 1u; ui32_acc < ROOF_MADD_ACC; ui32_acc++)
+	{
+		am512_acc[0u] = _mm512_add_ps(am512_acc[0u], am512_acc[ui32_acc]);
+	}
+	return _mm512_cvtss_f32(am512_acc[0u]);
+}
 
-	m256i_twos = _mm256_add_epi32(m256i_twos_b, m256i_twos_c);
-	m256i_twos = _mm256_xor_si256(m256i_twos, m256i_Ones);
-	m256i_twos = _mm256_add_epi32(m256i_twos, m256i_singleOne);
+/*==============================================================================================================
+**									Name: smm_dispatch_techniques
+==============================================================================================================*/
+/*!
+** @brief Fill ptr_fn_smm_technique with the best implementation of each technique supported by the CPU
+** 		  (first entry of ast_smm_impl whose instruction sets are available). Techniques without a supported
+** 		  implementation are removed from the selection instead of being executed (SIGILL). The FMA or the
+** 		  mul + add variant of the implementation is selected here with b32_use_fma, once for all the calls.
+**
+** @param[in] ui32_isa 				Instruction sets available (e_isa_flag mask)
+** @param[in,out] ab32_selected_tech	Techniques selected by the user
+==============================================================================================================*/
+static void_t smm_dispatch_techniques(uint32_t ui32_isa, bool32_t ab32_selected_tech[TECH_MAX])
+{
+	e_enum_technique e_tech;
+	uint32_t ui32_idx;
+	const smm_impl_t *p_impl;
 
-	uint32_t val[8];
-	memcpy(val, &m256i_twos, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	for (e_tech = TECH_NONE; e_tech < TECH_MAX; e_tech++)
 	{
-		/* Two's complement checksum */
-		Twos_Checksum += val[ui32_idx_i];
-		Twos_Checksum = (~Twos_Checksum) + 1;
+		bool32_t b32_registered = FALSE;
+		p_impl = NULL;
+		for (ui32_idx = 0u; ui32_idx < (sizeof(ast_smm_impl) / sizeof(ast_smm_impl[0u])); ui32_idx++)
+		{
+			if (ast_smm_impl[ui32_idx].e_tech == e_tech)
+			{
+				b32_registered = TRUE;
+				if ((p_impl == NULL) && ((ast_smm_impl[ui32_idx].ui32_isa & ~ui32_isa) == 0u))
+				{
+					p_impl = &ast_smm_impl[ui32_idx];
+				}
+			}
+		}
+		if (b32_registered)
+		{
+			ptr_fn_smm_technique[e_tech] = (p_impl == NULL) ? NULL : (b32_use_fma ? p_impl->ptr_fn : p_impl->ptr_fn_mul_add);
+			apst_tech_impl[e_tech] = p_impl;
+			aptr_fn_smm_shard[e_tech] = (p_impl == NULL) ? NULL : (b32_use_fma ? p_impl->ptr_fn_shard : p_impl->ptr_fn_shard_mul_add);
+			if ((p_impl == NULL) && ab32_selected_tech[e_tech])
+			{
+				printf("\n ---> %s has no implementation for the available instruction sets, skipped", pstr_technique[e_tech]);
+				ab32_selected_tech[e_tech] = FALSE;
+			}
+		}
 	}
-
-	return Twos_Checksum;
 }
 
 /*==============================================================================================================
-**									Name: smm_intel_twos_internal
+**									Name: smm_execute
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
+** @brief Execute a technique. Without -threads, and for the techniques whose signature state has no exact merge
+** 		  (e_SHARD_MERGE_SERIAL), the serial kernel is executed. Otherwise its rows are split in shards executed
+** 		  by ui32_omp_threads threads and the signature states of the shards are merged in row order
+** 		  (smm_par_shards): the ES and C are the ones of the serial kernel. Multi-threaded techniques (PAR_*)
+** 		  and the portable C techniques are executed directly.
 **
+** @param[in] e_tech 		Technique
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
 ** @param[in] f32_alpha		Correction factor
 ** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
 ** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
 **
-** @return uint32_t  	ui32_twos	Return the Execution signature of the MMM
+** @return uint32_t  	Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_twos_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static uint32_t smm_execute(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
 {
-	/* Twos checksum */
-	__m256i m256i_twos_a= _mm256_setzero_si256(),
-		m256i_twos_b = _mm256_setzero_si256(),
-		m256i_twos_c = _mm256_setzero_si256(),
-		m256i_twos = _mm256_setzero_si256();
-
-	/* Two's complement checksum */
-	uint32_t Twos_Checksum_a = 0u,
-		Twos_Checksum_b = 0u,
-		Twos_Checksum_c = 0u,
-		Twos_Checksum = 0u;
+	if ((ui32_omp_threads == 0u) || (apst_tech_impl[e_tech] == NULL) || (apst_tech_impl[e_tech]->e_merge == e_SHARD_MERGE_SERIAL) || (apst_tech_impl[e_tech]->e_merge == e_SHARD_MERGE_MAX))
+	{
+		return ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+	}
+	return smm_par_shards(e_tech, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+}
 
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
-	__m256i m256i_singleOne = _mm256_set1_epi32(1);
-
-	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
-
-	uint32_t ui32_idx_i = 0u,
-		ui32_idx_j = 0u,
-		ui32_idx_k = 0u,
-		ui32_idx_a = 0u,
-		ui32_idx_b = 0u,
-		ui32_idx_c = 0u,
-		ui32_idx_b_ref = 0u,
-		ui32_idx_c_ref = 0u;
-
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
-	uint32_t val[8];
+/*==============================================================================================================
+**									Name: smm_par_shards
+==============================================================================================================*/
+/*!
+** @brief Multi-threaded MMM of a SIMD technique with the execution signature of its serial kernel: the shard
+** 		  states of smm_shard_states are merged in row order (smm_shard_merge) and finalized (smm_shard_final).
+** 		  The state buffer is allocated once and only grows with the MMM.
+**
+** @param[in] e_tech 		Technique (e_merge of its implementation: XOR, SUM, CRC or AVX512)
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static uint32_t smm_par_shards(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+{
+	const e_shard_merge e_merge = apst_tech_impl[e_tech]->e_merge;
+	const uint32_t ui32_n_shards = (ui32_m + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS;
+	smm_shard_sig_t st_acc;
+	uint32_t ui32_idx;
 
-	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	if (ui32_n_shards > ui32_shard_sig_max)
 	{
-		ui32_idx_b_ref = 0u;
-		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
-		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
+		free(past_shard_sig);
+		past_shard_sig = (smm_shard_sig_t*)malloc(ui32_n_shards * sizeof(smm_shard_sig_t));
+		assert(past_shard_sig != NULL);
+		ui32_shard_sig_max = ui32_n_shards;
+	}
 
+	smm_shard_states(e_tech, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, past_shard_sig);
+	smm_shard_init(e_merge, &st_acc);
+	for (ui32_idx = 0u; ui32_idx < ui32_n_shards; ui32_idx++)
+	{
+		smm_shard_merge(e_merge, &st_acc, &past_shard_sig[ui32_idx]);
+	}
+	return smm_shard_final(e_merge, &st_acc, ui32_m, ui32_k, f32_alpha, paf32_ma);
+}
 
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
-			{
-				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
-				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
+/*==============================================================================================================
+**									Name: smm_shard_states
+==============================================================================================================*/
+/*!
+** @brief Signature states of the row shards of a MMM (SMM_OMP_ROWS rows, the last one takes the remaining rows),
+** 		  executed in parallel (OpenMP, ui32_omp_threads threads, 1 if 0). A shard is the MMM of its rows of A and
+** 		  C with the whole B, started from a zero signature state.
+**
+** @param[in] e_tech 		Technique
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] past_sig 	Signature state of each shard, in row order
+==============================================================================================================*/
+static void_t smm_shard_states(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const past_sig)
+{
+	const int32_t i32_threads = (ui32_omp_threads != 0u) ? (int32_t)ui32_omp_threads : 1;
+	const uint32_t ui32_n_shards = (ui32_m + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS;
+	int32_t i32_shard;
 
-				result256 = _mm256_add_ps(result256, c256);
-				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+#pragma omp parallel for schedule(dynamic, 1) num_threads(i32_threads)
+	for (i32_shard = 0; i32_shard < (int32_t)ui32_n_shards; i32_shard++)
+	{
+		uint32_t ui32_row = (uint32_t)i32_shard * SMM_OMP_ROWS;
+		uint32_t ui32_rows = ((ui32_m - ui32_row) < SMM_OMP_ROWS) ? (ui32_m - ui32_row) : SMM_OMP_ROWS;
+		smm_shard_run(e_tech, ui32_rows, ui32_n, ui32_k, f32_alpha, &paf32_ma[(size_t)ui32_row * ui32_k], paf32_mb, &paf32_mc[(size_t)ui32_row * ui32_n], &past_sig[i32_shard]);
+	}
+}
 
-				// Evaluation of the ES (B value)
-				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
-				m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
-				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
+/*==============================================================================================================
+**									Name: smm_shard_run
+==============================================================================================================*/
+/*!
+** @brief Signature state of one row shard: the shard function of the technique (e_SHARD_MERGE_CRC / _AVX512), or
+** 		  the ES of its kernel on the rows of the shard (e_SHARD_MERGE_XOR / _SUM: the ES is linear in the rows)
+**
+** @param[in] e_tech 		Technique
+** @param[in] ui32_m 		Number of rows of the shard
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		First row of A of the shard
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		First row of C of the shard
+** @param[out] pst_sig 		Signature state of the shard
+==============================================================================================================*/
+static void_t smm_shard_run(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig)
+{
+	if (aptr_fn_smm_shard[e_tech] != NULL)
+	{
+		aptr_fn_smm_shard[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, pst_sig);
+	}
+	else
+	{
+		memset(pst_sig, 0, sizeof(*pst_sig));
+		pst_sig->ui32_es = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+	}
+}
 
-				// Evaluation of the ES (C value)
-				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
-				m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
-				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
-			}
+/*==============================================================================================================
+**									Name: smm_shard_init
+==============================================================================================================*/
+/*!
+** @brief Signature state of zero rows, the state that the shards are merged into (smm_shard_merge). The CRC chains
+** 		  start at INITIAL_REMAINDER, the folded B and C streams of the AVX-512 techniques at 0.
+**
+** @param[in] e_merge 		Merge of the technique
+** @param[out] pst_acc 		Signature state
+==============================================================================================================*/
+static void_t smm_shard_init(e_shard_merge e_merge, smm_shard_sig_t * const pst_acc)
+{
+	memset(pst_acc, 0, sizeof(*pst_acc));
+	pst_acc->aui32_crc[e_CRC_STREAM_A] = INITIAL_REMAINDER;
+	if (e_merge == e_SHARD_MERGE_CRC)
+	{
+		pst_acc->aui32_crc[e_CRC_STREAM_B] = INITIAL_REMAINDER;
+		pst_acc->aui32_crc[e_CRC_STREAM_C] = INITIAL_REMAINDER;
+	}
+}
 
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* Twos checksum */
-					// Evaluation of the ES (B value)
-					Twos_Checksum_b += (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Twos_Checksum_b = (~Twos_Checksum_b) + 1;
-					// Evaluation of the ES (C value)
-					Twos_Checksum_c += (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-					Twos_Checksum_c = (~Twos_Checksum_c) + 1;
-				}
-			}
-			// Evaluation of the ES (A value)
-			Twos_Checksum_a += (uint32_t) * (uint32_t*)&f32_a_part;
-			Twos_Checksum_a = (~Twos_Checksum_a) + 1;
+/*==============================================================================================================
+**									Name: smm_shard_merge
+==============================================================================================================*/
+/*!
+** @brief Append the signature state of the next rows to the state of the previous ones: XOR / sum of the ES,
+** 		  crc32c_combine of the CRC chains, smm_avx512_shard_merge of the AVX-512 signature lanes
+**
+** @param[in] e_merge 		Merge of the technique
+** @param[in,out] pst_acc 	Signature state of the previous rows
+** @param[in] pst_sig 		Signature state of the next rows
+==============================================================================================================*/
+static void_t smm_shard_merge(e_shard_merge e_merge, smm_shard_sig_t * const pst_acc, const smm_shard_sig_t * const pst_sig)
+{
+	uint32_t ui32_idx;
 
-			ui32_idx_b_ref += ui32_n;
-		}
-		ui32_idx_c_ref += ui32_n;
-	}
-	if (0 != prev_end)
+	switch (e_merge)
 	{
-		Twos_Checksum = Twos_Checksum_b + Twos_Checksum_a;
-		Twos_Checksum = (~Twos_Checksum) + 1;
-		Twos_Checksum += Twos_Checksum_c;
-		Twos_Checksum = (~Twos_Checksum) + 1;
+	case e_SHARD_MERGE_XOR:
+		pst_acc->ui32_es ^= pst_sig->ui32_es;
+		break;
+	case e_SHARD_MERGE_SUM:
+		pst_acc->ui32_es += pst_sig->ui32_es;
+		break;
+	case e_SHARD_MERGE_CRC:
+		for (ui32_idx = 0u; ui32_idx < e_CRC_STREAM_MAX; ui32_idx++)
+		{
+			pst_acc->aui32_crc[ui32_idx] = crc32c_combine(pst_acc->aui32_crc[ui32_idx], pst_sig->aui32_crc[ui32_idx], pst_sig->aui64_len[ui32_idx]);
+		}
+		break;
+	case e_SHARD_MERGE_AVX512:
+		smm_avx512_shard_merge(pst_acc, pst_sig);
+		break;
+	default:
+		break;
 	}
-	else
+	for (ui32_idx = 0u; ui32_idx < e_CRC_STREAM_MAX; ui32_idx++)
 	{
-		Twos_Checksum = Twos_Checksum_a;
+		pst_acc->aui64_len[ui32_idx] += pst_sig->aui64_len[ui32_idx];
 	}
-	m256i_twos = _mm256_add_epi32(m256i_twos_b, m256i_twos_c);
-	m256i_twos = _mm256_xor_si256(m256i_twos, m256i_Ones);
-	m256i_twos = _mm256_add_epi32(m256i_twos, m256i_singleOne);
+}
 
-	memcpy(val, &m256i_twos, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+/*==============================================================================================================
+**									Name: smm_shard_final
+==============================================================================================================*/
+/*!
+** @brief Execution signature of the merged signature state of all the rows of a MMM
+**
+** @param[in] e_merge 		Merge of the technique
+** @param[in] pst_acc 		Signature state of all the rows
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		A of the MMM (Fletcher checksum of A of the AVX-512 techniques)
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static uint32_t smm_shard_final(e_shard_merge e_merge, const smm_shard_sig_t * const pst_acc, uint32_t ui32_m, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma)
+{
+	uint32_t ui32_es;
+
+	switch (e_merge)
 	{
-		/* Two's complement checksum */
-		Twos_Checksum += val[ui32_idx_i];
-		Twos_Checksum = (~Twos_Checksum) + 1;
+	case e_SHARD_MERGE_CRC:
+		ui32_es = singletable_crc32c_ui32(pst_acc->aui32_crc[e_CRC_STREAM_A], pst_acc->aui32_crc[e_CRC_STREAM_B]);
+		ui32_es = singletable_crc32c_ui32(ui32_es, pst_acc->aui32_crc[e_CRC_STREAM_C]);
+		break;
+	case e_SHARD_MERGE_AVX512:
+		ui32_es = smm_avx512_shard_final(pst_acc, ui32_m, ui32_k, f32_alpha, paf32_ma);
+		break;
+	default:
+		ui32_es = pst_acc->ui32_es;
+		break;
 	}
+	return ui32_es;
+}
 
-	return Twos_Checksum;
+/*==============================================================================================================
+**									Name: smm_fi_delta_supported
+==============================================================================================================*/
+/*!
+** @brief Delta re-execution of the faults in A (see smm_fi_delta_a) is exact for the techniques whose signature
+** 		  state has an exact merge of row shards (smm_shard_merge): a fault in A[i][k] only changes the shard of
+** 		  row i, the states of the other shards are the golden ones.
+**
+** @param[in] e_tech 	Technique
+**
+** @return bool32_t  	TRUE if the faults in A of this technique can be executed with smm_fi_delta_a
+==============================================================================================================*/
+static bool32_t smm_fi_delta_supported(e_enum_technique e_tech)
+{
+	return ((apst_tech_impl[e_tech] != NULL) && (apst_tech_impl[e_tech]->e_merge != e_SHARD_MERGE_SERIAL) && (apst_tech_impl[e_tech]->e_merge != e_SHARD_MERGE_MAX)) ? TRUE : FALSE;
 }
 
 /*==============================================================================================================
-**									Name: smm_intel_ones_external
+**									Name: smm_fi_delta_b_supported
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the external loop
+** @brief Delta re-execution of the faults in B (see smm_fi_delta_b) is exact for the kernels whose ES is the XOR
+** 		  or the sum of the ES of the MMMs of their column slices (e_col_merge): a fault in B[k][j] only changes
+** 		  column j of C, the other slices sign the golden B and C.
+**
+** @param[in] e_tech 	Technique
+** @param[in] ui32_n 	Number of matrix B columns (at least one slice)
 **
+** @return bool32_t  	TRUE if the faults in B of this technique can be executed with smm_fi_delta_b
+==============================================================================================================*/
+static bool32_t smm_fi_delta_b_supported(e_enum_technique e_tech, uint32_t ui32_n)
+{
+	return ((apst_tech_impl[e_tech] != NULL) && (apst_tech_impl[e_tech]->e_col_merge != e_SHARD_MERGE_SERIAL) && (ui32_n >= apst_tech_impl[e_tech]->ui32_col_slice)) ? TRUE : FALSE;
+}
+
+/*==============================================================================================================
+**									Name: smm_fi_golden
+==============================================================================================================*/
+/*!
+** @brief Golden execution of a delta campaign: same signature and C as the serial kernel, plus the snapshots that
+** 		  smm_fi_delta_a merges a faulty shard into: C before the MMM, the state of every shard, the merge of
+** 		  the shards before each shard (prefix) and of each shard with the next ones (suffix). With
+** 		  smm_fi_delta_b_supported, the ES of each column slice (smm_fi_slice) for smm_fi_delta_b.
+**
+** @param[in] e_tech 		Technique (smm_fi_delta_supported or smm_fi_delta_b_supported)
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
 ** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in,out] paf32_mc 	Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] paf32_mc_in 	Copy of C before the MMM (ui32_m x ui32_n)
+** @param[out] pst_golden 	Shard states of the golden execution (arrays of (ui32_m + SMM_OMP_ROWS - 1) / SMM_OMP_ROWS)
+** 							and ES of the column slices (ui32_n / ui32_col_slice)
+** @param[in] pst_scratch 	Scratch buffers of the column slices
 **
-** @return __m256  	m256_ones	Return the Execution signature of the MMM
+** @return uint32_t  	Golden execution signature
 ==============================================================================================================*/
-static uint32_t smm_intel_ones_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static uint32_t smm_fi_golden(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, float32_t * const paf32_mc_in, smm_fi_golden_t * const pst_golden, const smm_fi_scratch_t * const pst_scratch)
 {
-	// Variables to store the ES
-	__m256i  Ones_checksum_b_hi = _mm256_setzero_si256(),
-		Ones_checksum_b_lo = _mm256_setzero_si256(),
-		Ones_checksum_c_hi = _mm256_setzero_si256(),
-		Ones_checksum_c_lo = _mm256_setzero_si256();
-
-	__m256i b_aux_lo, b_aux_hi,
-		c_aux_lo, c_aux_hi,
-		m256i_zeros = _mm256_setzero_si256();
+	const e_shard_merge e_merge = apst_tech_impl[e_tech]->e_merge;
+	const uint32_t ui32_n_shards = (ui32_m + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS;
+	smm_shard_sig_t st_acc;
+	uint32_t ui32_idx;
 
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
-	__m256 a256, b256, c256, result256;    // AVX
+	memcpy(paf32_mc_in, paf32_mc, (size_t)ui32_m * ui32_n * sizeof(float32_t));
+	pst_golden->ui32_n_slices = 0u;
+	if (smm_fi_delta_b_supported(e_tech, ui32_n))
+	{
+		pst_golden->ui32_n_slices = ui32_n / apst_tech_impl[e_tech]->ui32_col_slice;
+		for (ui32_idx = 0u; ui32_idx < pst_golden->ui32_n_slices; ui32_idx++)
+		{
+			pst_golden->paui32_slice[ui32_idx] = smm_fi_slice(e_tech, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc_in, ui32_idx, pst_scratch);
+		}
+	}
+	if (smm_fi_delta_supported(e_tech) == FALSE)
+	{
+		/* Faults in B only: the golden execution is the serial kernel */
+		pst_golden->ui32_n_shards = 0u;
+		pst_golden->ui32_es = ptr_fn_smm_technique[e_tech](ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+		return pst_golden->ui32_es;
+	}
 
-	uint32_t ui32_idx_i = 0u,
-		ui32_idx_j = 0u,
-		ui32_idx_k = 0u,
-		ui32_idx_a = 0u,
-		ui32_idx_b = 0u,
-		ui32_idx_c = 0u,
-		ui32_idx_b_ref = 0u,
-		ui32_idx_c_ref = 0u;
+	smm_shard_states(e_tech, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, pst_golden->past_shard);
+	pst_golden->ui32_n_shards = ui32_n_shards;
 
-	/* One's complement checksum */
-	ui64_to_ui32_t Ones_Checksum_a,
-		Ones_Checksum_b,
-		Ones_Checksum_c,
-		Ones_Checksum;
+	smm_shard_init(e_merge, &st_acc);
+	for (ui32_idx = 0u; ui32_idx < ui32_n_shards; ui32_idx++)
+	{
+		pst_golden->past_prefix[ui32_idx] = st_acc;
+		smm_shard_merge(e_merge, &st_acc, &pst_golden->past_shard[ui32_idx]);
+	}
+	pst_golden->ui32_es = smm_shard_final(e_merge, &st_acc, ui32_m, ui32_k, f32_alpha, paf32_ma);
 
-	Ones_Checksum_a.ui64 = 0u;
-	Ones_Checksum_b.ui64 = 0u;
-	Ones_Checksum_c.ui64 = 0u;
-	Ones_Checksum.ui64 = 0u;
+	for (ui32_idx = ui32_n_shards; ui32_idx > 0u; ui32_idx--)
+	{
+		pst_golden->past_suffix[ui32_idx - 1u] = pst_golden->past_shard[ui32_idx - 1u];
+		if (ui32_idx < ui32_n_shards)
+		{
+			smm_shard_merge(e_merge, &pst_golden->past_suffix[ui32_idx - 1u], &pst_golden->past_suffix[ui32_idx]);
+		}
+	}
+	return pst_golden->ui32_es;
+}
 
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
+/*==============================================================================================================
+**									Name: smm_fi_delta_a
+==============================================================================================================*/
+/*!
+** @brief Execution signature of the MMM with faults in A, from the checkpoints of the golden execution: the
+** 		  golden state of every row shard (smm_fi_golden). A fault in A[i][k] only changes the shard of row i, so
+** 		  the shards whose rows of A are the golden ones are not executed. The faulty shards are executed (from
+** 		  the golden C) and merged from the golden prefix of the first one, and the run stops at the checkpoint
+** 		  after the last one: the golden suffix gives the state of the full faulty MMM. When every faulty shard
+** 		  has its golden state, the ES is the golden one without the merge, except for the Fletcher checksum of A
+** 		  of the AVX-512 techniques, which is not in the state.
+**
+** @param[in] e_tech 		Technique (smm_fi_delta_supported)
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of the golden A matrix
+** @param[in] paf32_ma_fi 	Pointer to the first position of the faulty A matrix
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc_in 	C before the golden MMM (smm_fi_golden)
+** @param[in] pst_golden 	Shard states of the golden execution (smm_fi_golden)
+** @param[in] pst_scratch 	Scratch buffers (C of the shard)
+**
+** @return uint32_t  	Execution signature of the faulty MMM
+==============================================================================================================*/
+static uint32_t smm_fi_delta_a(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_ma_fi, const float32_t * const paf32_mb, const float32_t * const paf32_mc_in, const smm_fi_golden_t * const pst_golden, const smm_fi_scratch_t * const pst_scratch)
+{
+	const e_shard_merge e_merge = apst_tech_impl[e_tech]->e_merge;
+	const uint32_t ui32_n_shards = pst_golden->ui32_n_shards;
+	uint32_t ui32_shard,
+		ui32_first = ui32_n_shards,
+		ui32_last = 0u,
+		ui32_row_0,
+		ui32_rows;
+	bool32_t b32_golden_state = TRUE;
+	smm_shard_sig_t st_sig,
+		st_acc;
+
+	/* Faulty shards: rows of A different from the golden ones */
+	for (ui32_shard = 0u; ui32_shard < ui32_n_shards; ui32_shard++)
+	{
+		ui32_row_0 = ui32_shard * SMM_OMP_ROWS;
+		ui32_rows = ((ui32_m - ui32_row_0) < SMM_OMP_ROWS) ? (ui32_m - ui32_row_0) : SMM_OMP_ROWS;
+		if (memcmp(&paf32_ma[(size_t)ui32_row_0 * ui32_k], &paf32_ma_fi[(size_t)ui32_row_0 * ui32_k], (size_t)ui32_rows * ui32_k * sizeof(float32_t)) != 0)
+		{
+			ui32_first = (ui32_first < ui32_n_shards) ? ui32_first : ui32_shard;
+			ui32_last = ui32_shard;
+		}
+	}
+	if (ui32_first == ui32_n_shards)
+	{
+		return pst_golden->ui32_es;
+	}
 
-	float f32_a_part;
-	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	st_acc = pst_golden->past_prefix[ui32_first];
+	for (ui32_shard = ui32_first; ui32_shard <= ui32_last; ui32_shard++)
 	{
-		ui32_idx_b_ref = 0u;
-		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		ui32_row_0 = ui32_shard * SMM_OMP_ROWS;
+		ui32_rows = ((ui32_m - ui32_row_0) < SMM_OMP_ROWS) ? (ui32_m - ui32_row_0) : SMM_OMP_ROWS;
+		if (memcmp(&paf32_ma[(size_t)ui32_row_0 * ui32_k], &paf32_ma_fi[(size_t)ui32_row_0 * ui32_k], (size_t)ui32_rows * ui32_k * sizeof(float32_t)) == 0)
 		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
+			smm_shard_merge(e_merge, &st_acc, &pst_golden->past_shard[ui32_shard]);
+			continue;
+		}
+		memcpy(pst_scratch->paf32_mc_part, &paf32_mc_in[(size_t)ui32_row_0 * ui32_n], (size_t)ui32_rows * ui32_n * sizeof(float32_t));
+		smm_shard_run(e_tech, ui32_rows, ui32_n, ui32_k, f32_alpha, &paf32_ma_fi[(size_t)ui32_row_0 * ui32_k], paf32_mb, pst_scratch->paf32_mc_part, &st_sig);
+		if (memcmp(&st_sig, &pst_golden->past_shard[ui32_shard], sizeof(st_sig)) != 0)
+		{
+			b32_golden_state = FALSE;
+		}
+		smm_shard_merge(e_merge, &st_acc, &st_sig);
+	}
+	if (b32_golden_state && (st_sig.e_inner != e_BLK_SIG_FLETCHER))
+	{
+		return pst_golden->ui32_es;
+	}
 
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
-			{
-				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
-				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
+	if ((ui32_last + 1u) < ui32_n_shards)
+	{
+		smm_shard_merge(e_merge, &st_acc, &pst_golden->past_suffix[ui32_last + 1u]);
+	}
+	return smm_shard_final(e_merge, &st_acc, ui32_m, ui32_k, f32_alpha, paf32_ma_fi);
+}
 
-				result256 = _mm256_add_ps(result256, c256);
-				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
-			}
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-				}
-			}
-			ui32_idx_b_ref += ui32_n;
-		}
-		// Evaluation of the ES (A value)
-		Ones_Checksum_a.ui64 += (uint64_t) * ((uint32_t*)&f32_a_part);
-		Ones_Checksum_a.ui32[0] += Ones_Checksum_a.ui32[1];
-		Ones_Checksum_a.ui32[0] = ~Ones_Checksum_a.ui32[0];
+/*==============================================================================================================
+**									Name: smm_fi_slice
+==============================================================================================================*/
+/*!
+** @brief MMM of column slice ui32_slice of B and C (ui32_col_slice columns, the last slice takes the remaining
+** 		  columns) on copies of the slice, with the kernel of the technique. The slices start on a multiple of
+** 		  ui32_col_slice, so every element keeps the signature lane it has in the MMM of the whole matrices.
+**
+** @param[in] e_tech 		Technique (smm_fi_delta_b_supported)
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc_in 	C before the MMM
+** @param[in] ui32_slice 	Column slice [0…ui32_n / ui32_col_slice]
+** @param[in] pst_scratch 	Scratch buffers (B and C of the slice)
+**
+** @return uint32_t  	Execution signature of the MMM of the slice
+==============================================================================================================*/
+static uint32_t smm_fi_slice(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, const float32_t * const paf32_mc_in, uint32_t ui32_slice, const smm_fi_scratch_t * const pst_scratch)
+{
+	const uint32_t ui32_w = apst_tech_impl[e_tech]->ui32_col_slice;
+	const uint32_t ui32_col_0 = ui32_slice * ui32_w;
+	const uint32_t ui32_cols = ((ui32_slice + 1u) < (ui32_n / ui32_w)) ? ui32_w : (ui32_n - ui32_col_0);
+	uint32_t ui32_idx;
 
-		// Evaluation of the ES (B value)
-		b_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(b256), m256i_zeros);
-		Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, b_aux_hi);
-		Ones_checksum_b_hi = _mm256_hadd_epi32(Ones_checksum_b_hi, Ones_checksum_b_hi);
-		Ones_checksum_b_hi = _mm256_xor_si256(Ones_checksum_b_hi, m256i_Ones);
-		Ones_checksum_b_hi = _mm256_unpackhi_epi32(Ones_checksum_b_hi, m256i_zeros);
+	for (ui32_idx = 0u; ui32_idx < ui32_k; ui32_idx++)
+	{
+		memcpy(&pst_scratch->paf32_mb_part[(size_t)ui32_idx * ui32_cols], &paf32_mb[((size_t)ui32_idx * ui32_n) + ui32_col_0], ui32_cols * sizeof(float32_t));
+	}
+	for (ui32_idx = 0u; ui32_idx < ui32_m; ui32_idx++)
+	{
+		memcpy(&pst_scratch->paf32_mc_part[(size_t)ui32_idx * ui32_cols], &paf32_mc_in[((size_t)ui32_idx * ui32_n) + ui32_col_0], ui32_cols * sizeof(float32_t));
+	}
+	return ptr_fn_smm_technique[e_tech](ui32_m, ui32_cols, ui32_k, f32_alpha, paf32_ma, pst_scratch->paf32_mb_part, pst_scratch->paf32_mc_part);
+}
 
-		b_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(b256), m256i_zeros);
-		Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, b_aux_lo);
-		Ones_checksum_b_lo = _mm256_hadd_epi32(Ones_checksum_b_lo, Ones_checksum_b_lo);
-		Ones_checksum_b_lo = _mm256_xor_si256(Ones_checksum_b_lo, m256i_Ones);
-		Ones_checksum_b_lo = _mm256_unpackhi_epi32(Ones_checksum_b_lo, m256i_zeros);
+/*==============================================================================================================
+**									Name: smm_fi_delta_b
+==============================================================================================================*/
+/*!
+** @brief Execution signature of the MMM with faults in B: a fault in B[k][j] only changes column j of C, so only
+** 		  the column slices whose columns of B differ from the golden ones are executed again (smm_fi_slice), and
+** 		  the ES of each one replaces the golden ES of the slice in the golden ES of the MMM (XOR or difference of
+** 		  the sums, e_col_merge). The signature of A is the same in both slices and cancels.
+**
+** @param[in] e_tech 		Technique (smm_fi_delta_b_supported)
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of the golden B matrix
+** @param[in] paf32_mb_fi 	Pointer to the first position of the faulty B matrix
+** @param[in] paf32_mc_in 	C before the golden MMM (smm_fi_golden)
+** @param[in] pst_golden 	ES of the golden execution and of its column slices (smm_fi_golden)
+** @param[in] pst_scratch 	Scratch buffers (B and C of the slice)
+**
+** @return uint32_t  	Execution signature of the faulty MMM
+==============================================================================================================*/
+static uint32_t smm_fi_delta_b(e_enum_technique e_tech, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, const float32_t * const paf32_mb_fi, const float32_t * const paf32_mc_in, const smm_fi_golden_t * const pst_golden, const smm_fi_scratch_t * const pst_scratch)
+{
+	const uint32_t ui32_w = apst_tech_impl[e_tech]->ui32_col_slice;
+	uint32_t ui32_es = pst_golden->ui32_es,
+		ui32_es_slice,
+		ui32_slice,
+		ui32_col_0,
+		ui32_cols,
+		ui32_idx_k;
 
+	for (ui32_slice = 0u; ui32_slice < pst_golden->ui32_n_slices; ui32_slice++)
+	{
+		ui32_col_0 = ui32_slice * ui32_w;
+		ui32_cols = ((ui32_slice + 1u) < pst_golden->ui32_n_slices) ? ui32_w : (ui32_n - ui32_col_0);
+		for (ui32_idx_k = 0u; ui32_idx_k < ui32_k; ui32_idx_k++)
+		{
+			if (memcmp(&paf32_mb[((size_t)ui32_idx_k * ui32_n) + ui32_col_0], &paf32_mb_fi[((size_t)ui32_idx_k * ui32_n) + ui32_col_0], ui32_cols * sizeof(float32_t)) != 0)
+			{
+				break;
+			}
+		}
+		if (ui32_idx_k < ui32_k)
+		{
+			ui32_es_slice = smm_fi_slice(e_tech, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb_fi, paf32_mc_in, ui32_slice, pst_scratch);
+			ui32_es = (apst_tech_impl[e_tech]->e_col_merge == e_SHARD_MERGE_XOR) ? (ui32_es ^ pst_golden->paui32_slice[ui32_slice] ^ ui32_es_slice) :
+				((ui32_es - pst_golden->paui32_slice[ui32_slice]) + ui32_es_slice);
+		}
+	}
+	return ui32_es;
+}
 
-		// Evaluation of the ES (C value)
-		c_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(result256), m256i_zeros);
-		Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, c_aux_hi);
-		Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
-		Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
-		Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
+/*==============================================================================================================
+**									Name: smm_fi_campaign_alloc
+==============================================================================================================*/
+/*!
+** @brief Buffers of the delta re-executions of a campaign (-fi=delta|check) for the largest square size, allocated
+** 		  once for the campaign: golden checkpoints of the row shards and column slices (at least 8 columns), C
+** 		  before the golden MMM and the scratch buffers, which hold a shard of SMM_OMP_ROWS rows or a slice of less
+** 		  than 2 x 16 columns. Nothing is allocated with -fi=full.
+**
+** @param[out] pst_fi 	Delta state of the campaign
+==============================================================================================================*/
+static void_t smm_fi_campaign_alloc(smm_fi_campaign_t * const pst_fi)
+{
+	memset(pst_fi, 0, sizeof(*pst_fi));
+	if (e_fi_mode != e_FI_EXEC_FULL)
+	{
+		pst_fi->st_golden.past_shard = (smm_shard_sig_t*)malloc(((MAX_DIM + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS) * sizeof(smm_shard_sig_t));
+		pst_fi->st_golden.past_prefix = (smm_shard_sig_t*)malloc(((MAX_DIM + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS) * sizeof(smm_shard_sig_t));
+		pst_fi->st_golden.past_suffix = (smm_shard_sig_t*)malloc(((MAX_DIM + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS) * sizeof(smm_shard_sig_t));
+		pst_fi->st_golden.paui32_slice = (uint32_t*)malloc((MAX_DIM / 8u) * sizeof(uint32_t));
+		pst_fi->paf32_mc_in = (float32_t*)malloc(MAX_DIM * MAX_DIM * sizeof(float32_t));
+		pst_fi->st_scratch.paf32_mb_part = (float32_t*)malloc(SMM_OMP_ROWS * MAX_DIM * sizeof(float32_t));
+		pst_fi->st_scratch.paf32_mc_part = (float32_t*)malloc(SMM_OMP_ROWS * MAX_DIM * sizeof(float32_t));
+		assert((pst_fi->st_golden.past_shard != NULL) && (pst_fi->st_golden.past_prefix != NULL) && (pst_fi->st_golden.past_suffix != NULL) && (pst_fi->st_golden.paui32_slice != NULL) &&
+			(pst_fi->paf32_mc_in != NULL) && (pst_fi->st_scratch.paf32_mb_part != NULL) && (pst_fi->st_scratch.paf32_mc_part != NULL));
+	}
+	if (e_fi_mode == e_FI_EXEC_CHECK)
+	{
+		/* The golden execution of the delta on its own C: C and the ES of the full path are the ones of -fi=full */
+		pst_fi->paf32_mc_delta = (float32_t*)malloc(MAX_DIM * MAX_DIM * sizeof(float32_t));
+		assert(pst_fi->paf32_mc_delta != NULL);
+	}
+}
 
+/*==============================================================================================================
+**									Name: smm_fi_campaign_free
+==============================================================================================================*/
+/*!
+** @brief Free the buffers of smm_fi_campaign_alloc
+**
+** @param[in,out] pst_fi 	Delta state of the campaign
+==============================================================================================================*/
+static void_t smm_fi_campaign_free(smm_fi_campaign_t * const pst_fi)
+{
+	free(pst_fi->st_golden.past_shard);
+	free(pst_fi->st_golden.past_prefix);
+	free(pst_fi->st_golden.past_suffix);
+	free(pst_fi->st_golden.paui32_slice);
+	free(pst_fi->paf32_mc_in);
+	free(pst_fi->st_scratch.paf32_mb_part);
+	free(pst_fi->st_scratch.paf32_mc_part);
+	free(pst_fi->paf32_mc_delta);
+	memset(pst_fi, 0, sizeof(*pst_fi));
+}
 
-		c_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(result256), m256i_zeros);
-		Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, c_aux_lo);
-		Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
-		Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
-		Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
+/*==============================================================================================================
+**									Name: smm_fi_campaign_golden
+==============================================================================================================*/
+/*!
+** @brief Golden execution of a technique and square size of a campaign. With -fi=delta|check and a technique with
+** 		  a delta (smm_fi_delta_supported / smm_fi_delta_b_supported), the golden checkpoints are recorded
+** 		  (smm_fi_golden); with -fi=check on their own C, and the golden ES of the delta is compared with the one of
+** 		  the full execution (smm_execute, same C and ES as -fi=full).
+**
+** @param[in] e_tech 		Technique
+** @param[in] ui32_size 	Number of rows and columns of A, B and C
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in,out] paf32_mc 	Pointer to the first position of an array of floats (C matrix direction)
+** @param[in,out] pst_fi 	Delta state of the campaign (smm_fi_campaign_alloc), mismatches reset
+**
+** @return uint32_t  	Golden execution signature the faulty executions are compared with
+==============================================================================================================*/
+static uint32_t smm_fi_campaign_golden(e_enum_technique e_tech, uint32_t ui32_size, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_fi_campaign_t * const pst_fi)
+{
+	uint32_t ui32_es;
 
-		ui32_idx_c_ref += ui32_n;
+	pst_fi->ui32_mismatch = 0u;
+	pst_fi->b32_delta_a = (e_fi_mode != e_FI_EXEC_FULL) ? smm_fi_delta_supported(e_tech) : FALSE;
+	pst_fi->b32_delta_b = (e_fi_mode != e_FI_EXEC_FULL) ? smm_fi_delta_b_supported(e_tech, ui32_size) : FALSE;
+	if ((pst_fi->b32_delta_a == FALSE) && (pst_fi->b32_delta_b == FALSE))
+	{
+		return smm_execute(e_tech, ui32_size, ui32_size, ui32_size, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+	}
+	if (e_fi_mode == e_FI_EXEC_DELTA)
+	{
+		return smm_fi_golden(e_tech, ui32_size, ui32_size, ui32_size, f32_alpha, paf32_ma, paf32_mb, paf32_mc, pst_fi->paf32_mc_in, &pst_fi->st_golden, &pst_fi->st_scratch);
 	}
-	Ones_Checksum.ui64 = (Ones_Checksum_a.ui64);
 
-	// Evaluation of the ES (C value)
-	Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_b_hi);
-	Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
-	Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
-	Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
+	memcpy(pst_fi->paf32_mc_delta, paf32_mc, (size_t)ui32_size * ui32_size * sizeof(float32_t));
+	(void_t)smm_fi_golden(e_tech, ui32_size, ui32_size, ui32_size, f32_alpha, paf32_ma, paf32_mb, pst_fi->paf32_mc_delta, pst_fi->paf32_mc_in, &pst_fi->st_golden, &pst_fi->st_scratch);
+	ui32_es = smm_execute(e_tech, ui32_size, ui32_size, ui32_size, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+	if (pst_fi->st_golden.ui32_es != ui32_es)
+	{
+		printf("\n ---> %s: golden execution signature of the delta 0x%08X instead of 0x%08X", pstr_technique[e_tech], pst_fi->st_golden.ui32_es, ui32_es);
+		pst_fi->ui32_mismatch++;
+	}
+	return ui32_es;
+}
 
-	Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, Ones_checksum_b_lo);
-	Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
-	Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
-	Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
+/*==============================================================================================================
+**									Name: smm_fi_campaign_detect
+==============================================================================================================*/
+/*!
+** @brief Faulty execution of a campaign, faults in A (paf32_ma_fi != paf32_ma) or in B: delta re-execution from
+** 		  the golden checkpoints (smm_fi_delta_a / smm_fi_delta_b) when the technique has one, full execution
+** 		  otherwise. With -fi=check both are executed and the faults detected by one and not by the other are
+** 		  counted (pst_fi->ui32_mismatch); the result is the one of the full execution.
+**
+** @param[in] e_tech 		Technique
+** @param[in] ui32_size 	Number of rows and columns of A, B and C
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of the golden A matrix
+** @param[in] paf32_ma_fi 	Pointer to the first position of the A matrix of the execution (faulty or golden)
+** @param[in] paf32_mb 		Pointer to the first position of the golden B matrix
+** @param[in] paf32_mb_fi 	Pointer to the first position of the B matrix of the execution (faulty or golden)
+** @param[in,out] paf32_mc 	Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] ui32_es_golden Golden execution signature (smm_fi_campaign_golden)
+** @param[in,out] pst_fi 	Delta state of the campaign
+**
+** @return bool32_t  	TRUE if the execution signature differs from the golden one (fault detected)
+==============================================================================================================*/
+static bool32_t smm_fi_campaign_detect(e_enum_technique e_tech, uint32_t ui32_size, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_ma_fi, const float32_t * const paf32_mb, const float32_t * const paf32_mb_fi, float32_t * const paf32_mc, uint32_t ui32_es_golden, smm_fi_campaign_t * const pst_fi)
+{
+	const bool32_t b32_delta = (paf32_ma_fi != paf32_ma) ? pst_fi->b32_delta_a : pst_fi->b32_delta_b;
+	bool32_t b32_detected = FALSE,
+		b32_detected_full;
 
-	uint32_t val[8];
-	memcpy(val, &Ones_checksum_c_lo, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	if (b32_delta && (paf32_ma_fi != paf32_ma))
 	{
-		/* One's complement checksum */
-		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
-		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
-		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+		b32_detected = (smm_fi_delta_a(e_tech, ui32_size, ui32_size, ui32_size, f32_alpha, paf32_ma, paf32_ma_fi, paf32_mb, pst_fi->paf32_mc_in, &pst_fi->st_golden, &pst_fi->st_scratch) != pst_fi->st_golden.ui32_es) ? TRUE : FALSE;
 	}
-	memcpy(val, &Ones_checksum_c_hi, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	else if (b32_delta)
 	{
-		/* One's complement checksum */
-		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
-		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
-		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+		b32_detected = (smm_fi_delta_b(e_tech, ui32_size, ui32_size, ui32_size, f32_alpha, paf32_ma, paf32_mb, paf32_mb_fi, pst_fi->paf32_mc_in, &pst_fi->st_golden, &pst_fi->st_scratch) != pst_fi->st_golden.ui32_es) ? TRUE : FALSE;
 	}
-
-	return Ones_Checksum.ui32[0];
+	if ((b32_delta == FALSE) || (e_fi_mode == e_FI_EXEC_CHECK))
+	{
+		b32_detected_full = (smm_execute(e_tech, ui32_size, ui32_size, ui32_size, f32_alpha, paf32_ma_fi, paf32_mb_fi, paf32_mc) != ui32_es_golden) ? TRUE : FALSE;
+		if (b32_delta && (b32_detected != b32_detected_full))
+		{
+			pst_fi->ui32_mismatch++;
+		}
+		b32_detected = b32_detected_full;
+	}
+	return b32_detected;
 }
 
 /*==============================================================================================================
-**									Name: smm_intel_ones_intermediate
+**									Name: smm_intel_xor_external
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the intermediate loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the external loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha Correction factor
+** @param[in] f32_alpha		Correction factor
 ** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
 ** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
 ** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	ui32_ones	Return the Execution signature of the MMM
+** @return __m256  	m256_xor	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_ones_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_xor_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// Variables to store the ES
-	__m256i  Ones_checksum_b_hi = _mm256_setzero_si256(),
-		Ones_checksum_b_lo = _mm256_setzero_si256(),
-		Ones_checksum_c_hi = _mm256_setzero_si256(),
-		Ones_checksum_c_lo = _mm256_setzero_si256();
+	/* XOR checksum */
+	__m256i m256_xor_a = _mm256_setzero_si256(),
+		m256_xor_b = _mm256_setzero_si256(),
+		m256_xor_c = _mm256_setzero_si256(),
+		m256_xor = _mm256_setzero_si256();
 
-	__m256i b_aux_lo, b_aux_hi,
-		c_aux_lo, c_aux_hi,
-		m256i_zeros = _mm256_setzero_si256();
+	/* XOR checksum */
+	uint32_t ui32_xor_a = 0u,
+		ui32_xor_b = 0u,
+		ui32_xor_c = 0u,
+		ui32_xor = 0u;
 
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
 	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -4563,19 +7086,6 @@ static uint32_t smm_intel_ones_intermediate(uint32_t ui32_m, uint32_t ui32_n, ui
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
-	/* One's complement checksum */
-	ui64_to_ui32_t Ones_Checksum_a,
-		Ones_Checksum_b,
-		Ones_Checksum_c,
-		Ones_Checksum;
-
-	Ones_Checksum_a.ui64 = 0u;
-	Ones_Checksum_b.ui64 = 0u;
-	Ones_Checksum_c.ui64 = 0u;
-	Ones_Checksum.ui64 = 0u;
-
-	float f32_a_part;
-
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
@@ -4591,145 +7101,68 @@ static uint32_t smm_intel_ones_intermediate(uint32_t ui32_m, uint32_t ui32_n, ui
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
-			// Evaluation of the ES (B value)
-			b_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(b256), m256i_zeros);
-			Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, b_aux_hi);
-			Ones_checksum_b_hi = _mm256_hadd_epi32(Ones_checksum_b_hi, Ones_checksum_b_hi);
-			Ones_checksum_b_hi = _mm256_xor_si256(Ones_checksum_b_hi, m256i_Ones);
-			Ones_checksum_b_hi = _mm256_unpackhi_epi32(Ones_checksum_b_hi, m256i_zeros);
-
-
-			b_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(b256), m256i_zeros);
-			Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, b_aux_lo);
-			Ones_checksum_b_lo = _mm256_hadd_epi32(Ones_checksum_b_lo, Ones_checksum_b_lo);
-			Ones_checksum_b_lo = _mm256_xor_si256(Ones_checksum_b_lo, m256i_Ones);
-			Ones_checksum_b_lo = _mm256_unpackhi_epi32(Ones_checksum_b_lo, m256i_zeros);
-
-
-			// Evaluation of the ES (C value)
-			c_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(result256), m256i_zeros);
-			Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, c_aux_hi);
-			Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
-			Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
-			Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
-
-
-			c_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(result256), m256i_zeros);
-			Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, c_aux_lo);
-			Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
-			Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
-			Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
-
-
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* One's complement checksum */
-					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
-					Ones_Checksum_b.ui32[0] = ~Ones_Checksum_b.ui32[0];
-
-					Ones_Checksum_c.ui64 += (uint64_t) * ((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-					Ones_Checksum_c.ui32[0] += Ones_Checksum_c.ui32[1];
-					Ones_Checksum_c.ui32[0] = ~Ones_Checksum_c.ui32[0];
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
-			// Evaluation of the ES (A value)
-			Ones_Checksum_a.ui64 += (uint64_t) * ((uint32_t*)&f32_a_part);
-			Ones_Checksum_a.ui32[0] += Ones_Checksum_a.ui32[1];
-			Ones_Checksum_a.ui32[0] = ~Ones_Checksum_a.ui32[0];
-
 			ui32_idx_b_ref += ui32_n;
 		}
+		ui32_xor ^= (uint32_t) *((uint32_t*)&f32_a_part);
+		m256_xor_b = _mm256_xor_si256(m256_xor_b, _mm256_castps_si256(b256));
+		m256_xor_c = _mm256_xor_si256(m256_xor_b, _mm256_castps_si256(result256));
 		ui32_idx_c_ref += ui32_n;
 	}
-	if (0 != prev_end) {
-		Ones_Checksum.ui64 = (Ones_Checksum_a.ui64 + Ones_Checksum_b.ui64);
-		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
-		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+	m256_xor = _mm256_xor_si256(m256_xor_b, m256_xor_c);
 
-		Ones_Checksum.ui64 += Ones_Checksum_c.ui64;
-		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
-		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
-	}
-	else {
-		Ones_Checksum.ui64 = (Ones_Checksum_a.ui64);
+	uint32_t val[8];
+	memcpy(val, &m256_xor, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	{
+		ui32_xor ^= (uint32_t) *((uint32_t*)&val[ui32_idx_i]);
 	}
+	return ui32_xor;
 
-	// Evaluation of the ES (C value)
-	Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_b_hi);
-	Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
-	Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
-	Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
-
-	Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, Ones_checksum_b_lo);
-	Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
-	Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
-	Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
-
-	uint32_t val[8];
-	memcpy(val, &Ones_checksum_c_lo, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
-	{
-		/* One's complement checksum */
-		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
-		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
-		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
-	}
-	memcpy(val, &Ones_checksum_c_hi, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
-	{
-		/* One's complement checksum */
-		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
-		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
-		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
-	}
-
-	return Ones_Checksum.ui32[0];
 }
+SMM_MADD_VARIANTS(smm_intel_xor_external, TARGET_AVX2)
 
 /*==============================================================================================================
-**									Name: smm_intel_ones_internal
+**									Name: smm_intel_xor_intermediate
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the intermediate loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] f32_alpha Correction factor
+** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	ui32_ones	Return the Execution signature of the MMM
+** @return uint32_t  	ui32_xor	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_ones_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_xor_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// Variables to store the ES
-	__m256i  Ones_checksum_a_hi = _mm256_setzero_si256(),
-		Ones_checksum_a_lo = _mm256_setzero_si256(),
-		Ones_checksum_b_hi = _mm256_setzero_si256(),
-		Ones_checksum_b_lo = _mm256_setzero_si256(),
-		Ones_checksum_c_hi = _mm256_setzero_si256(),
-		Ones_checksum_c_lo = _mm256_setzero_si256(),
-		Ones_checksum = _mm256_setzero_si256();
+	/* XOR checksum */
+	__m256i m256_xor_b = _mm256_setzero_si256(),
+		m256_xor_c = _mm256_setzero_si256(),
+		m256_xor;
 
-	__m256i a_aux_lo, a_aux_hi,
-		b_aux_lo, b_aux_hi,
-		c_aux_lo, c_aux_hi,
-		m256i_zeros = _mm256_setzero_si256();
+	/* XOR checksum */
+	uint32_t ui32_xor_a = 0u,
+		ui32_xor_b = 0u,
+		ui32_xor_c = 0u,
+		ui32_xor = 0u;
 
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
 	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -4740,19 +7173,6 @@ static uint32_t smm_intel_ones_internal(uint32_t ui32_m, uint32_t ui32_n, uint32
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
-	/* One's complement checksum */
-	ui64_to_ui32_t Ones_Checksum_a,
-		Ones_Checksum_b,
-		Ones_Checksum_c,
-		Ones_Checksum;
-
-	Ones_Checksum_a.ui64 = 0u;
-	Ones_Checksum_b.ui64 = 0u;
-	Ones_Checksum_c.ui64 = 0u;
-	Ones_Checksum.ui64 = 0u;
-
-	float f32_a_part;
-	uint32_t val[8];
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
@@ -4764,156 +7184,83 @@ static uint32_t smm_intel_ones_internal(uint32_t ui32_m, uint32_t ui32_n, uint32
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
 
+			// Evaluation of the ES (A value)
+			ui32_xor_a ^= (uint32_t) *((uint32_t*)&f32_a_part);
+
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
-
-				// Evaluation of the ES (B value)
-				b_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(b256), m256i_zeros);
-				Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, b_aux_hi);
-				Ones_checksum_b_hi = _mm256_hadd_epi32(Ones_checksum_b_hi, Ones_checksum_b_hi);
-				Ones_checksum_b_hi = _mm256_xor_si256(Ones_checksum_b_hi, m256i_Ones);
-				Ones_checksum_b_hi = _mm256_unpackhi_epi32(Ones_checksum_b_hi, m256i_zeros);
-
-
-				b_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(b256), m256i_zeros);
-				Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, b_aux_lo);
-				Ones_checksum_b_lo = _mm256_hadd_epi32(Ones_checksum_b_lo, Ones_checksum_b_lo);
-				Ones_checksum_b_lo = _mm256_xor_si256(Ones_checksum_b_lo, m256i_Ones);
-				Ones_checksum_b_lo = _mm256_unpackhi_epi32(Ones_checksum_b_lo, m256i_zeros);
-
-
-				// Evaluation of the ES (C value)
-				c_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(result256), m256i_zeros);
-				Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, c_aux_hi);
-				Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
-				Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
-				Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
-
-
-				c_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(result256), m256i_zeros);
-				Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, c_aux_lo);
-				Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
-				Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
-				Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
 			}
 
-			// Evaluation of the ES (A value)
-			/*a_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(a256), m256i_zeros);
-			Ones_checksum_a_hi = _mm256_add_epi64(Ones_checksum_a_hi, a_aux_hi);
-			Ones_checksum_a_hi = _mm256_hadd_epi32(Ones_checksum_a_hi, Ones_checksum_a_hi);
-			Ones_checksum_a_hi = _mm256_xor_si256(Ones_checksum_a_hi, m256i_Ones);
-			Ones_checksum_a_hi = _mm256_unpackhi_epi32(Ones_checksum_a_hi, m256i_zeros);
+			// Evaluation of the ES (B value)
+			m256_xor_b = _mm256_xor_si256(m256_xor_b, _mm256_castps_si256(b256));
 
-			a_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(a256), m256i_zeros);
-			Ones_checksum_a_lo = _mm256_add_epi64(Ones_checksum_a_lo, a_aux_lo);
-			Ones_checksum_a_lo = _mm256_hadd_epi32(Ones_checksum_a_lo, Ones_checksum_a_lo);
-			Ones_checksum_a_lo = _mm256_xor_si256(Ones_checksum_a_lo, m256i_Ones);
-			Ones_checksum_a_lo = _mm256_unpackhi_epi32(Ones_checksum_a_lo, m256i_zeros);
-			*/
+			// Evaluation of the ES (C value)
+			m256_xor_c = _mm256_xor_si256(m256_xor_c, _mm256_castps_si256(result256));
 
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* One's complement checksum */
-					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
-					Ones_Checksum_b.ui32[0] = ~Ones_Checksum_b.ui32[0];
-
-					Ones_Checksum_c.ui64 += (uint64_t) * ((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-					Ones_Checksum_c.ui32[0] += Ones_Checksum_c.ui32[1];
-					Ones_Checksum_c.ui32[0] = ~Ones_Checksum_c.ui32[0];
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* XOR checksum */
+					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
-			Ones_Checksum_a.ui64 += (uint64_t) * ((uint32_t*)&f32_a_part);
-			Ones_Checksum_a.ui32[0] += Ones_Checksum_a.ui32[1];
-			Ones_Checksum_a.ui32[0] = ~Ones_Checksum_a.ui32[0];
-
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
-	if (0 != prev_end) {
-		Ones_Checksum.ui64 = (Ones_Checksum_a.ui64 + Ones_Checksum_b.ui64);
-		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
-		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
-		Ones_Checksum.ui64 += Ones_Checksum_c.ui64;
-		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
-		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
-	}
-	else {
-		Ones_Checksum.ui64 = Ones_Checksum_a.ui64;
-	}
-
-	// Evaluation of the ES (C value)
-	Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, Ones_checksum_b_lo);
-	Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_c_lo);
-	Ones_checksum      = _mm256_add_epi64(Ones_checksum_b_hi, Ones_checksum_c_hi);
-
-	Ones_checksum = _mm256_hadd_epi32(Ones_checksum, Ones_checksum);
-	Ones_checksum = _mm256_xor_si256(Ones_checksum, m256i_Ones);
-	Ones_checksum = _mm256_unpackhi_epi32(Ones_checksum, m256i_zeros);
+	ui32_xor ^= (ui32_xor_b ^ ui32_xor_a) ^ ui32_xor_c;
 
+	m256_xor = _mm256_xor_si256(m256_xor_b, m256_xor_c);
 
-	memcpy(val, &Ones_checksum, sizeof(val));
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; (ui32_idx_i += 2) )
+	uint32_t val[8];
+	memcpy(val, &m256_xor, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
 	{
-		/* One's complement checksum */
-		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
-		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
-		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+		ui32_xor ^= (uint32_t) *((uint32_t*)&val[ui32_idx_i]);
 	}
 
-	return Ones_Checksum.ui32[0];
+	return ui32_xor;
 }
+SMM_MADD_VARIANTS(smm_intel_xor_intermediate, TARGET_AVX2)
 
 /*==============================================================================================================
-**									Name: smm_intel_fletcher_external
+**									Name: smm_intel_xor_internal
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the external loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
 ** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return __m256  	m256_xor	Return the Execution signature of the MMM
+** @return uint32_t  	ui32_xor	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_fletcher_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_xor_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// Fletcher Checksum with SIMD instructions(B and C)
-	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
-		m128i_Fletcher_b_hi = _mm_setzero_si128(),
-		m128i_Fletcher_c_lo = _mm_setzero_si128(),
-		m128i_Fletcher_c_hi = _mm_setzero_si128(),
-		aux_128i_b_lo, aux_128i_b_hi,
-		aux_128i_c_lo, aux_128i_c_hi;
-
-	uint32_t val_b_lo[4] = { 0u },
-		val_b_hi[4] = { 0u },
-		val_c_lo[4] = { 0u },
-		val_c_hi[4] = { 0u };
+	/* XOR checksum */
+	__m256i m256_xor_b = _mm256_setzero_si256(),
+		m256_xor_c = _mm256_setzero_si256(),
+		m256_xor;
 
-	/* Fletcher checksum sequential */
-	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher;
-	Fletcher_a.ui32 = 0u;
-	Fletcher_b.ui32 = 0u;
-	Fletcher_c.ui32 = 0u;
-	Fletcher.ui32 = 0u;
+	/* XOR checksum */
+	uint32_t ui32_xor_a = 0u,
+		ui32_xor_b = 0u,
+		ui32_xor_c = 0u,
+		ui32_xor = 0u;
 
-	__m256i aux_256i_b, aux_256i_c;
 	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -4924,8 +7271,6 @@ static uint32_t smm_intel_fletcher_external(uint32_t ui32_m, uint32_t ui32_n, ui
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
-	float f32_a_part;
-
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
@@ -4937,125 +7282,85 @@ static uint32_t smm_intel_fletcher_external(uint32_t ui32_m, uint32_t ui32_n, ui
 			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
 			a256 = _mm256_set1_ps(f32_a_part);
 
+			// Evaluation of the ES (A value)
+			ui32_xor_a ^= (uint32_t) *((uint32_t*)&f32_a_part);
+
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+
+				// Evaluation of the ES (B value)
+				m256_xor_b = _mm256_xor_si256(m256_xor_b, _mm256_castps_si256(b256));
+
+				// Evaluation of the ES (C value)
+				m256_xor_c = _mm256_xor_si256(m256_xor_c, _mm256_castps_si256(result256));
 			}
+
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* XOR checksum */
+					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
 			ui32_idx_b_ref += ui32_n;
 		}
-		// Evaluation of the ES (A value)
-		Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
-
-		// Casting of the variables (B and C values)
-		aux_256i_b = _mm256_castps_si256(b256);
-		aux_256i_c = _mm256_castps_si256(result256);
+		ui32_idx_c_ref += ui32_n;
+	}
+	ui32_xor ^= (ui32_xor_b ^ ui32_xor_a) ^ ui32_xor_c;
 
-		// Evaluation of the ES (A value)
-		Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
+	m256_xor = _mm256_xor_si256(m256_xor_b, m256_xor_c);
 
-		// Fletcher computation B
-		aux_128i_b_lo = _mm256_extractf128_si256(aux_256i_b, 0);
-		aux_128i_b_hi = _mm256_extractf128_si256(aux_256i_b, 1);
+	uint32_t val[8];
+	memcpy(val, &m256_xor, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	{
+		ui32_xor ^= (uint32_t) *((uint32_t*)&val[ui32_idx_i]);
+	}
 
-		m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
-		m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-		m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
-		m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-
-
-		// Fletcher computation C
-		aux_128i_c_lo = _mm256_extractf128_si256(aux_256i_c, 0);
-		aux_128i_c_hi = _mm256_extractf128_si256(aux_256i_c, 1);
-
-		m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
-		m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-		m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
-		m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-
-		memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
-		memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
-		memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
-		memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
-		for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
-		{
-			val_b_lo[ui32_idx_l] %= 65535;
-			val_b_hi[ui32_idx_l] %= 65535;
-			val_c_lo[ui32_idx_l] %= 65535;
-			val_c_hi[ui32_idx_l] %= 65535;
-		}
-		memcpy(&m128i_Fletcher_b_lo, val_b_lo, sizeof(val_b_lo));
-		memcpy(&m128i_Fletcher_b_hi, val_b_hi, sizeof(val_b_hi));
-		memcpy(&m128i_Fletcher_c_lo, val_c_lo, sizeof(val_c_lo));
-		memcpy(&m128i_Fletcher_c_hi, val_c_hi, sizeof(val_c_hi));
-
-		ui32_idx_c_ref += ui32_n;
-	}
-
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
-	{
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
-	}
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
-
-	return Fletcher.ui32;
+	return ui32_xor;
 }
-
+SMM_MADD_VARIANTS(smm_intel_xor_internal, TARGET_AVX2)
 /*==============================================================================================================
-**									Name: smm_intel_fletcher_intermediate
+**									Name: smm_intel_twos_external
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the intermediate loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the external loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha Correction factor
+** @param[in] f32_alpha		Correction factor
 ** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
 ** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
 ** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	ui32_fletcher	Return the Execution signature of the MMM
+** @return __m256  	m256_twos	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_fletcher_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_twos_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// Fletcher Checksum with SIMD instructions(B and C)
-	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
-		m128i_Fletcher_b_hi = _mm_setzero_si128(),
-		m128i_Fletcher_c_lo = _mm_setzero_si128(),
-		m128i_Fletcher_c_hi = _mm_setzero_si128(),
-		aux_128i_b_lo, aux_128i_b_hi,
-		aux_128i_c_lo, aux_128i_c_hi;
-	
-	uint32_t val_b_lo[4] = { 0u },
-		val_b_hi[4] = { 0u },
-		val_c_lo[4] = { 0u },
-		val_c_hi[4] = { 0u };
+	/* Twos checksum */
+	__m256i m256i_twos_b = _mm256_setzero_si256(),
+		m256i_twos_c = _mm256_setzero_si256(),
+		m256i_twos;
 
-	/* Fletcher checksum sequential */
-	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher;
-	Fletcher_a.ui32 = 0u;
-	Fletcher_b.ui32 = 0u;
-	Fletcher_c.ui32 = 0u;
-	Fletcher.ui32 = 0u;
+	/* Two's complement checksum */
+	uint32_t Twos_Checksum_a = 0u,
+		Twos_Checksum_b = 0u,
+		Twos_Checksum_c = 0u,
+		Twos_Checksum = 0u;
+
+	__m256i m256i_Ones = _mm256_set1_epi32(-1);
+	__m256i m256i_singleOne = _mm256_set1_epi32(1);
 
-	__m256i aux_256i_b, aux_256i_c;
 	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -5069,7 +7374,6 @@ static uint32_t smm_intel_fletcher_intermediate(uint32_t ui32_m, uint32_t ui32_n
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
-	float f32_a_part;
 	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
 	{
 		ui32_idx_b_ref = 0u;
@@ -5082,138 +7386,88 @@ static uint32_t smm_intel_fletcher_intermediate(uint32_t ui32_m, uint32_t ui32_n
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
-			// =====================================================
-			//				FLETCHER Intermediate
-			// =====================================================
-			// Casting of the variables (B and C values)
-			aux_256i_b = _mm256_castps_si256(b256);
-			aux_256i_c = _mm256_castps_si256(result256);
-
-
-			// Fletcher computation B
-			aux_128i_b_lo = _mm256_extractf128_si256(aux_256i_b, 0);
-			aux_128i_b_hi = _mm256_extractf128_si256(aux_256i_b, 1);
-
-			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
-			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
-			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-
-
-			// Fletcher computation C
-			aux_128i_c_lo = _mm256_extractf128_si256(aux_256i_c, 0);
-			aux_128i_c_hi = _mm256_extractf128_si256(aux_256i_c, 1);
-
-			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
-			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
-			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-
-			// Fletcher checksum requires a modulo operation. This algebraic operation is not implemented with
-			// SIMD instructions, and therefore, it has to be implemented with sequential instructions and it will
-			// produce an increment in the performance impact
-			memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
-			memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
-			memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
-			memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
-			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
-			{
-				val_b_lo[ui32_idx_l] %= 65535;
-				val_b_hi[ui32_idx_l] %= 65535;
-				val_c_lo[ui32_idx_l] %= 65535;
-				val_c_hi[ui32_idx_l] %= 65535;
-			}
-			memcpy(&m128i_Fletcher_b_lo, val_b_lo, sizeof(val_b_lo));
-			memcpy(&m128i_Fletcher_b_hi, val_b_hi, sizeof(val_b_hi));
-			memcpy(&m128i_Fletcher_c_lo, val_c_lo, sizeof(val_c_lo));
-			memcpy(&m128i_Fletcher_c_hi, val_c_hi, sizeof(val_c_hi));
-
-			// Evaluation of the ES (A value)
-			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
-
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, (uint32_t) * (uint32_t *)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, (uint32_t) * (uint32_t *)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
-
 			ui32_idx_b_ref += ui32_n;
 		}
+
+		// Evaluation of the ES (A value)
+		Twos_Checksum_a += (uint32_t) * (uint32_t*)&f32_a_part;
+		Twos_Checksum_a = (~Twos_Checksum_a) + 1;
+
+		// Evaluation of the ES (B value)
+		m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
+		m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
+		m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
+
+		// Evaluation of the ES (C value)
+		m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
+		m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
+		m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
+
 		ui32_idx_c_ref += ui32_n;
 	}
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
+	Twos_Checksum = Twos_Checksum_a;
+
+	m256i_twos = _mm256_add_epi32(m256i_twos_b, m256i_twos_c);
+	m256i_twos = _mm256_xor_si256(m256i_twos, m256i_Ones);
+	m256i_twos = _mm256_add_epi32(m256i_twos, m256i_singleOne);
+
+	uint32_t val[8];
+	memcpy(val, &m256i_twos, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
 	{
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
+		/* Two's complement checksum */
+		Twos_Checksum += (uint32_t) * (uint32_t*)&val[ui32_idx_i];
+		Twos_Checksum = (~Twos_Checksum) + 1;
 	}
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
-
-	return Fletcher.ui32;
+	return Twos_Checksum;
 }
+SMM_MADD_VARIANTS(smm_intel_twos_external, TARGET_AVX2)
 
 /*==============================================================================================================
-**									Name: smm_intel_fletcher_internal
+**									Name: smm_intel_twos_intermediate
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the intermediate loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] f32_alpha Correction factor
+** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	ui32_fletcher	Return the Execution signature of the MMM
+** @return uint32_t  	ui32_twos	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_twos_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// Fletcher Checksum with SIMD instructions(B and C)
-	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
-		m128i_Fletcher_b_hi = _mm_setzero_si128(),
-		m128i_Fletcher_c_lo = _mm_setzero_si128(),
-		m128i_Fletcher_c_hi = _mm_setzero_si128(),
-		aux_128i_b_lo , aux_128i_b_hi,
-		aux_128i_c_lo, aux_128i_c_hi;
-	// __m128i m128i_mod_255 = _mm_set1_epi32(255);
-
-	uint32_t val_b_lo[4] = { 0u }, 
-		val_b_hi[4] = { 0u },
-		val_c_lo[4] = { 0u },
-		val_c_hi[4] = { 0u };
+	/* Twos checksum */
+	__m256i m256i_twos_b = _mm256_setzero_si256(),
+		m256i_twos_c = _mm256_setzero_si256(),
+		m256i_twos;
 
-	/* Fletcher checksum sequential */
-	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher; // , Fletcher_b_lo, Fletcher_b_hi, Fletcher_c_lo, Fletcher_c_hi;
-	Fletcher_a.ui32 = 0u;
-	Fletcher_b.ui32 = 0u;
-	Fletcher_c.ui32 = 0u;
-	Fletcher.ui32 = 0u;
-	/*
-	Fletcher_b_lo.ui32 = 0u,
-	Fletcher_b_hi.ui32 = 0u,
-	Fletcher_c_lo.ui32 = 0u,
-	Fletcher_c_hi.ui32 = 0u;
-	*/
+	/* Two's complement checksum */
+	uint32_t Twos_Checksum_a = 0u,
+		Twos_Checksum_b = 0u,
+		Twos_Checksum_c = 0u,
+		Twos_Checksum = 0u;
 
-	ui64_to_ui32_t Fletcher_aux;
-	Fletcher_aux.ui64 = 0u;
+	__m256i m256i_Ones = _mm256_set1_epi32(-1);
+	__m256i m256i_singleOne = _mm256_set1_epi32(1);
 
-	__m256i aux_256i_b, aux_256i_c;
 	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -5224,8 +7478,6 @@ static uint32_t smm_intel_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, ui
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
-	float f32_a_part;
-
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
@@ -5241,114 +7493,62 @@ static uint32_t smm_intel_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, ui
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
-
-				// Casting of the variables (B and C values)
-				aux_256i_b = _mm256_castps_si256(b256);
-				aux_256i_c = _mm256_castps_si256(result256);
-
-				// =====================================================
-				//				FLETCHER INTERNAL
-				// =====================================================
-				// Fletcher computation B
-				aux_128i_b_lo = _mm256_extractf128_si256(aux_256i_b, 0);
-				aux_128i_b_hi = _mm256_extractf128_si256(aux_256i_b, 1);
-
-				m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
-				m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-				m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
-				m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-
-
-				// Fletcher computation C
-				aux_128i_c_lo = _mm256_extractf128_si256(aux_256i_c, 0);
-				aux_128i_c_hi = _mm256_extractf128_si256(aux_256i_c, 1);
-
-				m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
-				m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-				m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
-				m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-
-				// Fletcher checksum requires a modulo operation. This algebraic operation is not implemented with
-				// SIMD instructions, and therefore, it has to be implemented with sequential instructions and it will
-				// produce an increment in the performance impact
-				memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
-				memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
-				memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
-				memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
-				for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
-				{
-					val_b_lo[ui32_idx_l] %= 65535;
-					val_b_hi[ui32_idx_l] %= 65535;
-					val_c_lo[ui32_idx_l] %= 65535;
-					val_c_hi[ui32_idx_l] %= 65535;
-				}
-				memcpy(&m128i_Fletcher_b_lo, val_b_lo, sizeof(val_b_lo));
-				memcpy(&m128i_Fletcher_b_hi, val_b_hi, sizeof(val_b_hi));
-				memcpy(&m128i_Fletcher_c_lo, val_c_lo, sizeof(val_c_lo));
-				memcpy(&m128i_Fletcher_c_hi, val_c_hi, sizeof(val_c_hi));
 			}
 
-			// Evaluation of the ES (A value)
-			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
-
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, (uint32_t) * (uint32_t *)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, (uint32_t) * (uint32_t *)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
+
+			// Evaluation of the ES (A value)
+			Twos_Checksum_a += (uint32_t) * (uint32_t*)&f32_a_part;
+			Twos_Checksum_a = (~Twos_Checksum_a) + 1;
+
+			// Evaluation of the ES (B value)
+			m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
+			m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
+			m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
+
+			// Evaluation of the ES (C value)
+			m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
+			m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
+			m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
+
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
-	{
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
-	}
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
+	Twos_Checksum += Twos_Checksum_b + Twos_Checksum_a;
+	Twos_Checksum = (~Twos_Checksum) + 1;
+	Twos_Checksum += Twos_Checksum_c;
+	Twos_Checksum = (~Twos_Checksum) + 1;
 
-	// Fletcher computation
-	/*
-	m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, m128i_Fletcher_c_lo);
-	m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-	m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, m128i_Fletcher_c_hi);
-	m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+	m256i_twos = _mm256_add_epi32(m256i_twos_b, m256i_twos_c);
+	m256i_twos = _mm256_xor_si256(m256i_twos, m256i_Ones);
+	m256i_twos = _mm256_add_epi32(m256i_twos, m256i_singleOne);
 
-	memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(float32_t) * 4);
-	memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(float32_t) * 4);
-	for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
+	uint32_t val[8];
+	memcpy(val, &m256i_twos, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
 	{
-		Fletcher.ui32 = (uint32_t) * (uint32_t*)&val_b_lo[ui32_idx_l];
-		Fletcher.ui16[0] %= 255;
-		Fletcher.ui16[1] %= 255;
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b,Fletcher.ui32);
-
-		Fletcher.ui32 = (uint32_t) * (uint32_t*)&val_b_hi[ui32_idx_l];
-		Fletcher.ui16[0] %= 255;
-		Fletcher.ui16[1] %= 255;
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, Fletcher.ui32);
+		/* Two's complement checksum */
+		Twos_Checksum += val[ui32_idx_i];
+		Twos_Checksum = (~Twos_Checksum) + 1;
 	}
-	Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, Fletcher_b.ui32);
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_c, Fletcher_a.ui32);
-	*/
-	return Fletcher.ui32;
+
+	return Twos_Checksum;
 }
+SMM_MADD_VARIANTS(smm_intel_twos_intermediate, TARGET_AVX2)
+
 /*==============================================================================================================
-**									Name: smm_intel_crc_external
+**									Name: smm_intel_twos_internal
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the external loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
@@ -5357,17 +7557,29 @@ static uint32_t smm_intel_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, ui
 ** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
 ** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
 ** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return __m256  	m256_crc	Return the Execution signature of the MMM
+** @return uint32_t  	ui32_twos	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_crc_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_twos_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	uint32_t ui32_crc_a = INITIAL_REMAINDER,
-		ui32_crc_b = INITIAL_REMAINDER,
-		ui32_crc_c = INITIAL_REMAINDER,
-		ui32_crc = INITIAL_REMAINDER;
+	/* Twos checksum */
+	__m256i m256i_twos_a= _mm256_setzero_si256(),
+		m256i_twos_b = _mm256_setzero_si256(),
+		m256i_twos_c = _mm256_setzero_si256(),
+		m256i_twos = _mm256_setzero_si256();
+
+	/* Two's complement checksum */
+	uint32_t Twos_Checksum_a = 0u,
+		Twos_Checksum_b = 0u,
+		Twos_Checksum_c = 0u,
+		Twos_Checksum = 0u;
+
+	__m256i m256i_Ones = _mm256_set1_epi32(-1);
+	__m256i m256i_singleOne = _mm256_set1_epi32(1);
 
 	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -5378,81 +7590,115 @@ static uint32_t smm_intel_crc_external(uint32_t ui32_m, uint32_t ui32_n, uint32_
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
-	uint32_t val_b[8], val_c[8];
-
-	float A_PART;
-
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
+	uint32_t val[8];
 
 	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
 	{
 		ui32_idx_b_ref = 0u;
 		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
 		{
-			A_PART = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(A_PART);
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
+
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+
+				// Evaluation of the ES (B value)
+				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
+				m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
+				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
+
+				// Evaluation of the ES (C value)
+				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
+				m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
+				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
 			}
 
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += A_PART * paf32_mb[ui32_idx_b + ui32_idx_j];
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* Twos checksum */
+					// Evaluation of the ES (B value)
+					Twos_Checksum_b += (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Twos_Checksum_b = (~Twos_Checksum_b) + 1;
+					// Evaluation of the ES (C value)
+					Twos_Checksum_c += (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Twos_Checksum_c = (~Twos_Checksum_c) + 1;
 				}
 			}
-			ui32_idx_b_ref += ui32_n;
-		}
-		// Evaluation of the ES (A value)
-		ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) * (uint32_t*)&A_PART);
+			// Evaluation of the ES (A value)
+			Twos_Checksum_a += (uint32_t) * (uint32_t*)&f32_a_part;
+			Twos_Checksum_a = (~Twos_Checksum_a) + 1;
 
-		memcpy(val_b, &b256, sizeof(float32_t) * 8);
-		memcpy(val_c, &result256, sizeof(float32_t) * 8);
-		for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
-		{
-			ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b[ui32_idx_l]);
-			ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c[ui32_idx_l]);
+			ui32_idx_b_ref += ui32_n;
 		}
-
 		ui32_idx_c_ref += ui32_n;
 	}
-	ui32_crc = _mm_crc32_u32(ui32_crc_a, ui32_crc_b);
-	ui32_crc = _mm_crc32_u32(ui32_crc, ui32_crc_c);
-	return ui32_crc;
+	if (0 != prev_end)
+	{
+		Twos_Checksum = Twos_Checksum_b + Twos_Checksum_a;
+		Twos_Checksum = (~Twos_Checksum) + 1;
+		Twos_Checksum += Twos_Checksum_c;
+		Twos_Checksum = (~Twos_Checksum) + 1;
+	}
+	else
+	{
+		Twos_Checksum = Twos_Checksum_a;
+	}
+	m256i_twos = _mm256_add_epi32(m256i_twos_b, m256i_twos_c);
+	m256i_twos = _mm256_xor_si256(m256i_twos, m256i_Ones);
+	m256i_twos = _mm256_add_epi32(m256i_twos, m256i_singleOne);
+
+	memcpy(val, &m256i_twos, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	{
+		/* Two's complement checksum */
+		Twos_Checksum += val[ui32_idx_i];
+		Twos_Checksum = (~Twos_Checksum) + 1;
+	}
+
+	return Twos_Checksum;
 }
+SMM_MADD_VARIANTS(smm_intel_twos_internal, TARGET_AVX2)
 
 /*==============================================================================================================
-**									Name: smm_intel_crc_intermediate
+**									Name: smm_intel_ones_external
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the intermediate loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the external loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha Correction factor
+** @param[in] f32_alpha		Correction factor
 ** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
 ** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
 ** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+** @return __m256  	m256_ones	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_ones_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	uint32_t ui32_crc_a = INITIAL_REMAINDER,
-		ui32_crc_b = INITIAL_REMAINDER,
-		ui32_crc_c = INITIAL_REMAINDER,
-		ui32_crc = INITIAL_REMAINDER;
+	// Variables to store the ES
+	__m256i  Ones_checksum_b_hi = _mm256_setzero_si256(),
+		Ones_checksum_b_lo = _mm256_setzero_si256(),
+		Ones_checksum_c_hi = _mm256_setzero_si256(),
+		Ones_checksum_c_lo = _mm256_setzero_si256();
+
+	__m256i b_aux_lo, b_aux_hi,
+		c_aux_lo, c_aux_hi,
+		m256i_zeros = _mm256_setzero_si256();
 
+	__m256i m256i_Ones = _mm256_set1_epi32(-1);
 	__m256 a256, b256, c256, result256;    // AVX
 
 	uint32_t ui32_idx_i = 0u,
@@ -5464,150 +7710,144 @@ static uint32_t smm_intel_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uin
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
-	uint32_t val_b[8], val_c[8];
+	/* One's complement checksum */
+	ui64_to_ui32_t Ones_Checksum_a,
+		Ones_Checksum_b,
+		Ones_Checksum_c,
+		Ones_Checksum;
+
+	Ones_Checksum_a.ui64 = 0u;
+	Ones_Checksum_b.ui64 = 0u;
+	Ones_Checksum_c.ui64 = 0u;
+	Ones_Checksum.ui64 = 0u;
+
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
+	float f32_a_part;
 	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
 	{
 		ui32_idx_b_ref = 0u;
 		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
 		{
-			float A_PART = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(A_PART);
-
-			// Evaluation of the ES (A value)
-			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) * (uint32_t*)&A_PART);
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
-
-			memcpy(val_b, &b256, sizeof(val_b));
-			memcpy(val_c, &result256, sizeof(val_c));
-			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
-			{
-				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b[ui32_idx_l]);
-				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c[ui32_idx_l]);
-			}
-
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += A_PART * paf32_mb[ui32_idx_b + ui32_idx_j];
-					ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
-
 			ui32_idx_b_ref += ui32_n;
 		}
-		ui32_idx_c_ref += ui32_n;
-	}
-	ui32_crc = _mm_crc32_u32(ui32_crc_a, ui32_crc_b);
-	ui32_crc = _mm_crc32_u32(ui32_crc, ui32_crc_c);
-	return ui32_crc;
-}
+		// Evaluation of the ES (A value)
+		Ones_Checksum_a.ui64 += (uint64_t) * ((uint32_t*)&f32_a_part);
+		Ones_Checksum_a.ui32[0] += Ones_Checksum_a.ui32[1];
+		Ones_Checksum_a.ui32[0] = ~Ones_Checksum_a.ui32[0];
 
-/*==============================================================================================================
-**									Name: smm_intel_crc_internal
-==============================================================================================================*/
-/*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
-**
-** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
-** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
-** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
-**
-** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
-==============================================================================================================*/
-static uint32_t smm_intel_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
-{
-	uint32_t ui32_crc_a = INITIAL_REMAINDER,
-		ui32_crc_b = INITIAL_REMAINDER,
-		ui32_crc_c = INITIAL_REMAINDER,
-		ui32_crc = INITIAL_REMAINDER;
+		// Evaluation of the ES (B value)
+		b_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(b256), m256i_zeros);
+		Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, b_aux_hi);
+		Ones_checksum_b_hi = _mm256_hadd_epi32(Ones_checksum_b_hi, Ones_checksum_b_hi);
+		Ones_checksum_b_hi = _mm256_xor_si256(Ones_checksum_b_hi, m256i_Ones);
+		Ones_checksum_b_hi = _mm256_unpackhi_epi32(Ones_checksum_b_hi, m256i_zeros);
 
-	__m256 a256, b256, c256, result256;    // AVX
+		b_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(b256), m256i_zeros);
+		Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, b_aux_lo);
+		Ones_checksum_b_lo = _mm256_hadd_epi32(Ones_checksum_b_lo, Ones_checksum_b_lo);
+		Ones_checksum_b_lo = _mm256_xor_si256(Ones_checksum_b_lo, m256i_Ones);
+		Ones_checksum_b_lo = _mm256_unpackhi_epi32(Ones_checksum_b_lo, m256i_zeros);
 
-	uint32_t ui32_idx_i = 0u,
-		ui32_idx_j = 0u,
-		ui32_idx_k = 0u,
-		ui32_idx_a = 0u,
-		ui32_idx_b = 0u,
-		ui32_idx_c = 0u,
-		ui32_idx_b_ref = 0u,
-		ui32_idx_c_ref = 0u;
 
-	uint32_t val_b[8], val_c[8];
+		// Evaluation of the ES (C value)
+		c_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(result256), m256i_zeros);
+		Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, c_aux_hi);
+		Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
+		Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
+		Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
 
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
 
-	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
-	{
-		ui32_idx_b_ref = 0u;
-		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
-		{
-			float A_PART = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(A_PART);
-
-			// Evaluation of the ES (A value)
-			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) * (uint32_t*)&A_PART);
-
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
-			{
-				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
-				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
+		c_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(result256), m256i_zeros);
+		Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, c_aux_lo);
+		Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
+		Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
+		Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
 
-				result256 = _mm256_add_ps(result256, c256);
-				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+		ui32_idx_c_ref += ui32_n;
+	}
+	Ones_Checksum.ui64 = (Ones_Checksum_a.ui64);
 
+	// Evaluation of the ES (C value)
+	Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_b_hi);
+	Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
+	Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
+	Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
 
-				memcpy(val_b, &b256, sizeof(val_b));
-				memcpy(val_c, &result256, sizeof(val_c));
-				for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
-				{
-					ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b[ui32_idx_l]);
-					ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c[ui32_idx_l]);
-				}
-			}
+	Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, Ones_checksum_b_lo);
+	Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
+	Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
+	Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
 
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += A_PART * paf32_mb[ui32_idx_b + ui32_idx_j];
-					ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-				}
-			}
-			ui32_idx_b_ref += ui32_n;
-		}
-		ui32_idx_c_ref += ui32_n;
+	uint32_t val[8];
+	memcpy(val, &Ones_checksum_c_lo, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	{
+		/* One's complement checksum */
+		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
+		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
+		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
 	}
-	ui32_crc = singletable_crc32c_ui32(ui32_crc_a, ui32_crc_b);
-	ui32_crc = singletable_crc32c_ui32(ui32_crc, ui32_crc_c);
-	return ui32_crc;
+	memcpy(val, &Ones_checksum_c_hi, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	{
+		/* One's complement checksum */
+		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
+		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
+		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+	}
+
+	return Ones_Checksum.ui32[0];
 }
+SMM_MADD_VARIANTS(smm_intel_ones_external, TARGET_AVX2)
 
-/* ==============================================================================================================
-* 	Name: smm_gemm_nn_instrics_intel
-* ============================================================================================================== */
-static uint32_t smm_gemm_nn_intrincs_intel(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+/*==============================================================================================================
+**									Name: smm_intel_ones_intermediate
+==============================================================================================================*/
+/*!
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the intermediate loop
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha Correction factor
+** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_ones	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_ones_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
+	// Variables to store the ES
+	__m256i  Ones_checksum_b_hi = _mm256_setzero_si256(),
+		Ones_checksum_b_lo = _mm256_setzero_si256(),
+		Ones_checksum_c_hi = _mm256_setzero_si256(),
+		Ones_checksum_c_lo = _mm256_setzero_si256();
+
+	__m256i b_aux_lo, b_aux_hi,
+		c_aux_lo, c_aux_hi,
+		m256i_zeros = _mm256_setzero_si256();
+
+	__m256i m256i_Ones = _mm256_set1_epi32(-1);
 	__m256 a256, b256, c256, result256;    // AVX
 
 	uint32_t ui32_idx_i = 0u,
@@ -5619,6 +7859,19 @@ static uint32_t smm_gemm_nn_intrincs_intel(uint32_t ui32_m, uint32_t ui32_n, uin
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
+	/* One's complement checksum */
+	ui64_to_ui32_t Ones_Checksum_a,
+		Ones_Checksum_b,
+		Ones_Checksum_c,
+		Ones_Checksum;
+
+	Ones_Checksum_a.ui64 = 0u;
+	Ones_Checksum_b.ui64 = 0u;
+	Ones_Checksum_c.ui64 = 0u;
+	Ones_Checksum.ui64 = 0u;
+
+	float f32_a_part;
+
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
@@ -5627,35 +7880,118 @@ static uint32_t smm_gemm_nn_intrincs_intel(uint32_t ui32_m, uint32_t ui32_n, uin
 		ui32_idx_b_ref = 0u;
 		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
 		{
-			float A_PART = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(A_PART);
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 			}
 
+			// Evaluation of the ES (B value)
+			b_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(b256), m256i_zeros);
+			Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, b_aux_hi);
+			Ones_checksum_b_hi = _mm256_hadd_epi32(Ones_checksum_b_hi, Ones_checksum_b_hi);
+			Ones_checksum_b_hi = _mm256_xor_si256(Ones_checksum_b_hi, m256i_Ones);
+			Ones_checksum_b_hi = _mm256_unpackhi_epi32(Ones_checksum_b_hi, m256i_zeros);
+
+
+			b_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(b256), m256i_zeros);
+			Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, b_aux_lo);
+			Ones_checksum_b_lo = _mm256_hadd_epi32(Ones_checksum_b_lo, Ones_checksum_b_lo);
+			Ones_checksum_b_lo = _mm256_xor_si256(Ones_checksum_b_lo, m256i_Ones);
+			Ones_checksum_b_lo = _mm256_unpackhi_epi32(Ones_checksum_b_lo, m256i_zeros);
+
+
+			// Evaluation of the ES (C value)
+			c_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(result256), m256i_zeros);
+			Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, c_aux_hi);
+			Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
+			Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
+			Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
+
+
+			c_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(result256), m256i_zeros);
+			Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, c_aux_lo);
+			Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
+			Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
+			Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
+
+
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += A_PART * paf32_mb[ui32_idx_b + ui32_idx_j];
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* One's complement checksum */
+					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
+					Ones_Checksum_b.ui32[0] = ~Ones_Checksum_b.ui32[0];
+
+					Ones_Checksum_c.ui64 += (uint64_t) * ((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Ones_Checksum_c.ui32[0] += Ones_Checksum_c.ui32[1];
+					Ones_Checksum_c.ui32[0] = ~Ones_Checksum_c.ui32[0];
 				}
 			}
+			// Evaluation of the ES (A value)
+			Ones_Checksum_a.ui64 += (uint64_t) * ((uint32_t*)&f32_a_part);
+			Ones_Checksum_a.ui32[0] += Ones_Checksum_a.ui32[1];
+			Ones_Checksum_a.ui32[0] = ~Ones_Checksum_a.ui32[0];
+
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
-	return 0u;
+	if (0 != prev_end) {
+		Ones_Checksum.ui64 = (Ones_Checksum_a.ui64 + Ones_Checksum_b.ui64);
+		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
+		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+
+		Ones_Checksum.ui64 += Ones_Checksum_c.ui64;
+		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
+		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+	}
+	else {
+		Ones_Checksum.ui64 = (Ones_Checksum_a.ui64);
+	}
+
+	// Evaluation of the ES (C value)
+	Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_b_hi);
+	Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
+	Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
+	Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
+
+	Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, Ones_checksum_b_lo);
+	Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
+	Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
+	Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
+
+	uint32_t val[8];
+	memcpy(val, &Ones_checksum_c_lo, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	{
+		/* One's complement checksum */
+		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
+		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
+		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+	}
+	memcpy(val, &Ones_checksum_c_hi, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; ui32_idx_i++)
+	{
+		/* One's complement checksum */
+		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
+		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
+		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+	}
+
+	return Ones_Checksum.ui32[0];
 }
+SMM_MADD_VARIANTS(smm_intel_ones_intermediate, TARGET_AVX2)
 
 /*==============================================================================================================
-**									Name: smm_intel_xor_flet
+**									Name: smm_intel_ones_internal
 ==============================================================================================================*/
 /*!
 ** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
@@ -5667,53 +8003,32 @@ static uint32_t smm_gemm_nn_intrincs_intel(uint32_t ui32_m, uint32_t ui32_n, uin
 ** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
 ** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
 ** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	ui32_xor	Return the Execution signature of the MMM
+** @return uint32_t  	ui32_ones	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_xor_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_ones_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// ==================================
-	//			XOR VARIABLES
-	// ==================================
-	/* XOR checksum */
-	__m256i m256i_xor_b = _mm256_setzero_si256(),
-		m256i_xor_c = _mm256_setzero_si256();
-
-	/* XOR checksum */
-	uint32_t ui32_xor_a = 0u,
-		ui32_xor_b = 0u,
-		ui32_xor_c = 0u,
-		ui32_xor = 0u;
-
-	// ==================================
-	//			FLETCHER VARIABLES
-	// ==================================
-	/* Fletcher Checksum with SIMD instructions(B and C) */
-	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
-		m128i_Fletcher_b_hi = _mm_setzero_si128(),
-		m128i_Fletcher_c_lo = _mm_setzero_si128(),
-		m128i_Fletcher_c_hi = _mm_setzero_si128(),
-		aux_128i_b_lo, aux_128i_b_hi,
-		aux_128i_c_lo, aux_128i_c_hi;
-
-	uint32_t val_b_lo[4] = { 0u },
-		val_b_hi[4] = { 0u },
-		val_c_lo[4] = { 0u },
-		val_c_hi[4] = { 0u };
+	// Variables to store the ES
+	__m256i  Ones_checksum_a_hi = _mm256_setzero_si256(),
+		Ones_checksum_a_lo = _mm256_setzero_si256(),
+		Ones_checksum_b_hi = _mm256_setzero_si256(),
+		Ones_checksum_b_lo = _mm256_setzero_si256(),
+		Ones_checksum_c_hi = _mm256_setzero_si256(),
+		Ones_checksum_c_lo = _mm256_setzero_si256(),
+		Ones_checksum = _mm256_setzero_si256();
 
-	/* Fletcher checksum sequential */
-	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher, Fletcher_aux;
-	Fletcher_a.ui32 = 0u;
-	Fletcher_b.ui32 = 0u;
-	Fletcher_c.ui32 = 0u;
-	Fletcher_aux.ui32 = 0u;
-	Fletcher.ui32 = 0u;
+	__m256i a_aux_lo, a_aux_hi,
+		b_aux_lo, b_aux_hi,
+		c_aux_lo, c_aux_hi,
+		m256i_zeros = _mm256_setzero_si256();
 
-	// ==================================
-	//			AUX VARIABLES
-	// ==================================
+	__m256i m256i_Ones = _mm256_set1_epi32(-1),
+		m256i_lo32 = _mm256_set1_epi64x(0xFFFFFFFFll),
+		m256i_sign = _mm256_setzero_si256(),
+		m256i_zero_b = _mm256_setzero_si256(),
+		m256i_zero_c = _mm256_setzero_si256();
 	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -5724,8 +8039,23 @@ static uint32_t smm_intel_xor_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
+	/* One's complement checksum */
+	ui64_to_ui32_t Ones_Checksum_a,
+		Ones_Checksum_b,
+		Ones_Checksum_c,
+		Ones_Checksum;
+
+	Ones_Checksum_a.ui64 = 0u;
+	Ones_Checksum_b.ui64 = 0u;
+	Ones_Checksum_c.ui64 = 0u;
+	Ones_Checksum.ui64 = 0u;
+
+	float f32_a_part;
+	uint32_t val[8];
+	uint64_t aui64_b_lo[4], aui64_b_hi[4], aui64_c_lo[4], aui64_c_hi[4];
+	uint32_t aui32_zero_b[8], aui32_zero_c[8], aui32_sign[8], aui32_ones_b[8], aui32_ones_c[8];
+	uint32_t prev_end;
+	prev_end = (ui32_n % 8);
 
 	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
 	{
@@ -5739,134 +8069,163 @@ static uint32_t smm_intel_xor_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
-				// Evaluation of the ES (B value)
-				m256i_xor_b = _mm256_xor_si256(m256i_xor_b, _mm256_castps_si256(b256));
+				// Evaluation of the ES (B and C values): every lane computes x = ~(x + b) with end-around carry,
+				// which is accumulated as b, ~b, b, ... in 64-bit lanes and resolved at the end (see ones_lane_ui32)
+				b_aux_lo = _mm256_xor_si256(_mm256_castps_si256(b256), m256i_sign);
+				Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, _mm256_and_si256(b_aux_lo, m256i_lo32));
+				Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, _mm256_srli_epi64(b_aux_lo, 32));
+				m256i_zero_b = _mm256_andnot_si256(m256i_zero_b, _mm256_cmpeq_epi32(_mm256_castps_si256(b256), m256i_zeros));
 
-				// Evaluation of the ES (C value)
-				m256i_xor_c = _mm256_xor_si256(m256i_xor_c, _mm256_castps_si256(result256));
-			}
+				c_aux_lo = _mm256_xor_si256(_mm256_castps_si256(result256), m256i_sign);
+				Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, _mm256_and_si256(c_aux_lo, m256i_lo32));
+				Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, _mm256_srli_epi64(c_aux_lo, 32));
+				m256i_zero_c = _mm256_andnot_si256(m256i_zero_c, _mm256_cmpeq_epi32(_mm256_castps_si256(result256), m256i_zeros));
 
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* XOR checksum */
-					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-				}
+				m256i_sign = _mm256_xor_si256(m256i_sign, m256i_Ones);
 			}
-			// Fletcher computation A
-			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
-
-			// Fletcher computation B
-			aux_128i_b_lo = _mm256_extractf128_si256(m256i_xor_b, 0);
-			aux_128i_b_hi = _mm256_extractf128_si256(m256i_xor_b, 1);
-
-			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
-			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
-			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
 
+			// Evaluation of the ES (A value)
+			/*a_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(a256), m256i_zeros);
+			Ones_checksum_a_hi = _mm256_add_epi64(Ones_checksum_a_hi, a_aux_hi);
+			Ones_checksum_a_hi = _mm256_hadd_epi32(Ones_checksum_a_hi, Ones_checksum_a_hi);
+			Ones_checksum_a_hi = _mm256_xor_si256(Ones_checksum_a_hi, m256i_Ones);
+			Ones_checksum_a_hi = _mm256_unpackhi_epi32(Ones_checksum_a_hi, m256i_zeros);
 
-			// Fletcher computation C
-			aux_128i_c_lo = _mm256_extractf128_si256(m256i_xor_c, 0);
-			aux_128i_c_hi = _mm256_extractf128_si256(m256i_xor_c, 1);
+			a_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(a256), m256i_zeros);
+			Ones_checksum_a_lo = _mm256_add_epi64(Ones_checksum_a_lo, a_aux_lo);
+			Ones_checksum_a_lo = _mm256_hadd_epi32(Ones_checksum_a_lo, Ones_checksum_a_lo);
+			Ones_checksum_a_lo = _mm256_xor_si256(Ones_checksum_a_lo, m256i_Ones);
+			Ones_checksum_a_lo = _mm256_unpackhi_epi32(Ones_checksum_a_lo, m256i_zeros);
+			*/
 
-			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
-			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
-			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+			if (0 != prev_end) {
+				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* One's complement checksum */
+					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
+					Ones_Checksum_b.ui32[0] = ~Ones_Checksum_b.ui32[0];
 
-			memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
-			memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
-			memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
-			memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
-			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
-			{
-				val_b_lo[ui32_idx_l] %= 65535;
-				val_b_hi[ui32_idx_l] %= 65535;
-				val_c_lo[ui32_idx_l] %= 65535;
-				val_c_hi[ui32_idx_l] %= 65535;
+					Ones_Checksum_c.ui64 += (uint64_t) * ((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Ones_Checksum_c.ui32[0] += Ones_Checksum_c.ui32[1];
+					Ones_Checksum_c.ui32[0] = ~Ones_Checksum_c.ui32[0];
+				}
 			}
-			memcpy(&m128i_Fletcher_b_lo, val_b_lo, sizeof(val_b_lo));
-			memcpy(&m128i_Fletcher_b_hi, val_b_hi, sizeof(val_b_hi));
-			memcpy(&m128i_Fletcher_c_lo, val_c_lo, sizeof(val_c_lo));
-			memcpy(&m128i_Fletcher_c_hi, val_c_hi, sizeof(val_c_hi));
+			Ones_Checksum_a.ui64 += (uint64_t) * ((uint32_t*)&f32_a_part);
+			Ones_Checksum_a.ui32[0] += Ones_Checksum_a.ui32[1];
+			Ones_Checksum_a.ui32[0] = ~Ones_Checksum_a.ui32[0];
 
-			if (0 != (ui32_n % 8)) {
-				Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, ui32_xor_b);
-				Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, ui32_xor_c);
-			}
 			ui32_idx_b_ref += ui32_n;
 		}
+		// End-around carry of the 64-bit lanes once per row, so they can not overflow
+		Ones_checksum_b_lo = ones_fold_epi64(Ones_checksum_b_lo);
+		Ones_checksum_b_hi = ones_fold_epi64(Ones_checksum_b_hi);
+		Ones_checksum_c_lo = ones_fold_epi64(Ones_checksum_c_lo);
+		Ones_checksum_c_hi = ones_fold_epi64(Ones_checksum_c_hi);
 		ui32_idx_c_ref += ui32_n;
 	}
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
+	if (0 != prev_end) {
+		Ones_Checksum.ui64 = (Ones_Checksum_a.ui64 + Ones_Checksum_b.ui64);
+		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
+		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+		Ones_Checksum.ui64 += Ones_Checksum_c.ui64;
+		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
+		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+	}
+	else {
+		Ones_Checksum.ui64 = Ones_Checksum_a.ui64;
+	}
+
+	// Value of every lane (even elements in the lo sums, odd elements in the hi sums)
+	memcpy(aui64_b_lo, &Ones_checksum_b_lo, sizeof(aui64_b_lo));
+	memcpy(aui64_b_hi, &Ones_checksum_b_hi, sizeof(aui64_b_hi));
+	memcpy(aui64_c_lo, &Ones_checksum_c_lo, sizeof(aui64_c_lo));
+	memcpy(aui64_c_hi, &Ones_checksum_c_hi, sizeof(aui64_c_hi));
+	memcpy(aui32_zero_b, &m256i_zero_b, sizeof(aui32_zero_b));
+	memcpy(aui32_zero_c, &m256i_zero_c, sizeof(aui32_zero_c));
+	memcpy(aui32_sign, &m256i_sign, sizeof(aui32_sign));
+	for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
 	{
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
+		aui32_ones_b[2 * ui32_idx_l] = ones_lane_ui32(aui64_b_lo[ui32_idx_l], aui32_sign[0], aui32_zero_b[2 * ui32_idx_l]);
+		aui32_ones_b[2 * ui32_idx_l + 1] = ones_lane_ui32(aui64_b_hi[ui32_idx_l], aui32_sign[0], aui32_zero_b[2 * ui32_idx_l + 1]);
+		aui32_ones_c[2 * ui32_idx_l] = ones_lane_ui32(aui64_c_lo[ui32_idx_l], aui32_sign[0], aui32_zero_c[2 * ui32_idx_l]);
+		aui32_ones_c[2 * ui32_idx_l + 1] = ones_lane_ui32(aui64_c_hi[ui32_idx_l], aui32_sign[0], aui32_zero_c[2 * ui32_idx_l + 1]);
 	}
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
+	b_aux_lo = _mm256_loadu_si256((const __m256i*)aui32_ones_b);
+	c_aux_lo = _mm256_loadu_si256((const __m256i*)aui32_ones_c);
+	Ones_checksum_b_hi = _mm256_unpackhi_epi32(b_aux_lo, m256i_zeros);
+	Ones_checksum_b_lo = _mm256_unpacklo_epi32(b_aux_lo, m256i_zeros);
+	Ones_checksum_c_hi = _mm256_unpackhi_epi32(c_aux_lo, m256i_zeros);
+	Ones_checksum_c_lo = _mm256_unpacklo_epi32(c_aux_lo, m256i_zeros);
 
-	return Fletcher.ui32;
+	// Evaluation of the ES (C value)
+	Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, Ones_checksum_b_lo);
+	Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_c_lo);
+	Ones_checksum      = _mm256_add_epi64(Ones_checksum_b_hi, Ones_checksum_c_hi);
+
+	Ones_checksum = _mm256_hadd_epi32(Ones_checksum, Ones_checksum);
+	Ones_checksum = _mm256_xor_si256(Ones_checksum, m256i_Ones);
+	Ones_checksum = _mm256_unpackhi_epi32(Ones_checksum, m256i_zeros);
+
+
+	memcpy(val, &Ones_checksum, sizeof(val));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 8; (ui32_idx_i += 2) )
+	{
+		/* One's complement checksum */
+		Ones_Checksum.ui64 += (uint64_t) * ((uint32_t*)&val[ui32_idx_i]);
+		Ones_Checksum.ui32[0] += Ones_Checksum.ui32[1];
+		Ones_Checksum.ui32[0] = ~Ones_Checksum.ui32[0];
+	}
+
+	return Ones_Checksum.ui32[0];
 }
+SMM_MADD_VARIANTS(smm_intel_ones_internal, TARGET_AVX2)
 
 /*==============================================================================================================
-**									Name: smm_intel_xor_crc
+**									Name: smm_intel_fletcher_external
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the external loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
 ** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+** @return __m256  	m256_xor	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_fletcher_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// ==================================
-	//			XOR VARIABLES
-	// ==================================
-	/* XOR checksum */
-	__m256i m256i_xor_a = _mm256_setzero_si256(),
-		m256i_xor_b = _mm256_setzero_si256(),
-		m256i_xor_c = _mm256_setzero_si256(),
-		m256i_xor = _mm256_setzero_si256();
+	// Fletcher Checksum with SIMD instructions(B and C)
+	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
+		m128i_Fletcher_b_hi = _mm_setzero_si128(),
+		m128i_Fletcher_c_lo = _mm_setzero_si128(),
+		m128i_Fletcher_c_hi = _mm_setzero_si128(),
+		aux_128i_b_lo, aux_128i_b_hi,
+		aux_128i_c_lo, aux_128i_c_hi;
 
-	/* XOR checksum */
-	uint32_t ui32_xor_a = 0u,
-		ui32_xor_b = 0u,
-		ui32_xor_c = 0u,
-		ui32_xor = 0u;
+	uint32_t val_b_lo[4] = { 0u },
+		val_b_hi[4] = { 0u },
+		val_c_lo[4] = { 0u },
+		val_c_hi[4] = { 0u };
 
-	// ==================================
-	//			CRC VARIABLES
-	// ==================================
-	uint32_t ui32_crc_a = INITIAL_REMAINDER,
-		ui32_crc_b = INITIAL_REMAINDER,
-		ui32_crc_c = INITIAL_REMAINDER,
-		ui32_crc = INITIAL_REMAINDER;
-	uint32_t val[8], val_b[8], val_c[8];
+	/* Fletcher checksum sequential */
+	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher;
+	Fletcher_a.ui32 = 0u;
+	Fletcher_b.ui32 = 0u;
+	Fletcher_c.ui32 = 0u;
+	Fletcher.ui32 = 0u;
 
-	// ==================================
-	//			AUX VARIABLES
-	// ==================================
+	__m256i aux_256i_b, aux_256i_c;
 	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -5877,6 +8236,8 @@ static uint32_t smm_intel_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui3
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
+	float f32_a_part;
+
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
@@ -5890,100 +8251,95 @@ static uint32_t smm_intel_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui3
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
-				//printf("\n Internal loop: idx_b:%d \tN=%d \t", ui32_idx_b, ui32_n);
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
-
-
-				// =====================================================
-				//				INTERNAL XOR
-				// =====================================================
-				// Evaluation of the ES (B value)
-				m256i_xor_b = _mm256_xor_si256(m256i_xor_b, _mm256_castps_si256(b256));
-
-				// Evaluation of the ES (C value)
-				m256i_xor_c = _mm256_xor_si256(m256i_xor_c, _mm256_castps_si256(result256));
 			}
-
-			//printf("\n Intermediate loop: idx_b:%d \tN=%d \tidx_c=%d", ui32_idx_b, ui32_n, ui32_idx_c);
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* XOR checksum */
-					//printf("\n idx_c:%d \tidx_c=%d \t", ui32_idx_c + ui32_idx_j, ui32_idx_b + ui32_idx_j);
-					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
-			m256i_xor_a = _mm256_xor_si256(m256i_xor_a, _mm256_castps_si256(a256));
-			m256i_xor = _mm256_xor_si256(m256i_xor_a, m256i_xor_b);
-			m256i_xor = _mm256_xor_si256(m256i_xor  , m256i_xor_c);
+			ui32_idx_b_ref += ui32_n;
+		}
+		// Evaluation of the ES (A value)
+		Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
 
-			memcpy(val, &m256i_xor, sizeof(val));
-			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
-			{
-				ui32_crc = _mm_crc32_u32(ui32_crc, (uint32_t) * (uint32_t*)&val[ui32_idx_l]);
-			}
+		// Casting of the variables (B and C values)
+		aux_256i_b = _mm256_castps_si256(b256);
+		aux_256i_c = _mm256_castps_si256(result256);
 
-			if (0 != prev_end) {
-				ui32_xor = (ui32_xor_a ^ ui32_xor_b) ^ ui32_xor_c;
-				ui32_crc = _mm_crc32_u32(ui32_crc, ui32_xor);
-			}
+		// Evaluation of the ES (A value)
+		Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
 
+		// Fletcher computation B
+		aux_128i_b_lo = _mm256_extractf128_si256(aux_256i_b, 0);
+		aux_128i_b_hi = _mm256_extractf128_si256(aux_256i_b, 1);
+
+		m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
+		m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+		m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
+		m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+
+
+		// Fletcher computation C
+		aux_128i_c_lo = _mm256_extractf128_si256(aux_256i_c, 0);
+		aux_128i_c_hi = _mm256_extractf128_si256(aux_256i_c, 1);
+
+		m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
+		m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+		m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
+		m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+
+		// Modulo 65535 of the Fletcher lanes with SIMD instructions (see fletcher_mod65535_epi32)
+		m128i_Fletcher_b_lo = fletcher_mod65535_epi32(m128i_Fletcher_b_lo);
+		m128i_Fletcher_b_hi = fletcher_mod65535_epi32(m128i_Fletcher_b_hi);
+		m128i_Fletcher_c_lo = fletcher_mod65535_epi32(m128i_Fletcher_c_lo);
+		m128i_Fletcher_c_hi = fletcher_mod65535_epi32(m128i_Fletcher_c_hi);
 
-			ui32_idx_b_ref += ui32_n;
-		}
 		ui32_idx_c_ref += ui32_n;
 	}
-	return ui32_crc;
+
+	memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
+	memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
+	memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
+	memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
+	{
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
+	}
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
+
+	return Fletcher.ui32;
 }
+SMM_MADD_VARIANTS(smm_intel_fletcher_external, TARGET_AVX2)
 
 /*==============================================================================================================
-**									Name: smm_intel_twos_flet
+**									Name: smm_intel_fletcher_intermediate
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with TWOS checksum in the internal loop and Fletcher checksum in the
-**        intermediate loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the intermediate loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
 ** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] f32_alpha Correction factor
+** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	Fletcher.ui32	Return the Execution signature of the MMM
+** @return uint32_t  	ui32_fletcher	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_fletcher_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// ==================================
-	//			ONES VARIABLES
-	// ==================================
-	// AVX variables
-	__m256i m256i_twos_b = _mm256_setzero_si256(),
-		m256i_twos_c = _mm256_setzero_si256();
-
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
-	__m256i m256i_singleOne = _mm256_set1_epi32(1);
-
-
-	// C variables
-	uint32_t Twos_Checksum_a = 0u,
-		Twos_Checksum_b = 0u,
-		Twos_Checksum_c = 0u,
-		Twos_Checksum = 0u;
-
-	// ==================================
-	//			FLETCHER VARIABLES
-	// ==================================
-	/* Fletcher Checksum with SIMD instructions(B and C) */
+	// Fletcher Checksum with SIMD instructions(B and C)
 	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
 		m128i_Fletcher_b_hi = _mm_setzero_si128(),
 		m128i_Fletcher_c_lo = _mm_setzero_si128(),
@@ -5997,19 +8353,14 @@ static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 		val_c_hi[4] = { 0u };
 
 	/* Fletcher checksum sequential */
-	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher, Fletcher_aux;
+	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher;
 	Fletcher_a.ui32 = 0u;
 	Fletcher_b.ui32 = 0u;
 	Fletcher_c.ui32 = 0u;
-	Fletcher_aux.ui32 = 0u;
 	Fletcher.ui32 = 0u;
 
-
-	// ==================================
-	//			AUX VARIABLES
-	// ==================================
+	__m256i aux_256i_b, aux_256i_c;
 	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -6023,6 +8374,7 @@ static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
+	float f32_a_part;
 	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
 	{
 		ui32_idx_b_ref = 0u;
@@ -6035,50 +8387,22 @@ static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
-
-
-				// =====================================================
-				//				INTERNAL TWOS
-				// =====================================================
-				// Evaluation of the ES (B value)
-				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
-				m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
-				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
-
-				// Evaluation of the ES (C value)
-				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
-				m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
-				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
 			}
 
-			if (0 != prev_end) {
-				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-
-					/* Twos' checksum */
-					// Evaluation of the ES (B value)
-					Twos_Checksum_b += (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Twos_Checksum_b = (~Twos_Checksum_b) + 1;
-					// Evaluation of the ES (C value)
-					Twos_Checksum_c += (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-					Twos_Checksum_c = (~Twos_Checksum_c) + 1;
-				}
-			}
 			// =====================================================
-			//				INTERMEDIATE FLETCHER
+			//				FLETCHER Intermediate
 			// =====================================================
-			// Evaluation of the ES (A value)
-			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
+			// Casting of the variables (B and C values)
+			aux_256i_b = _mm256_castps_si256(b256);
+			aux_256i_c = _mm256_castps_si256(result256);
+
 
 			// Fletcher computation B
-			aux_128i_b_lo = _mm256_extractf128_si256(m256i_twos_b, 0);
-			aux_128i_b_hi = _mm256_extractf128_si256(m256i_twos_b, 1);
+			aux_128i_b_lo = _mm256_extractf128_si256(aux_256i_b, 0);
+			aux_128i_b_hi = _mm256_extractf128_si256(aux_256i_b, 1);
 
 			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
 			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
@@ -6087,38 +8411,39 @@ static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 
 
 			// Fletcher computation C
-			aux_128i_c_lo = _mm256_extractf128_si256(m256i_twos_c, 0);
-			aux_128i_c_hi = _mm256_extractf128_si256(m256i_twos_c, 1);
+			aux_128i_c_lo = _mm256_extractf128_si256(aux_256i_c, 0);
+			aux_128i_c_hi = _mm256_extractf128_si256(aux_256i_c, 1);
 
 			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
 			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
 			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
 			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
 
-			memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
-			memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
-			memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
-			memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
-			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
-			{
-				val_b_lo[ui32_idx_l] %= 65535;
-				val_b_hi[ui32_idx_l] %= 65535;
-				val_c_lo[ui32_idx_l] %= 65535;
-				val_c_hi[ui32_idx_l] %= 65535;
-			}
-			memcpy(&m128i_Fletcher_b_lo, val_b_lo, sizeof(val_b_lo));
-			memcpy(&m128i_Fletcher_b_hi, val_b_hi, sizeof(val_b_hi));
-			memcpy(&m128i_Fletcher_c_lo, val_c_lo, sizeof(val_c_lo));
-			memcpy(&m128i_Fletcher_c_hi, val_c_hi, sizeof(val_c_hi));
+			// Modulo 65535 of the Fletcher lanes with SIMD instructions (see fletcher_mod65535_epi32)
+			m128i_Fletcher_b_lo = fletcher_mod65535_epi32(m128i_Fletcher_b_lo);
+			m128i_Fletcher_b_hi = fletcher_mod65535_epi32(m128i_Fletcher_b_hi);
+			m128i_Fletcher_c_lo = fletcher_mod65535_epi32(m128i_Fletcher_c_lo);
+			m128i_Fletcher_c_hi = fletcher_mod65535_epi32(m128i_Fletcher_c_hi);
+
+			// Evaluation of the ES (A value)
+			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
 
 			if (0 != prev_end) {
-				Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, Twos_Checksum_b);
-				Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, Twos_Checksum_c);
+				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, (uint32_t) * (uint32_t *)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, (uint32_t) * (uint32_t *)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+				}
 			}
+
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
+	memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
+	memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
+	memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
+	memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
 	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
 	{
 		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
@@ -6131,13 +8456,13 @@ static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 
 	return Fletcher.ui32;
 }
+SMM_MADD_VARIANTS(smm_intel_fletcher_intermediate, TARGET_AVX2)
 
 /*==============================================================================================================
-**									Name: smm_intel_twos_crc
+**									Name: smm_intel_fletcher_internal
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with TWO's complement checksum in the internal loop and CRC in the
-**        intermediate loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
@@ -6146,40 +8471,44 @@ static uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 ** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
 ** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
 ** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+** @return uint32_t  	ui32_fletcher	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_fletcher_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// ==================================
-	//			TWOS VARIABLES
-	// ==================================
-	__m256i m256i_twos_b = _mm256_setzero_si256(),
-		m256i_twos_c = _mm256_setzero_si256();
+	// Fletcher Checksum with SIMD instructions(B and C)
+	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
+		m128i_Fletcher_b_hi = _mm_setzero_si128(),
+		m128i_Fletcher_c_lo = _mm_setzero_si128(),
+		m128i_Fletcher_c_hi = _mm_setzero_si128(),
+		aux_128i_b_lo , aux_128i_b_hi,
+		aux_128i_c_lo, aux_128i_c_hi;
+	// __m128i m128i_mod_255 = _mm_set1_epi32(255);
 
-	/* Two's complement checksum */
-	uint32_t Twos_Checksum_a = 0u,
-		Twos_Checksum_b = 0u,
-		Twos_Checksum_c = 0u,
-		Twos_Checksum = 0u;
+	uint32_t val_b_lo[4] = { 0u }, 
+		val_b_hi[4] = { 0u },
+		val_c_lo[4] = { 0u },
+		val_c_hi[4] = { 0u };
 
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
-	__m256i m256i_singleOne = _mm256_set1_epi32(1);
+	/* Fletcher checksum sequential */
+	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher; // , Fletcher_b_lo, Fletcher_b_hi, Fletcher_c_lo, Fletcher_c_hi;
+	Fletcher_a.ui32 = 0u;
+	Fletcher_b.ui32 = 0u;
+	Fletcher_c.ui32 = 0u;
+	Fletcher.ui32 = 0u;
+	/*
+	Fletcher_b_lo.ui32 = 0u,
+	Fletcher_b_hi.ui32 = 0u,
+	Fletcher_c_lo.ui32 = 0u,
+	Fletcher_c_hi.ui32 = 0u;
+	*/
 
-	// ==================================
-	//			CRC VARIABLES
-	// ==================================
-	uint32_t ui32_crc_a = INITIAL_REMAINDER,
-		ui32_crc_b = INITIAL_REMAINDER,
-		ui32_crc_c = INITIAL_REMAINDER,
-		ui32_crc = INITIAL_REMAINDER;
-	uint32_t val_b[8], val_c[8];
+	ui64_to_ui32_t Fletcher_aux;
+	Fletcher_aux.ui64 = 0u;
 
-	// ==================================
-	//			AUX VARIABLES
-	// ==================================
+	__m256i aux_256i_b, aux_256i_c;
 	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -6190,6 +8519,8 @@ static uint32_t smm_intel_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
+	float f32_a_part;
+
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
@@ -6205,124 +8536,121 @@ static uint32_t smm_intel_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
 
+				// Casting of the variables (B and C values)
+				aux_256i_b = _mm256_castps_si256(b256);
+				aux_256i_c = _mm256_castps_si256(result256);
 
 				// =====================================================
-				//				INTERNAL TWOS
+				//				FLETCHER INTERNAL
 				// =====================================================
-				// Evaluation of the ES (B value)
-				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
-				m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
-				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
+				// Fletcher computation B
+				aux_128i_b_lo = _mm256_extractf128_si256(aux_256i_b, 0);
+				aux_128i_b_hi = _mm256_extractf128_si256(aux_256i_b, 1);
 
-				// Evaluation of the ES (C value)
-				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
-				m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
-				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
+				m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
+				m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+				m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
+				m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+
+
+				// Fletcher computation C
+				aux_128i_c_lo = _mm256_extractf128_si256(aux_256i_c, 0);
+				aux_128i_c_hi = _mm256_extractf128_si256(aux_256i_c, 1);
+
+				m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
+				m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+				m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
+				m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+
+				// Modulo 65535 of the Fletcher lanes with SIMD instructions (see fletcher_mod65535_epi32)
+				m128i_Fletcher_b_lo = fletcher_mod65535_epi32(m128i_Fletcher_b_lo);
+				m128i_Fletcher_b_hi = fletcher_mod65535_epi32(m128i_Fletcher_b_hi);
+				m128i_Fletcher_c_lo = fletcher_mod65535_epi32(m128i_Fletcher_c_lo);
+				m128i_Fletcher_c_hi = fletcher_mod65535_epi32(m128i_Fletcher_c_hi);
 			}
 
+			// Evaluation of the ES (A value)
+			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
+
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* Twos' checksum */
-					Twos_Checksum_b += (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Twos_Checksum_b = (~Twos_Checksum_b) + 1;
-					Twos_Checksum_c += (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-					Twos_Checksum_c = (~Twos_Checksum_c) + 1;
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, (uint32_t) * (uint32_t *)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, (uint32_t) * (uint32_t *)&paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
-			// =====================================================
-			//				INTERMEDIATE CRC
-			// =====================================================
-			memcpy(val_b, &m256i_twos_b, sizeof(val_b));
-			memcpy(val_c, &m256i_twos_c, sizeof(val_c));
-			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
-			{
-				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b[ui32_idx_l]);
-				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c[ui32_idx_l]);
-			}
-
-			if (0 != (ui32_n % 8)) {
-				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, Twos_Checksum_b);
-				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, Twos_Checksum_c);
-			}
-			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) *((uint32_t*)&f32_a_part));
-
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
-	ui32_crc = _mm_crc32_u32(ui32_crc_a, ui32_crc_b);
-	ui32_crc = _mm_crc32_u32(ui32_crc, ui32_crc_c);
-	return ui32_crc;
-}
+	memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
+	memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
+	memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
+	memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
+	{
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
+	}
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
 
+	// Fletcher computation
+	/*
+	m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, m128i_Fletcher_c_lo);
+	m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+	m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, m128i_Fletcher_c_hi);
+	m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
 
-/*==============================================================================================================
-**									Name: smm_intel_ones_crc
-==============================================================================================================*/
-/*!
-** @brief Matrix-matrix multiplication (MMM) with ONES checksum in the internal loop and CRC checksum in the
-**        intermediate loop
-**
-** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
-** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
-** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
-** @param[in] f32_alpha		Correction factor
-** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
-** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
-**
-** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+	memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(float32_t) * 4);
+	memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(float32_t) * 4);
+	for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
+	{
+		Fletcher.ui32 = (uint32_t) * (uint32_t*)&val_b_lo[ui32_idx_l];
+		Fletcher.ui16[0] %= 255;
+		Fletcher.ui16[1] %= 255;
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b,Fletcher.ui32);
+
+		Fletcher.ui32 = (uint32_t) * (uint32_t*)&val_b_hi[ui32_idx_l];
+		Fletcher.ui16[0] %= 255;
+		Fletcher.ui16[1] %= 255;
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, Fletcher.ui32);
+	}
+	Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, Fletcher_b.ui32);
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_c, Fletcher_a.ui32);
+	*/
+	return Fletcher.ui32;
+}
+SMM_MADD_VARIANTS(smm_intel_fletcher_internal, TARGET_AVX2)
+/*==============================================================================================================
+**									Name: smm_intel_crc_external_rows
+==============================================================================================================*/
+/*!
+** @brief MMM of smm_intel_crc_external that returns the CRC chains of A, B and C instead of the execution signature
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[out] aui32_crc 	CRC chains (e_crc_stream), started at INITIAL_REMAINDER
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 ==============================================================================================================*/
-static uint32_t smm_intel_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 void_t smm_intel_crc_external_rows(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX], const bool32_t b32_fma)
 {
-	// ==================================
-	//			ONES VARIABLES
-	// ==================================
-	// AVX variables
-	__m256i  Ones_checksum_b_hi = _mm256_setzero_si256(),
-		Ones_checksum_b_lo = _mm256_setzero_si256(),
-		Ones_checksum_c_hi = _mm256_setzero_si256(),
-		Ones_checksum_c_lo = _mm256_setzero_si256();
-
-	__m256i b_aux_lo, b_aux_hi,
-		c_aux_lo, c_aux_hi,
-		m256i_zeros = _mm256_setzero_si256();
-
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
-
-	// C variables
-	ui64_to_ui32_t Ones_Checksum_a,
-		Ones_Checksum_b,
-		Ones_Checksum_c,
-		Ones_Checksum;
-
-	Ones_Checksum_a.ui64 = 0u;
-	Ones_Checksum_b.ui64 = 0u;
-	Ones_Checksum_c.ui64 = 0u;
-	Ones_Checksum.ui64 = 0u;
-
-	// ==================================
-	//			CRC VARIABLES
-	// ==================================
 	uint32_t ui32_crc_a = INITIAL_REMAINDER,
 		ui32_crc_b = INITIAL_REMAINDER,
-		ui32_crc_c = INITIAL_REMAINDER,
-		ui32_crc = INITIAL_REMAINDER;
-	uint32_t val_b[8], val_c[8];
+		ui32_crc_c = INITIAL_REMAINDER;
 
-	// ==================================
-	//			AUX VARIABLES
-	// ==================================
 	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -6333,6 +8661,10 @@ static uint32_t smm_intel_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
+	uint32_t val_b[8], val_c[8];
+
+	float A_PART;
+
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
@@ -6341,111 +8673,48 @@ static uint32_t smm_intel_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 		ui32_idx_b_ref = 0u;
 		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
 		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
+			A_PART = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(A_PART);
 
 			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
-
-
-				// =====================================================
-				//				INTERNAL ONES COMPLEMENT
-				// =====================================================
-				// Evaluation of the ES (B value)
-				b_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(b256), m256i_zeros);
-				Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, b_aux_hi);
-				Ones_checksum_b_hi = _mm256_hadd_epi32(Ones_checksum_b_hi, Ones_checksum_b_hi);
-				Ones_checksum_b_hi = _mm256_xor_si256(Ones_checksum_b_hi, m256i_Ones);
-				Ones_checksum_b_hi = _mm256_unpackhi_epi32(Ones_checksum_b_hi, m256i_zeros);
-
-
-				b_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(b256), m256i_zeros);
-				Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, b_aux_lo);
-				Ones_checksum_b_lo = _mm256_hadd_epi32(Ones_checksum_b_lo, Ones_checksum_b_lo);
-				Ones_checksum_b_lo = _mm256_xor_si256(Ones_checksum_b_lo, m256i_Ones);
-				Ones_checksum_b_lo = _mm256_unpackhi_epi32(Ones_checksum_b_lo, m256i_zeros);
-
-
-				// Evaluation of the ES (C value)
-				c_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(result256), m256i_zeros);
-				Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, c_aux_hi);
-				Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
-				Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
-				Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
-
-
-				c_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(result256), m256i_zeros);
-				Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, c_aux_lo);
-				Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
-				Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
-				Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
 			}
 
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* One's complement checksum */
-					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
-					Ones_Checksum_b.ui32[0] = ~Ones_Checksum_b.ui32[0];
-
-					Ones_Checksum_c.ui64 += (uint64_t) * ((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-					Ones_Checksum_c.ui32[0] += Ones_Checksum_c.ui32[1];
-					Ones_Checksum_c.ui32[0] = ~Ones_Checksum_c.ui32[0];
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(A_PART, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
-			// =====================================================
-			//				INTERMEDIATE CRC
-			// =====================================================
-			// Evaluation of the ES (C value)
-			Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_c_lo);
-			Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
-			Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
-			Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
-
-			Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_b_hi, Ones_checksum_b_lo);
-			Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
-			Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
-			Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
-
-
-			memcpy(val_b, &Ones_checksum_c_hi, sizeof(val_b));
-			memcpy(val_c, &Ones_checksum_c_lo, sizeof(val_c));
-			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
-			{
-				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b[ui32_idx_l]);
-				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c[ui32_idx_l]);
-			}
-
-			if (0 != prev_end) {
-				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, Ones_Checksum_b.ui32[0]);
-				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, Ones_Checksum_c.ui32[0]);
-			}
-			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) *((uint32_t*)&f32_a_part));
-
 			ui32_idx_b_ref += ui32_n;
 		}
+		// Evaluation of the ES (A value)
+		ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) * (uint32_t*)&A_PART);
+
+		memcpy(val_b, &b256, sizeof(float32_t) * 8);
+		memcpy(val_c, &result256, sizeof(float32_t) * 8);
+		for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
+		{
+			ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b[ui32_idx_l]);
+			ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c[ui32_idx_l]);
+		}
+
 		ui32_idx_c_ref += ui32_n;
 	}
-	ui32_crc = _mm_crc32_u32(ui32_crc_a, ui32_crc_b);
-	ui32_crc = _mm_crc32_u32(ui32_crc, ui32_crc_c);
-	return ui32_crc;
+	aui32_crc[e_CRC_STREAM_A] = ui32_crc_a;
+	aui32_crc[e_CRC_STREAM_B] = ui32_crc_b;
+	aui32_crc[e_CRC_STREAM_C] = ui32_crc_c;
 }
 
 /*==============================================================================================================
-**									Name: smm_intel_ones_flet
+**									Name: smm_intel_crc_external
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with ONES checksum in the internal loop and Fletcher checksum in the
-**        intermediate loop
+** @brief Matrix-matrix multiplication (MMM) with CRC checksum in the external loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
@@ -6453,68 +8722,73 @@ static uint32_t smm_intel_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui
 ** @param[in] f32_alpha		Correction factor
 ** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
 ** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
-** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	Fletcher.ui32	Return the Execution signature of the MMM
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_crc_external(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// ==================================
-	//			ONES VARIABLES
-	// ==================================
-	// AVX variables
-	__m256i  Ones_checksum_b_hi = _mm256_setzero_si256(),
-		Ones_checksum_b_lo = _mm256_setzero_si256(),
-		Ones_checksum_c_hi = _mm256_setzero_si256(),
-		Ones_checksum_c_lo = _mm256_setzero_si256();
-
-	__m256i b_aux_lo, b_aux_hi,
-		c_aux_lo, c_aux_hi,
-		m256i_zeros = _mm256_setzero_si256();
-
-	__m256i m256i_Ones = _mm256_set1_epi32(-1);
-
-	// C variables
-	ui64_to_ui32_t Ones_Checksum_a,
-		Ones_Checksum_b,
-		Ones_Checksum_c,
-		Ones_Checksum;
-
-	Ones_Checksum_a.ui64 = 0u;
-	Ones_Checksum_b.ui64 = 0u;
-	Ones_Checksum_c.ui64 = 0u;
-	Ones_Checksum.ui64 = 0u;
+	uint32_t aui32_crc[e_CRC_STREAM_MAX];
+	uint32_t ui32_crc;
 
-	// ==================================
-	//			FLETCHER VARIABLES
-	// ==================================
-	/* Fletcher Checksum with SIMD instructions(B and C) */
-	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
-		m128i_Fletcher_b_hi = _mm_setzero_si128(),
-		m128i_Fletcher_c_lo = _mm_setzero_si128(),
-		m128i_Fletcher_c_hi = _mm_setzero_si128(),
-		aux_128i_b_lo, aux_128i_b_hi,
-		aux_128i_c_lo, aux_128i_c_hi;
-	
-	uint32_t val_b_lo[4] = { 0u },
-		val_b_hi[4] = { 0u },
-		val_c_lo[4] = { 0u },
-		val_c_hi[4] = { 0u };
+	smm_intel_crc_external_rows(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, aui32_crc, b32_fma);
+	ui32_crc = _mm_crc32_u32(aui32_crc[e_CRC_STREAM_A], aui32_crc[e_CRC_STREAM_B]);
+	ui32_crc = _mm_crc32_u32(ui32_crc, aui32_crc[e_CRC_STREAM_C]);
+	return ui32_crc;
+}
+SMM_MADD_VARIANTS(smm_intel_crc_external, TARGET_AVX2)
 
-	/* Fletcher checksum sequential */
-	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher, Fletcher_aux;
-	Fletcher_a.ui32 = 0u;
-	Fletcher_b.ui32 = 0u;
-	Fletcher_c.ui32 = 0u;
-	Fletcher_aux.ui32 = 0u;
-	Fletcher.ui32 = 0u;
+/*==============================================================================================================
+**									Name: smm_intel_crc_external_shard
+==============================================================================================================*/
+/*!
+** @brief Row shard of smm_intel_crc_external executed with threads (smm_par_shards): CRC chains of its
+** 		  A, B and C values and their lengths (one A value and 8 B / C values per row)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] pst_sig 		Signature state of the shard (e_SHARD_MERGE_CRC)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 void_t smm_intel_crc_external_shard(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig, const bool32_t b32_fma)
+{
+	memset(pst_sig, 0, sizeof(*pst_sig));
+	smm_intel_crc_external_rows(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, pst_sig->aui32_crc, b32_fma);
+	pst_sig->aui64_len[e_CRC_STREAM_A] = (uint64_t)ui32_m * sizeof(float32_t);
+	pst_sig->aui64_len[e_CRC_STREAM_B] = (uint64_t)ui32_m * 8u * sizeof(float32_t);
+	pst_sig->aui64_len[e_CRC_STREAM_C] = (uint64_t)ui32_m * 8u * sizeof(float32_t);
+}
+SMM_SHARD_VARIANTS(smm_intel_crc_external_shard, TARGET_AVX2)
 
+/*==============================================================================================================
+**									Name: smm_intel_crc_intermediate_rows
+==============================================================================================================*/
+/*!
+** @brief MMM of smm_intel_crc_intermediate that returns the CRC chains of A, B and C instead of the execution signature
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha Correction factor
+** @param[in] paf32_ma 	Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 	Pointer to the first position of an array of floats (B matrix direction)
+** @param[out] aui32_crc 	CRC chains (e_crc_stream), started at INITIAL_REMAINDER
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 void_t smm_intel_crc_intermediate_rows(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX], const bool32_t b32_fma)
+{
+	uint32_t ui32_crc_a = INITIAL_REMAINDER,
+		ui32_crc_b = INITIAL_REMAINDER,
+		ui32_crc_c = INITIAL_REMAINDER;
 
-	// ==================================
-	//			AUX VARIABLES
-	// ==================================
 	__m256 a256, b256, c256, result256;    // AVX
-	float f32_a_part;
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
@@ -6525,7 +8799,7 @@ static uint32_t smm_intel_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
-
+	uint32_t val_b[8], val_c[8];
 	uint32_t prev_end;
 	prev_end = (ui32_n % 8);
 
@@ -6534,149 +8808,107 @@ static uint32_t smm_intel_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 		ui32_idx_b_ref = 0u;
 		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
 		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
+			float A_PART = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(A_PART);
 
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
-			{
+			// Evaluation of the ES (A value)
+			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) * (uint32_t*)&A_PART);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			{
 				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
 				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
 				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+			}
 
-
-				// =====================================================
-				//				INTERNAL ONES COMPLEMENT
-				// =====================================================
-				// Evaluation of the ES (B value)
-				b_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(b256), m256i_zeros);
-				Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, b_aux_hi);
-				Ones_checksum_b_hi = _mm256_hadd_epi32(Ones_checksum_b_hi, Ones_checksum_b_hi);
-				Ones_checksum_b_hi = _mm256_xor_si256(Ones_checksum_b_hi, m256i_Ones);
-				Ones_checksum_b_hi = _mm256_unpackhi_epi32(Ones_checksum_b_hi, m256i_zeros);
-
-
-				b_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(b256), m256i_zeros);
-				Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, b_aux_lo);
-				Ones_checksum_b_lo = _mm256_hadd_epi32(Ones_checksum_b_lo, Ones_checksum_b_lo);
-				Ones_checksum_b_lo = _mm256_xor_si256(Ones_checksum_b_lo, m256i_Ones);
-				Ones_checksum_b_lo = _mm256_unpackhi_epi32(Ones_checksum_b_lo, m256i_zeros);
-
-
-				// Evaluation of the ES (C value)
-				c_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(result256), m256i_zeros);
-				Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, c_aux_hi);
-				Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
-				Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
-				Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
-
-
-				c_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(result256), m256i_zeros);
-				Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, c_aux_lo);
-				Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
-				Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
-				Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
+			memcpy(val_b, &b256, sizeof(val_b));
+			memcpy(val_c, &result256, sizeof(val_c));
+			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
+			{
+				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b[ui32_idx_l]);
+				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c[ui32_idx_l]);
 			}
 
 			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					/* One's complement checksum */
-					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
-					Ones_Checksum_b.ui32[0] = ~Ones_Checksum_b.ui32[0];
-
-					Ones_Checksum_c.ui64 += (uint64_t) * ((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
-					Ones_Checksum_c.ui32[0] += Ones_Checksum_c.ui32[1];
-					Ones_Checksum_c.ui32[0] = ~Ones_Checksum_c.ui32[0];
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(A_PART, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
-			// =====================================================
-			//				INTERMEDIATE FLETCHER
-			// =====================================================
-			// Evaluation of the ES (C value)
-			Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_c_lo);
-			Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
-			Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
-			Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
-
-			Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_b_hi, Ones_checksum_b_lo);
-			Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
-			Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
-			Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
-
-			// Evaluation of the ES (A value)
-			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
-
-			// Fletcher computation B
-			aux_128i_b_lo = _mm256_extractf128_si256(Ones_checksum_c_hi, 0);
-			aux_128i_b_hi = _mm256_extractf128_si256(Ones_checksum_c_hi, 1);
-
-			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
-			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
-			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-
-
-			// Fletcher computation C
-			aux_128i_c_lo = _mm256_extractf128_si256(Ones_checksum_c_lo, 0);
-			aux_128i_c_hi = _mm256_extractf128_si256(Ones_checksum_c_lo, 1);
-
-			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
-			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
-			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-
-			memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
-			memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
-			memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
-			memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
-			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
-			{
-				val_b_lo[ui32_idx_l] %= 65535;
-				val_b_hi[ui32_idx_l] %= 65535;
-				val_c_lo[ui32_idx_l] %= 65535;
-				val_c_hi[ui32_idx_l] %= 65535;
-			}
-			memcpy(&m128i_Fletcher_b_lo, val_b_lo, sizeof(val_b_lo));
-			memcpy(&m128i_Fletcher_b_hi, val_b_hi, sizeof(val_b_hi));
-			memcpy(&m128i_Fletcher_c_lo, val_c_lo, sizeof(val_c_lo));
-			memcpy(&m128i_Fletcher_c_hi, val_c_hi, sizeof(val_c_hi));
-
-			if (0 != (ui32_n % 8)) {
-				Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, Ones_Checksum_b.ui32[0]);
-				Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, Ones_Checksum_c.ui32[0]);
-			}
-			// Evaluation of the ES (A value)
-			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
 
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
-	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
-	{
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
-		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
-		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
-	}
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
-	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
-	return Fletcher.ui32;
+	aui32_crc[e_CRC_STREAM_A] = ui32_crc_a;
+	aui32_crc[e_CRC_STREAM_B] = ui32_crc_b;
+	aui32_crc[e_CRC_STREAM_C] = ui32_crc_c;
+}
+
+/*==============================================================================================================
+**									Name: smm_intel_crc_intermediate
+==============================================================================================================*/
+/*!
+** @brief Matrix-matrix multiplication (MMM) with CRC checksum in the intermediate loop
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_crc_intermediate(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	uint32_t aui32_crc[e_CRC_STREAM_MAX];
+	uint32_t ui32_crc;
+
+	smm_intel_crc_intermediate_rows(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, aui32_crc, b32_fma);
+	ui32_crc = _mm_crc32_u32(aui32_crc[e_CRC_STREAM_A], aui32_crc[e_CRC_STREAM_B]);
+	ui32_crc = _mm_crc32_u32(ui32_crc, aui32_crc[e_CRC_STREAM_C]);
+	return ui32_crc;
 }
+SMM_MADD_VARIANTS(smm_intel_crc_intermediate, TARGET_AVX2)
 
+/*==============================================================================================================
+**									Name: smm_intel_crc_intermediate_shard
+==============================================================================================================*/
+/*!
+** @brief Row shard of smm_intel_crc_intermediate executed with threads (smm_par_shards): CRC chains of its
+** 		  A, B and C values and their lengths (one A value and 8 + n % 8 B / C values per (i, k))
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] pst_sig 		Signature state of the shard (e_SHARD_MERGE_CRC)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 void_t smm_intel_crc_intermediate_shard(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig, const bool32_t b32_fma)
+{
+	memset(pst_sig, 0, sizeof(*pst_sig));
+	smm_intel_crc_intermediate_rows(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, pst_sig->aui32_crc, b32_fma);
+	pst_sig->aui64_len[e_CRC_STREAM_A] = (uint64_t)ui32_m * ui32_k * sizeof(float32_t);
+	pst_sig->aui64_len[e_CRC_STREAM_B] = (uint64_t)ui32_m * ui32_k * (8u + (ui32_n % 8u)) * sizeof(float32_t);
+	pst_sig->aui64_len[e_CRC_STREAM_C] = (uint64_t)ui32_m * ui32_k * (8u + (ui32_n % 8u)) * sizeof(float32_t);
+}
+SMM_SHARD_VARIANTS(smm_intel_crc_intermediate_shard, TARGET_AVX2)
 
 /*==============================================================================================================
-**									Name: smm_intel_flet_crc
+**									Name: smm_intel_crc_internal
 ==============================================================================================================*/
 /*!
-** @brief Matrix-matrix multiplication (MMM) with ONES checksum in the internal loop and Fletcher checksum in the
-**        intermediate loop
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
 **
 ** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
 ** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
@@ -6685,154 +8917,3044 @@ static uint32_t smm_intel_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t u
 ** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
 ** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
 ** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
 **
-** @return uint32_t  	Fletcher.ui32	Return the Execution signature of the MMM
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
 ==============================================================================================================*/
-static uint32_t smm_intel_flet_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+static FORCE_INLINE TARGET_AVX2_CLMUL uint32_t smm_intel_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
 {
-	// ==================================
-	//			FLETCHER VARIABLES
-	// ==================================
-	// Fletcher Checksum with SIMD instructions(B and C)
-	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
-		m128i_Fletcher_b_hi = _mm_setzero_si128(),
-		m128i_Fletcher_c_lo = _mm_setzero_si128(),
-		m128i_Fletcher_c_hi = _mm_setzero_si128(),
-		aux_128i_b_lo, aux_128i_b_hi,
-		aux_128i_c_lo, aux_128i_c_hi;
-	// __m128i m128i_mod_255 = _mm_set1_epi32(255);
+	uint32_t aui32_crc[e_CRC_STREAM_MAX];
+	uint32_t ui32_crc;
 
-	/* Fletcher checksum sequential */
-	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher;
-	Fletcher_a.ui32 = 0u;
-	Fletcher_b.ui32 = 0u;
-	Fletcher_c.ui32 = 0u;
-	Fletcher.ui32 = 0u;
+	smm_intel_crc_internal_rows(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, aui32_crc, b32_fma);
+	ui32_crc = singletable_crc32c_ui32(aui32_crc[e_CRC_STREAM_A], aui32_crc[e_CRC_STREAM_B]);
+	ui32_crc = singletable_crc32c_ui32(ui32_crc, aui32_crc[e_CRC_STREAM_C]);
+	return ui32_crc;
+}
+SMM_MADD_VARIANTS(smm_intel_crc_internal, TARGET_AVX2_CLMUL)
 
-	uint32_t val_b_lo[4], val_b_hi[4], val_c_lo[4], val_c_hi[4];
+/*==============================================================================================================
+**									Name: smm_intel_crc_internal_shard
+==============================================================================================================*/
+/*!
+** @brief Row shard of smm_intel_crc_internal executed with threads (smm_par_shards): CRC chains of its
+** 		  A, B and C values and their lengths (one A value and n B / C values per (i, k))
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] pst_sig 		Signature state of the shard (e_SHARD_MERGE_CRC)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2_CLMUL void_t smm_intel_crc_internal_shard(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig, const bool32_t b32_fma)
+{
+	memset(pst_sig, 0, sizeof(*pst_sig));
+	smm_intel_crc_internal_rows(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, pst_sig->aui32_crc, b32_fma);
+	pst_sig->aui64_len[e_CRC_STREAM_A] = (uint64_t)ui32_m * ui32_k * sizeof(float32_t);
+	pst_sig->aui64_len[e_CRC_STREAM_B] = (uint64_t)ui32_m * ui32_k * ui32_n * sizeof(float32_t);
+	pst_sig->aui64_len[e_CRC_STREAM_C] = (uint64_t)ui32_m * ui32_k * ui32_n * sizeof(float32_t);
+}
+SMM_SHARD_VARIANTS(smm_intel_crc_internal_shard, TARGET_AVX2_CLMUL)
 
-	// ==================================
-	//			CRC VARIABLES
-	// ==================================
+/*==============================================================================================================
+**									Name: smm_intel_crc_internal_rows
+==============================================================================================================*/
+/*!
+** @brief MMM of smm_intel_crc_internal that returns the CRC chains of A, B and C instead of the execution signature
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[out] aui32_crc 	CRC chains (e_crc_stream), started at INITIAL_REMAINDER
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE)
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2_CLMUL void_t smm_intel_crc_internal_rows(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX], const bool32_t b32_fma)
+{
 	uint32_t ui32_crc_a = INITIAL_REMAINDER,
 		ui32_crc_b = INITIAL_REMAINDER,
-		ui32_crc_c = INITIAL_REMAINDER,
-		ui32_crc = INITIAL_REMAINDER;
+		ui32_crc_c = INITIAL_REMAINDER;
+
+	/* 3-way CRC: the full vectors of a row of B / C are split in 3 segments that are signed in parallel
+	   (6 independent crc32 chains instead of 2), then merged with a carry-less shift of ui32_seg vectors */
+	uint32_t ui32_crc_b1, ui32_crc_b2,
+		ui32_crc_c1, ui32_crc_c2;
+	const uint32_t ui32_nv = ui32_n / 8u,       /* full vectors of a row */
+		ui32_seg = ui32_nv / 3u;                /* vectors of a segment */
+	__m128i m128i_k_seg = _mm_setzero_si128();
 
-	__m256i aux_256i_b, aux_256i_c;
 	__m256 a256, b256, c256, result256;    // AVX
 
 	uint32_t ui32_idx_i = 0u,
 		ui32_idx_j = 0u,
 		ui32_idx_k = 0u,
 		ui32_idx_a = 0u,
-		ui32_idx_b = 0u,
-		ui32_idx_c = 0u,
+		ui32_idx_v = 0u,
 		ui32_idx_b_ref = 0u,
 		ui32_idx_c_ref = 0u;
 
-	float f32_a_part;
-	uint32_t prev_end;
-	prev_end = (ui32_n % 8);
+	if (ui32_seg != 0u)
+	{
+		m128i_k_seg = _mm_cvtsi32_si128((int32_t)crc32c_xpow((((uint64_t)ui32_seg * 8u * sizeof(float32_t)) * 8u) - 33u));
+	}
 
 	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
 	{
 		ui32_idx_b_ref = 0u;
 		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
 		{
-			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
-			a256 = _mm256_set1_ps(f32_a_part);
-
-			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
-			{
-				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
-				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
-				// FMA - Intel Haswell (2013), AMD Piledriver (2012)
-				//result256 = _mm256_fmadd_ps(a256, b256, c256);
-				result256 = _mm256_mul_ps(a256, b256);
-
-				result256 = _mm256_add_ps(result256, c256);
-				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
-
-				// Casting of the variables (B and C values)
-				aux_256i_b = _mm256_castps_si256(b256);
-				aux_256i_c = _mm256_castps_si256(result256);
-
-
-				// =====================================================
-				//				FLETCHER INTERNAL
-				// =====================================================
-				// Fletcher computation B
-				aux_128i_b_lo = _mm256_extractf128_si256(aux_256i_b, 0);
-				aux_128i_b_hi = _mm256_extractf128_si256(aux_256i_b, 1);
-
-				m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
-				m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-				m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
-				m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
-
-
-				// Fletcher computation C
-				aux_128i_c_lo = _mm256_extractf128_si256(aux_256i_c, 0);
-				aux_128i_c_hi = _mm256_extractf128_si256(aux_256i_c, 1);
+			const float32_t * const paf32_b_row = &paf32_mb[ui32_idx_b_ref];
+			float32_t * const paf32_c_row = &paf32_mc[ui32_idx_c_ref];
+			float A_PART = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(A_PART);
 
-				m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
-				m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
-				m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
-				m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+			// Evaluation of the ES (A value)
+			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) * (uint32_t*)&A_PART);
 
-				// Fletcher checksum requires a modulo operation. This algebraic operation is not implemented with
-				// SIMD instructions, and therefore, it has to be implemented with sequential instructions and it will
-				// produce an increment in the performance impact
-				memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
-				memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
-				memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
-				memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
-				for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
+			/* Segments [0, seg), [seg, 2 seg), [2 seg, 3 seg): the 2nd and 3rd chains start at 0 */
+			if (ui32_seg != 0u)
+			{
+				ui32_crc_b1 = 0u;
+				ui32_crc_b2 = 0u;
+				ui32_crc_c1 = 0u;
+				ui32_crc_c2 = 0u;
+				for (ui32_idx_v = 0u, ui32_idx_j = 0u; ui32_idx_v < ui32_seg; ui32_idx_v++, ui32_idx_j += 8u)
 				{
-					val_b_lo[ui32_idx_l] %= 65535;
-					val_b_hi[ui32_idx_l] %= 65535;
-					val_c_lo[ui32_idx_l] %= 65535;
-					val_c_hi[ui32_idx_l] %= 65535;
+					// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+					b256 = _mm256_loadu_ps(&paf32_b_row[ui32_idx_j]);
+					c256 = _mm256_loadu_ps(&paf32_c_row[ui32_idx_j]);
+					result256 = SMM_MADD_PS(a256, b256, c256);
+					_mm256_storeu_ps(&paf32_c_row[ui32_idx_j], result256);
+					ui32_crc_b = crc32c_m256(ui32_crc_b, _mm256_castps_si256(b256));
+					ui32_crc_c = crc32c_m256(ui32_crc_c, _mm256_castps_si256(result256));
+
+					b256 = _mm256_loadu_ps(&paf32_b_row[ui32_idx_j + (ui32_seg * 8u)]);
+					c256 = _mm256_loadu_ps(&paf32_c_row[ui32_idx_j + (ui32_seg * 8u)]);
+					result256 = SMM_MADD_PS(a256, b256, c256);
+					_mm256_storeu_ps(&paf32_c_row[ui32_idx_j + (ui32_seg * 8u)], result256);
+					ui32_crc_b1 = crc32c_m256(ui32_crc_b1, _mm256_castps_si256(b256));
+					ui32_crc_c1 = crc32c_m256(ui32_crc_c1, _mm256_castps_si256(result256));
+
+					b256 = _mm256_loadu_ps(&paf32_b_row[ui32_idx_j + (ui32_seg * 16u)]);
+					c256 = _mm256_loadu_ps(&paf32_c_row[ui32_idx_j + (ui32_seg * 16u)]);
+					result256 = SMM_MADD_PS(a256, b256, c256);
+					_mm256_storeu_ps(&paf32_c_row[ui32_idx_j + (ui32_seg * 16u)], result256);
+					ui32_crc_b2 = crc32c_m256(ui32_crc_b2, _mm256_castps_si256(b256));
+					ui32_crc_c2 = crc32c_m256(ui32_crc_c2, _mm256_castps_si256(result256));
 				}
-				memcpy(&m128i_Fletcher_b_lo, val_b_lo, sizeof(val_b_lo));
-				memcpy(&m128i_Fletcher_b_hi, val_b_hi, sizeof(val_b_hi));
-				memcpy(&m128i_Fletcher_c_lo, val_c_lo, sizeof(val_c_lo));
-				memcpy(&m128i_Fletcher_c_hi, val_c_hi, sizeof(val_c_hi));
+				/* crc(s, x | y) = shift(s, |y|) ^ crc(0, y) */
+				ui32_crc_b = crc32c_shift_clmul(crc32c_shift_clmul(ui32_crc_b, m128i_k_seg) ^ ui32_crc_b1, m128i_k_seg) ^ ui32_crc_b2;
+				ui32_crc_c = crc32c_shift_clmul(crc32c_shift_clmul(ui32_crc_c, m128i_k_seg) ^ ui32_crc_c1, m128i_k_seg) ^ ui32_crc_c2;
 			}
 
-			if (0 != prev_end) {
+			/* Remaining full vectors (0 to 2) */
+			for (ui32_idx_j = ui32_seg * 24u; ui32_idx_j < (ui32_nv * 8u); ui32_idx_j += 8u)
+			{
+				b256 = _mm256_loadu_ps(&paf32_b_row[ui32_idx_j]);
+				c256 = _mm256_loadu_ps(&paf32_c_row[ui32_idx_j]);
+				result256 = SMM_MADD_PS(a256, b256, c256);
+				_mm256_storeu_ps(&paf32_c_row[ui32_idx_j], result256);
+				ui32_crc_b = crc32c_m256(ui32_crc_b, _mm256_castps_si256(b256));
+				ui32_crc_c = crc32c_m256(ui32_crc_c, _mm256_castps_si256(result256));
+			}
+
+			/* Tail (ui32_n % 8 columns) */
+			for (; ui32_idx_j < ui32_n; ++ui32_idx_j)
+			{
+				paf32_c_row[ui32_idx_j] = SMM_MADD_F32(A_PART, paf32_b_row[ui32_idx_j], paf32_c_row[ui32_idx_j]);
+				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&paf32_b_row[ui32_idx_j]);
+				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&paf32_c_row[ui32_idx_j]);
+			}
+			ui32_idx_b_ref += ui32_n;
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+	aui32_crc[e_CRC_STREAM_A] = ui32_crc_a;
+	aui32_crc[e_CRC_STREAM_B] = ui32_crc_b;
+	aui32_crc[e_CRC_STREAM_C] = ui32_crc_c;
+}
+
+/*==============================================================================================================
+**									Name: smm_intel_crc_internal_rows_fma
+==============================================================================================================*/
+/*!
+** @brief smm_intel_crc_internal_rows with FMA (row shards of PAR_INTEL_CRC_INTERNAL)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] aui32_crc 	CRC32C chains of the A, B and C streams (e_crc_stream)
+==============================================================================================================*/
+static TARGET_AVX2_CLMUL void_t smm_intel_crc_internal_rows_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX])
+{
+	smm_intel_crc_internal_rows(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, aui32_crc, TRUE);
+}
+
+/*==============================================================================================================
+**									Name: smm_intel_crc_internal_rows_mul_add
+==============================================================================================================*/
+/*!
+** @brief smm_intel_crc_internal_rows with mul + add (row shards of PAR_INTEL_CRC_INTERNAL)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] aui32_crc 	CRC32C chains of the A, B and C streams (e_crc_stream)
+==============================================================================================================*/
+static TARGET_AVX2_CLMUL void_t smm_intel_crc_internal_rows_mul_add(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, uint32_t aui32_crc[e_CRC_STREAM_MAX])
+{
+	smm_intel_crc_internal_rows(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, aui32_crc, FALSE);
+}
+
+/* ==============================================================================================================
+* 	Name: smm_gemm_nn_instrics_intel
+* ============================================================================================================== */
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_gemm_nn_intrincs_intel(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	__m256 a256, b256, c256, result256;    // AVX
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b = 0u,
+		ui32_idx_c = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+
+	uint32_t prev_end;
+	prev_end = (ui32_n % 8);
+
+	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		{
+			float A_PART = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(A_PART);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			{
+				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
+				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
+				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+			}
+
+			if (0 != prev_end) {
 				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
-					paf32_mc[ui32_idx_c + ui32_idx_j] += f32_a_part * paf32_mb[ui32_idx_b + ui32_idx_j];
-					Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, (uint32_t) * (uint32_t *)&paf32_mb[ui32_idx_b + ui32_idx_j]);
-					Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, (uint32_t) * (uint32_t *)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(A_PART, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
 				}
 			}
-			// =====================================================
-			//				INTERMEDIATE CRC
-			// =====================================================
-			// CRC computation C
-			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) *((uint32_t*)&f32_a_part));
+			ui32_idx_b_ref += ui32_n;
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+	return 0u;
+}
+SMM_MADD_VARIANTS(smm_gemm_nn_intrincs_intel, TARGET_AVX2)
 
-			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
+/*==============================================================================================================
+**									Name: smm_intel_xor_flet
+==============================================================================================================*/
+/*!
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_xor	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_xor_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	// ==================================
+	//			XOR VARIABLES
+	// ==================================
+	/* XOR checksum */
+	__m256i m256i_xor_b = _mm256_setzero_si256(),
+		m256i_xor_c = _mm256_setzero_si256();
+
+	/* XOR checksum */
+	uint32_t ui32_xor_a = 0u,
+		ui32_xor_b = 0u,
+		ui32_xor_c = 0u,
+		ui32_xor = 0u;
+
+	// ==================================
+	//			FLETCHER VARIABLES
+	// ==================================
+	/* Fletcher Checksum with SIMD instructions(B and C) */
+	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
+		m128i_Fletcher_b_hi = _mm_setzero_si128(),
+		m128i_Fletcher_c_lo = _mm_setzero_si128(),
+		m128i_Fletcher_c_hi = _mm_setzero_si128(),
+		aux_128i_b_lo, aux_128i_b_hi,
+		aux_128i_c_lo, aux_128i_c_hi;
+
+	uint32_t val_b_lo[4] = { 0u },
+		val_b_hi[4] = { 0u },
+		val_c_lo[4] = { 0u },
+		val_c_hi[4] = { 0u };
+
+	/* Fletcher checksum sequential */
+	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher, Fletcher_aux;
+	Fletcher_a.ui32 = 0u;
+	Fletcher_b.ui32 = 0u;
+	Fletcher_c.ui32 = 0u;
+	Fletcher_aux.ui32 = 0u;
+	Fletcher.ui32 = 0u;
+
+	// ==================================
+	//			AUX VARIABLES
+	// ==================================
+	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b = 0u,
+		ui32_idx_c = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+
+	uint32_t prev_end;
+	prev_end = (ui32_n % 8);
+
+	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		{
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
 			{
-				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b_lo[ui32_idx_l]);
-				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b_hi[ui32_idx_l]);
-				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c_lo[ui32_idx_l]);
-				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c_hi[ui32_idx_l]);
+				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
+				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
+				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+
+				// Evaluation of the ES (B value)
+				m256i_xor_b = _mm256_xor_si256(m256i_xor_b, _mm256_castps_si256(b256));
+
+				// Evaluation of the ES (C value)
+				m256i_xor_c = _mm256_xor_si256(m256i_xor_c, _mm256_castps_si256(result256));
 			}
 
 			if (0 != prev_end) {
-				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, Fletcher_b.ui32);
-				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, Fletcher_c.ui32);
+				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* XOR checksum */
+					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+				}
 			}
+			// Fletcher computation A
+			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
+
+			// Fletcher computation B
+			aux_128i_b_lo = _mm256_extractf128_si256(m256i_xor_b, 0);
+			aux_128i_b_hi = _mm256_extractf128_si256(m256i_xor_b, 1);
+
+			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
+			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
+			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+
+
+			// Fletcher computation C
+			aux_128i_c_lo = _mm256_extractf128_si256(m256i_xor_c, 0);
+			aux_128i_c_hi = _mm256_extractf128_si256(m256i_xor_c, 1);
+
+			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
+			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
+			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+
+			// Modulo 65535 of the Fletcher lanes with SIMD instructions (see fletcher_mod65535_epi32)
+			m128i_Fletcher_b_lo = fletcher_mod65535_epi32(m128i_Fletcher_b_lo);
+			m128i_Fletcher_b_hi = fletcher_mod65535_epi32(m128i_Fletcher_b_hi);
+			m128i_Fletcher_c_lo = fletcher_mod65535_epi32(m128i_Fletcher_c_lo);
+			m128i_Fletcher_c_hi = fletcher_mod65535_epi32(m128i_Fletcher_c_hi);
 
+			if (0 != (ui32_n % 8)) {
+				Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, ui32_xor_b);
+				Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, ui32_xor_c);
+			}
 			ui32_idx_b_ref += ui32_n;
 		}
 		ui32_idx_c_ref += ui32_n;
 	}
-	ui32_crc = _mm_crc32_u32(ui32_crc_a, ui32_crc_b);
-	ui32_crc = _mm_crc32_u32(ui32_crc, ui32_crc_c);
-	return ui32_crc;
+	memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
+	memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
+	memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
+	memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
+	{
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
+	}
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
+
+	return Fletcher.ui32;
 }
+SMM_MADD_VARIANTS(smm_intel_xor_flet, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_intel_xor_crc
+==============================================================================================================*/
+/*!
+** @brief Matrix-matrix multiplication (MMM) with XOR checksum in the internal loop
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	// ==================================
+	//			XOR VARIABLES
+	// ==================================
+	/* XOR checksum */
+	__m256i m256i_xor_a = _mm256_setzero_si256(),
+		m256i_xor_b = _mm256_setzero_si256(),
+		m256i_xor_c = _mm256_setzero_si256(),
+		m256i_xor = _mm256_setzero_si256();
 
+	/* XOR checksum */
+	uint32_t ui32_xor_a = 0u,
+		ui32_xor_b = 0u,
+		ui32_xor_c = 0u,
+		ui32_xor = 0u;
+
+	// ==================================
+	//			CRC VARIABLES
+	// ==================================
+	uint32_t ui32_crc_a = INITIAL_REMAINDER,
+		ui32_crc_b = INITIAL_REMAINDER,
+		ui32_crc_c = INITIAL_REMAINDER,
+		ui32_crc = INITIAL_REMAINDER;
+	uint32_t val[8], val_b[8], val_c[8];
+
+	// ==================================
+	//			AUX VARIABLES
+	// ==================================
+	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b = 0u,
+		ui32_idx_c = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+
+	uint32_t prev_end;
+	prev_end = (ui32_n % 8);
+
+	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		{
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			{
+				//printf("\n Internal loop: idx_b:%d \tN=%d \t", ui32_idx_b, ui32_n);
+				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
+				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
+				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+
+
+				// =====================================================
+				//				INTERNAL XOR
+				// =====================================================
+				// Evaluation of the ES (B value)
+				m256i_xor_b = _mm256_xor_si256(m256i_xor_b, _mm256_castps_si256(b256));
+
+				// Evaluation of the ES (C value)
+				m256i_xor_c = _mm256_xor_si256(m256i_xor_c, _mm256_castps_si256(result256));
+			}
+
+			//printf("\n Intermediate loop: idx_b:%d \tN=%d \tidx_c=%d", ui32_idx_b, ui32_n, ui32_idx_c);
+			if (0 != prev_end) {
+				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* XOR checksum */
+					//printf("\n idx_c:%d \tidx_c=%d \t", ui32_idx_c + ui32_idx_j, ui32_idx_b + ui32_idx_j);
+					ui32_xor_b ^= (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					ui32_xor_c ^= (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+				}
+			}
+			m256i_xor_a = _mm256_xor_si256(m256i_xor_a, _mm256_castps_si256(a256));
+			m256i_xor = _mm256_xor_si256(m256i_xor_a, m256i_xor_b);
+			m256i_xor = _mm256_xor_si256(m256i_xor  , m256i_xor_c);
+
+			memcpy(val, &m256i_xor, sizeof(val));
+			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
+			{
+				ui32_crc = _mm_crc32_u32(ui32_crc, (uint32_t) * (uint32_t*)&val[ui32_idx_l]);
+			}
+
+			if (0 != prev_end) {
+				ui32_xor = (ui32_xor_a ^ ui32_xor_b) ^ ui32_xor_c;
+				ui32_crc = _mm_crc32_u32(ui32_crc, ui32_xor);
+			}
+
+
+			ui32_idx_b_ref += ui32_n;
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+	return ui32_crc;
+}
+SMM_MADD_VARIANTS(smm_intel_xor_crc, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_intel_twos_flet
+==============================================================================================================*/
+/*!
+** @brief Matrix-matrix multiplication (MMM) with TWOS checksum in the internal loop and Fletcher checksum in the
+**        intermediate loop
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	Fletcher.ui32	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	// ==================================
+	//			ONES VARIABLES
+	// ==================================
+	// AVX variables
+	__m256i m256i_twos_b = _mm256_setzero_si256(),
+		m256i_twos_c = _mm256_setzero_si256();
+
+	__m256i m256i_Ones = _mm256_set1_epi32(-1);
+	__m256i m256i_singleOne = _mm256_set1_epi32(1);
+
+
+	// C variables
+	uint32_t Twos_Checksum_a = 0u,
+		Twos_Checksum_b = 0u,
+		Twos_Checksum_c = 0u,
+		Twos_Checksum = 0u;
+
+	// ==================================
+	//			FLETCHER VARIABLES
+	// ==================================
+	/* Fletcher Checksum with SIMD instructions(B and C) */
+	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
+		m128i_Fletcher_b_hi = _mm_setzero_si128(),
+		m128i_Fletcher_c_lo = _mm_setzero_si128(),
+		m128i_Fletcher_c_hi = _mm_setzero_si128(),
+		aux_128i_b_lo, aux_128i_b_hi,
+		aux_128i_c_lo, aux_128i_c_hi;
+	
+	uint32_t val_b_lo[4] = { 0u },
+		val_b_hi[4] = { 0u },
+		val_c_lo[4] = { 0u },
+		val_c_hi[4] = { 0u };
+
+	/* Fletcher checksum sequential */
+	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher, Fletcher_aux;
+	Fletcher_a.ui32 = 0u;
+	Fletcher_b.ui32 = 0u;
+	Fletcher_c.ui32 = 0u;
+	Fletcher_aux.ui32 = 0u;
+	Fletcher.ui32 = 0u;
+
+
+	// ==================================
+	//			AUX VARIABLES
+	// ==================================
+	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b = 0u,
+		ui32_idx_c = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+
+	uint32_t prev_end;
+	prev_end = (ui32_n % 8);
+
+	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		{
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			{
+				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
+				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
+				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+
+
+				// =====================================================
+				//				INTERNAL TWOS
+				// =====================================================
+				// Evaluation of the ES (B value)
+				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
+				m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
+				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
+
+				// Evaluation of the ES (C value)
+				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
+				m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
+				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
+			}
+
+			if (0 != prev_end) {
+				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+
+					/* Twos' checksum */
+					// Evaluation of the ES (B value)
+					Twos_Checksum_b += (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Twos_Checksum_b = (~Twos_Checksum_b) + 1;
+					// Evaluation of the ES (C value)
+					Twos_Checksum_c += (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Twos_Checksum_c = (~Twos_Checksum_c) + 1;
+				}
+			}
+			// =====================================================
+			//				INTERMEDIATE FLETCHER
+			// =====================================================
+			// Evaluation of the ES (A value)
+			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
+
+			// Fletcher computation B
+			aux_128i_b_lo = _mm256_extractf128_si256(m256i_twos_b, 0);
+			aux_128i_b_hi = _mm256_extractf128_si256(m256i_twos_b, 1);
+
+			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
+			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
+			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+
+
+			// Fletcher computation C
+			aux_128i_c_lo = _mm256_extractf128_si256(m256i_twos_c, 0);
+			aux_128i_c_hi = _mm256_extractf128_si256(m256i_twos_c, 1);
+
+			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
+			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
+			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+
+			// Modulo 65535 of the Fletcher lanes with SIMD instructions (see fletcher_mod65535_epi32)
+			m128i_Fletcher_b_lo = fletcher_mod65535_epi32(m128i_Fletcher_b_lo);
+			m128i_Fletcher_b_hi = fletcher_mod65535_epi32(m128i_Fletcher_b_hi);
+			m128i_Fletcher_c_lo = fletcher_mod65535_epi32(m128i_Fletcher_c_lo);
+			m128i_Fletcher_c_hi = fletcher_mod65535_epi32(m128i_Fletcher_c_hi);
+
+			if (0 != prev_end) {
+				Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, Twos_Checksum_b);
+				Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, Twos_Checksum_c);
+			}
+			ui32_idx_b_ref += ui32_n;
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+	memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
+	memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
+	memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
+	memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
+	{
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
+	}
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
+
+	return Fletcher.ui32;
+}
+SMM_MADD_VARIANTS(smm_intel_twos_flet, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_intel_twos_crc
+==============================================================================================================*/
+/*!
+** @brief Matrix-matrix multiplication (MMM) with TWO's complement checksum in the internal loop and CRC in the
+**        intermediate loop
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	// ==================================
+	//			TWOS VARIABLES
+	// ==================================
+	__m256i m256i_twos_b = _mm256_setzero_si256(),
+		m256i_twos_c = _mm256_setzero_si256();
+
+	/* Two's complement checksum */
+	uint32_t Twos_Checksum_a = 0u,
+		Twos_Checksum_b = 0u,
+		Twos_Checksum_c = 0u,
+		Twos_Checksum = 0u;
+
+	__m256i m256i_Ones = _mm256_set1_epi32(-1);
+	__m256i m256i_singleOne = _mm256_set1_epi32(1);
+
+	// ==================================
+	//			CRC VARIABLES
+	// ==================================
+	uint32_t ui32_crc_a = INITIAL_REMAINDER,
+		ui32_crc_b = INITIAL_REMAINDER,
+		ui32_crc_c = INITIAL_REMAINDER,
+		ui32_crc = INITIAL_REMAINDER;
+	uint32_t val_b[8], val_c[8];
+
+	// ==================================
+	//			AUX VARIABLES
+	// ==================================
+	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b = 0u,
+		ui32_idx_c = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+
+	uint32_t prev_end;
+	prev_end = (ui32_n % 8);
+
+	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		{
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			{
+				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
+				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
+				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+
+
+				// =====================================================
+				//				INTERNAL TWOS
+				// =====================================================
+				// Evaluation of the ES (B value)
+				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, _mm256_castps_si256(b256));
+				m256i_twos_b = _mm256_xor_si256(m256i_twos_b, m256i_Ones);
+				m256i_twos_b = _mm256_add_epi32(m256i_twos_b, m256i_singleOne);
+
+				// Evaluation of the ES (C value)
+				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, _mm256_castps_si256(result256));
+				m256i_twos_c = _mm256_xor_si256(m256i_twos_c, m256i_Ones);
+				m256i_twos_c = _mm256_add_epi32(m256i_twos_c, m256i_singleOne);
+			}
+
+			if (0 != prev_end) {
+				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* Twos' checksum */
+					Twos_Checksum_b += (uint32_t) *((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Twos_Checksum_b = (~Twos_Checksum_b) + 1;
+					Twos_Checksum_c += (uint32_t) *((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Twos_Checksum_c = (~Twos_Checksum_c) + 1;
+				}
+			}
+			// =====================================================
+			//				INTERMEDIATE CRC
+			// =====================================================
+			memcpy(val_b, &m256i_twos_b, sizeof(val_b));
+			memcpy(val_c, &m256i_twos_c, sizeof(val_c));
+			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
+			{
+				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b[ui32_idx_l]);
+				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c[ui32_idx_l]);
+			}
+
+			if (0 != (ui32_n % 8)) {
+				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, Twos_Checksum_b);
+				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, Twos_Checksum_c);
+			}
+			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) *((uint32_t*)&f32_a_part));
+
+			ui32_idx_b_ref += ui32_n;
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+	ui32_crc = _mm_crc32_u32(ui32_crc_a, ui32_crc_b);
+	ui32_crc = _mm_crc32_u32(ui32_crc, ui32_crc_c);
+	return ui32_crc;
+}
+SMM_MADD_VARIANTS(smm_intel_twos_crc, TARGET_AVX2)
+
+
+/*==============================================================================================================
+**									Name: smm_intel_ones_crc
+==============================================================================================================*/
+/*!
+** @brief Matrix-matrix multiplication (MMM) with ONES checksum in the internal loop and CRC checksum in the
+**        intermediate loop
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	// ==================================
+	//			ONES VARIABLES
+	// ==================================
+	// AVX variables
+	__m256i  Ones_checksum_b_hi = _mm256_setzero_si256(),
+		Ones_checksum_b_lo = _mm256_setzero_si256(),
+		Ones_checksum_c_hi = _mm256_setzero_si256(),
+		Ones_checksum_c_lo = _mm256_setzero_si256();
+
+	__m256i b_aux_lo, b_aux_hi,
+		c_aux_lo, c_aux_hi,
+		m256i_zeros = _mm256_setzero_si256();
+
+	__m256i m256i_Ones = _mm256_set1_epi32(-1);
+
+	// C variables
+	ui64_to_ui32_t Ones_Checksum_a,
+		Ones_Checksum_b,
+		Ones_Checksum_c,
+		Ones_Checksum;
+
+	Ones_Checksum_a.ui64 = 0u;
+	Ones_Checksum_b.ui64 = 0u;
+	Ones_Checksum_c.ui64 = 0u;
+	Ones_Checksum.ui64 = 0u;
+
+	// ==================================
+	//			CRC VARIABLES
+	// ==================================
+	uint32_t ui32_crc_a = INITIAL_REMAINDER,
+		ui32_crc_b = INITIAL_REMAINDER,
+		ui32_crc_c = INITIAL_REMAINDER,
+		ui32_crc = INITIAL_REMAINDER;
+	uint32_t val_b[8], val_c[8];
+
+	// ==================================
+	//			AUX VARIABLES
+	// ==================================
+	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b = 0u,
+		ui32_idx_c = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+
+	uint32_t prev_end;
+	prev_end = (ui32_n % 8);
+
+	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		{
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			{
+				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
+				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
+				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+
+
+				// =====================================================
+				//				INTERNAL ONES COMPLEMENT
+				// =====================================================
+				// Evaluation of the ES (B value)
+				b_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(b256), m256i_zeros);
+				Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, b_aux_hi);
+				Ones_checksum_b_hi = _mm256_hadd_epi32(Ones_checksum_b_hi, Ones_checksum_b_hi);
+				Ones_checksum_b_hi = _mm256_xor_si256(Ones_checksum_b_hi, m256i_Ones);
+				Ones_checksum_b_hi = _mm256_unpackhi_epi32(Ones_checksum_b_hi, m256i_zeros);
+
+
+				b_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(b256), m256i_zeros);
+				Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, b_aux_lo);
+				Ones_checksum_b_lo = _mm256_hadd_epi32(Ones_checksum_b_lo, Ones_checksum_b_lo);
+				Ones_checksum_b_lo = _mm256_xor_si256(Ones_checksum_b_lo, m256i_Ones);
+				Ones_checksum_b_lo = _mm256_unpackhi_epi32(Ones_checksum_b_lo, m256i_zeros);
+
+
+				// Evaluation of the ES (C value)
+				c_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(result256), m256i_zeros);
+				Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, c_aux_hi);
+				Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
+				Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
+				Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
+
+
+				c_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(result256), m256i_zeros);
+				Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, c_aux_lo);
+				Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
+				Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
+				Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
+			}
+
+			if (0 != prev_end) {
+				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* One's complement checksum */
+					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
+					Ones_Checksum_b.ui32[0] = ~Ones_Checksum_b.ui32[0];
+
+					Ones_Checksum_c.ui64 += (uint64_t) * ((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Ones_Checksum_c.ui32[0] += Ones_Checksum_c.ui32[1];
+					Ones_Checksum_c.ui32[0] = ~Ones_Checksum_c.ui32[0];
+				}
+			}
+			// =====================================================
+			//				INTERMEDIATE CRC
+			// =====================================================
+			// Evaluation of the ES (C value)
+			Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_c_lo);
+			Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
+			Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
+			Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
+
+			Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_b_hi, Ones_checksum_b_lo);
+			Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
+			Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
+			Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
+
+
+			memcpy(val_b, &Ones_checksum_c_hi, sizeof(val_b));
+			memcpy(val_c, &Ones_checksum_c_lo, sizeof(val_c));
+			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 8; ui32_idx_l++)
+			{
+				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b[ui32_idx_l]);
+				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c[ui32_idx_l]);
+			}
+
+			if (0 != prev_end) {
+				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, Ones_Checksum_b.ui32[0]);
+				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, Ones_Checksum_c.ui32[0]);
+			}
+			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) *((uint32_t*)&f32_a_part));
+
+			ui32_idx_b_ref += ui32_n;
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+	ui32_crc = _mm_crc32_u32(ui32_crc_a, ui32_crc_b);
+	ui32_crc = _mm_crc32_u32(ui32_crc, ui32_crc_c);
+	return ui32_crc;
+}
+SMM_MADD_VARIANTS(smm_intel_ones_crc, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_intel_ones_flet
+==============================================================================================================*/
+/*!
+** @brief Matrix-matrix multiplication (MMM) with ONES checksum in the internal loop and Fletcher checksum in the
+**        intermediate loop
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	Fletcher.ui32	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	// ==================================
+	//			ONES VARIABLES
+	// ==================================
+	// AVX variables
+	__m256i  Ones_checksum_b_hi = _mm256_setzero_si256(),
+		Ones_checksum_b_lo = _mm256_setzero_si256(),
+		Ones_checksum_c_hi = _mm256_setzero_si256(),
+		Ones_checksum_c_lo = _mm256_setzero_si256();
+
+	__m256i b_aux_lo, b_aux_hi,
+		c_aux_lo, c_aux_hi,
+		m256i_zeros = _mm256_setzero_si256();
+
+	__m256i m256i_Ones = _mm256_set1_epi32(-1);
+
+	// C variables
+	ui64_to_ui32_t Ones_Checksum_a,
+		Ones_Checksum_b,
+		Ones_Checksum_c,
+		Ones_Checksum;
+
+	Ones_Checksum_a.ui64 = 0u;
+	Ones_Checksum_b.ui64 = 0u;
+	Ones_Checksum_c.ui64 = 0u;
+	Ones_Checksum.ui64 = 0u;
+
+	// ==================================
+	//			FLETCHER VARIABLES
+	// ==================================
+	/* Fletcher Checksum with SIMD instructions(B and C) */
+	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
+		m128i_Fletcher_b_hi = _mm_setzero_si128(),
+		m128i_Fletcher_c_lo = _mm_setzero_si128(),
+		m128i_Fletcher_c_hi = _mm_setzero_si128(),
+		aux_128i_b_lo, aux_128i_b_hi,
+		aux_128i_c_lo, aux_128i_c_hi;
+	
+	uint32_t val_b_lo[4] = { 0u },
+		val_b_hi[4] = { 0u },
+		val_c_lo[4] = { 0u },
+		val_c_hi[4] = { 0u };
+
+	/* Fletcher checksum sequential */
+	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher, Fletcher_aux;
+	Fletcher_a.ui32 = 0u;
+	Fletcher_b.ui32 = 0u;
+	Fletcher_c.ui32 = 0u;
+	Fletcher_aux.ui32 = 0u;
+	Fletcher.ui32 = 0u;
+
+
+	// ==================================
+	//			AUX VARIABLES
+	// ==================================
+	__m256 a256, b256, c256, result256;    // AVX
+	float f32_a_part;
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b = 0u,
+		ui32_idx_c = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+
+
+	uint32_t prev_end;
+	prev_end = (ui32_n % 8);
+
+	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		{
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			{
+				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
+				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
+				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+
+
+				// =====================================================
+				//				INTERNAL ONES COMPLEMENT
+				// =====================================================
+				// Evaluation of the ES (B value)
+				b_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(b256), m256i_zeros);
+				Ones_checksum_b_hi = _mm256_add_epi64(Ones_checksum_b_hi, b_aux_hi);
+				Ones_checksum_b_hi = _mm256_hadd_epi32(Ones_checksum_b_hi, Ones_checksum_b_hi);
+				Ones_checksum_b_hi = _mm256_xor_si256(Ones_checksum_b_hi, m256i_Ones);
+				Ones_checksum_b_hi = _mm256_unpackhi_epi32(Ones_checksum_b_hi, m256i_zeros);
+
+
+				b_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(b256), m256i_zeros);
+				Ones_checksum_b_lo = _mm256_add_epi64(Ones_checksum_b_lo, b_aux_lo);
+				Ones_checksum_b_lo = _mm256_hadd_epi32(Ones_checksum_b_lo, Ones_checksum_b_lo);
+				Ones_checksum_b_lo = _mm256_xor_si256(Ones_checksum_b_lo, m256i_Ones);
+				Ones_checksum_b_lo = _mm256_unpackhi_epi32(Ones_checksum_b_lo, m256i_zeros);
+
+
+				// Evaluation of the ES (C value)
+				c_aux_hi = _mm256_unpackhi_epi32(_mm256_castps_si256(result256), m256i_zeros);
+				Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, c_aux_hi);
+				Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
+				Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
+				Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
+
+
+				c_aux_lo = _mm256_unpacklo_epi32(_mm256_castps_si256(result256), m256i_zeros);
+				Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_c_lo, c_aux_lo);
+				Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
+				Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
+				Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
+			}
+
+			if (0 != prev_end) {
+				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					/* One's complement checksum */
+					Ones_Checksum_b.ui64 += (uint64_t) * ((uint32_t*)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Ones_Checksum_b.ui32[0] += Ones_Checksum_b.ui32[1];
+					Ones_Checksum_b.ui32[0] = ~Ones_Checksum_b.ui32[0];
+
+					Ones_Checksum_c.ui64 += (uint64_t) * ((uint32_t*)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Ones_Checksum_c.ui32[0] += Ones_Checksum_c.ui32[1];
+					Ones_Checksum_c.ui32[0] = ~Ones_Checksum_c.ui32[0];
+				}
+			}
+			// =====================================================
+			//				INTERMEDIATE FLETCHER
+			// =====================================================
+			// Evaluation of the ES (C value)
+			Ones_checksum_c_hi = _mm256_add_epi64(Ones_checksum_c_hi, Ones_checksum_c_lo);
+			Ones_checksum_c_hi = _mm256_hadd_epi32(Ones_checksum_c_hi, Ones_checksum_c_hi);
+			Ones_checksum_c_hi = _mm256_xor_si256(Ones_checksum_c_hi, m256i_Ones);
+			Ones_checksum_c_hi = _mm256_unpackhi_epi32(Ones_checksum_c_hi, m256i_zeros);
+
+			Ones_checksum_c_lo = _mm256_add_epi64(Ones_checksum_b_hi, Ones_checksum_b_lo);
+			Ones_checksum_c_lo = _mm256_hadd_epi32(Ones_checksum_c_lo, Ones_checksum_c_lo);
+			Ones_checksum_c_lo = _mm256_xor_si256(Ones_checksum_c_lo, m256i_Ones);
+			Ones_checksum_c_lo = _mm256_unpackhi_epi32(Ones_checksum_c_lo, m256i_zeros);
+
+			// Evaluation of the ES (A value)
+			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
+
+			// Fletcher computation B
+			aux_128i_b_lo = _mm256_extractf128_si256(Ones_checksum_c_hi, 0);
+			aux_128i_b_hi = _mm256_extractf128_si256(Ones_checksum_c_hi, 1);
+
+			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
+			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+			m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
+			m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+
+
+			// Fletcher computation C
+			aux_128i_c_lo = _mm256_extractf128_si256(Ones_checksum_c_lo, 0);
+			aux_128i_c_hi = _mm256_extractf128_si256(Ones_checksum_c_lo, 1);
+
+			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
+			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+			m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
+			m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+
+			// Modulo 65535 of the Fletcher lanes with SIMD instructions (see fletcher_mod65535_epi32)
+			m128i_Fletcher_b_lo = fletcher_mod65535_epi32(m128i_Fletcher_b_lo);
+			m128i_Fletcher_b_hi = fletcher_mod65535_epi32(m128i_Fletcher_b_hi);
+			m128i_Fletcher_c_lo = fletcher_mod65535_epi32(m128i_Fletcher_c_lo);
+			m128i_Fletcher_c_hi = fletcher_mod65535_epi32(m128i_Fletcher_c_hi);
+
+			if (0 != (ui32_n % 8)) {
+				Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, Ones_Checksum_b.ui32[0]);
+				Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, Ones_Checksum_c.ui32[0]);
+			}
+			// Evaluation of the ES (A value)
+			Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, (uint32_t) * (uint32_t*)&f32_a_part);
+
+			ui32_idx_b_ref += ui32_n;
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+	memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
+	memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
+	memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
+	memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
+	for (uint32_t ui32_idx_i = 0; ui32_idx_i < 4; ui32_idx_i++)
+	{
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_lo[ui32_idx_i]);
+		Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, val_b_hi[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_lo[ui32_idx_i]);
+		Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, val_c_hi[ui32_idx_i]);
+	}
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher_b, Fletcher_c.ui32);
+	Fletcher.ui32 = Fletcher32c_ui32(Fletcher, Fletcher_a.ui32);
+	return Fletcher.ui32;
+}
+SMM_MADD_VARIANTS(smm_intel_ones_flet, TARGET_AVX2)
+
+
+/*==============================================================================================================
+**									Name: smm_intel_flet_crc
+==============================================================================================================*/
+/*!
+** @brief Matrix-matrix multiplication (MMM) with ONES checksum in the internal loop and Fletcher checksum in the
+**        intermediate loop
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	Fletcher.ui32	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_flet_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	// ==================================
+	//			FLETCHER VARIABLES
+	// ==================================
+	// Fletcher Checksum with SIMD instructions(B and C)
+	__m128i m128i_Fletcher_b_lo = _mm_setzero_si128(),
+		m128i_Fletcher_b_hi = _mm_setzero_si128(),
+		m128i_Fletcher_c_lo = _mm_setzero_si128(),
+		m128i_Fletcher_c_hi = _mm_setzero_si128(),
+		aux_128i_b_lo, aux_128i_b_hi,
+		aux_128i_c_lo, aux_128i_c_hi;
+	// __m128i m128i_mod_255 = _mm_set1_epi32(255);
+
+	/* Fletcher checksum sequential */
+	ui32_to_ui16_t Fletcher_a, Fletcher_b, Fletcher_c, Fletcher;
+	Fletcher_a.ui32 = 0u;
+	Fletcher_b.ui32 = 0u;
+	Fletcher_c.ui32 = 0u;
+	Fletcher.ui32 = 0u;
+
+	uint32_t val_b_lo[4], val_b_hi[4], val_c_lo[4], val_c_hi[4];
+
+	// ==================================
+	//			CRC VARIABLES
+	// ==================================
+	uint32_t ui32_crc_a = INITIAL_REMAINDER,
+		ui32_crc_b = INITIAL_REMAINDER,
+		ui32_crc_c = INITIAL_REMAINDER,
+		ui32_crc = INITIAL_REMAINDER;
+
+	__m256i aux_256i_b, aux_256i_c;
+	__m256 a256, b256, c256, result256;    // AVX
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b = 0u,
+		ui32_idx_c = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+
+	float f32_a_part;
+	uint32_t prev_end;
+	prev_end = (ui32_n % 8);
+
+	for (ui32_idx_i = 0; ui32_idx_i < ui32_m; ++ui32_idx_i)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0; ui32_idx_k < ui32_k; ++ui32_idx_k, ui32_idx_a++)
+		{
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a256 = _mm256_set1_ps(f32_a_part);
+
+			for (ui32_idx_j = 0u, ui32_idx_b = ui32_idx_b_ref, ui32_idx_c = ui32_idx_c_ref; ui32_idx_j <= (ui32_n - 8); ui32_idx_j += 8, ui32_idx_b += 8, ui32_idx_c += 8)
+			{
+				b256 = _mm256_loadu_ps(&paf32_mb[ui32_idx_b]);
+				c256 = _mm256_loadu_ps(&paf32_mc[ui32_idx_c]);
+				// FMA - Intel Haswell (2013), AMD Piledriver (2012): selected at runtime (see SMM_MADD_PS)
+				result256 = SMM_MADD_PS(a256, b256, c256);
+				_mm256_storeu_ps(&paf32_mc[ui32_idx_c], result256);
+
+				// Casting of the variables (B and C values)
+				aux_256i_b = _mm256_castps_si256(b256);
+				aux_256i_c = _mm256_castps_si256(result256);
+
+
+				// =====================================================
+				//				FLETCHER INTERNAL
+				// =====================================================
+				// Fletcher computation B
+				aux_128i_b_lo = _mm256_extractf128_si256(aux_256i_b, 0);
+				aux_128i_b_hi = _mm256_extractf128_si256(aux_256i_b, 1);
+
+				m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_lo);
+				m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+				m128i_Fletcher_b_lo = _mm_add_epi32(m128i_Fletcher_b_lo, aux_128i_b_hi);
+				m128i_Fletcher_b_hi = _mm_add_epi32(m128i_Fletcher_b_hi, m128i_Fletcher_b_lo);
+
+
+				// Fletcher computation C
+				aux_128i_c_lo = _mm256_extractf128_si256(aux_256i_c, 0);
+				aux_128i_c_hi = _mm256_extractf128_si256(aux_256i_c, 1);
+
+				m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_lo);
+				m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+				m128i_Fletcher_c_lo = _mm_add_epi32(m128i_Fletcher_c_lo, aux_128i_c_hi);
+				m128i_Fletcher_c_hi = _mm_add_epi32(m128i_Fletcher_c_hi, m128i_Fletcher_c_lo);
+
+				// Modulo 65535 of the Fletcher lanes with SIMD instructions (see fletcher_mod65535_epi32)
+				m128i_Fletcher_b_lo = fletcher_mod65535_epi32(m128i_Fletcher_b_lo);
+				m128i_Fletcher_b_hi = fletcher_mod65535_epi32(m128i_Fletcher_b_hi);
+				m128i_Fletcher_c_lo = fletcher_mod65535_epi32(m128i_Fletcher_c_lo);
+				m128i_Fletcher_c_hi = fletcher_mod65535_epi32(m128i_Fletcher_c_hi);
+			}
+
+			if (0 != prev_end) {
+				for (ui32_idx_j = 0; ui32_idx_j < prev_end; ++ui32_idx_j) {
+					paf32_mc[ui32_idx_c + ui32_idx_j] = SMM_MADD_F32(f32_a_part, paf32_mb[ui32_idx_b + ui32_idx_j], paf32_mc[ui32_idx_c + ui32_idx_j]);
+					Fletcher_b.ui32 = Fletcher32c_ui32(Fletcher_b, (uint32_t) * (uint32_t *)&paf32_mb[ui32_idx_b + ui32_idx_j]);
+					Fletcher_c.ui32 = Fletcher32c_ui32(Fletcher_c, (uint32_t) * (uint32_t *)&paf32_mc[ui32_idx_c + ui32_idx_j]);
+				}
+			}
+			// =====================================================
+			//				INTERMEDIATE CRC
+			// =====================================================
+			// CRC computation C
+			ui32_crc_a = _mm_crc32_u32(ui32_crc_a, (uint32_t) *((uint32_t*)&f32_a_part));
+
+			memcpy(val_b_lo, &m128i_Fletcher_b_lo, sizeof(val_b_lo));
+			memcpy(val_b_hi, &m128i_Fletcher_b_hi, sizeof(val_b_hi));
+			memcpy(val_c_lo, &m128i_Fletcher_c_lo, sizeof(val_c_lo));
+			memcpy(val_c_hi, &m128i_Fletcher_c_hi, sizeof(val_c_hi));
+			for (uint32_t ui32_idx_l = 0; ui32_idx_l < 4; ui32_idx_l++)
+			{
+				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b_lo[ui32_idx_l]);
+				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, (uint32_t) * (uint32_t*)&val_b_hi[ui32_idx_l]);
+				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c_lo[ui32_idx_l]);
+				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, (uint32_t) * (uint32_t*)&val_c_hi[ui32_idx_l]);
+			}
+
+			if (0 != prev_end) {
+				ui32_crc_b = _mm_crc32_u32(ui32_crc_b, Fletcher_b.ui32);
+				ui32_crc_c = _mm_crc32_u32(ui32_crc_c, Fletcher_c.ui32);
+			}
+
+			ui32_idx_b_ref += ui32_n;
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+	ui32_crc = _mm_crc32_u32(ui32_crc_a, ui32_crc_b);
+	ui32_crc = _mm_crc32_u32(ui32_crc, ui32_crc_c);
+	return ui32_crc;
+}
+SMM_MADD_VARIANTS(smm_intel_flet_crc, TARGET_AVX2)
+
+
+
+/*==============================================================================================================
+* 								 Experiment 5: Blocked AVX GEMM
+==============================================================================================================*/
+
+/*==============================================================================================================
+**									Name: smm_intel_blocked_no_dc
+==============================================================================================================*/
+/*!
+** @brief Cache-blocked, register-tiled matrix-matrix multiplication (MMM) without diagnostic coverage.
+**        B is packed in KC x NC blocks (L3) and A in MC x KC blocks (L2), both split into micro-panels of
+**        BLK_NR columns / BLK_MR rows. Each BLK_MR x BLK_NR tile of C stays in registers for a whole KC block.
+**        Every C element is accumulated in the same k order and with the same mul + add rounding as
+**        smm_no_dc, so the result is bit-exact with respect to the golden implementation.
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	0u	No execution signature
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_blocked_no_dc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_blk_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_NONE, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_intel_blocked_no_dc, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_intel_blocked_xor
+==============================================================================================================*/
+/*!
+** @brief Blocked MMM with a fused XOR execution signature: A and B are signed while packed, C is signed from
+**        the accumulator registers of every tile write-back (see smm_blk_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_blocked_xor(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_blk_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_XOR, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_intel_blocked_xor, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_intel_blocked_ones
+==============================================================================================================*/
+/*!
+** @brief Blocked MMM with a fused 1's complement execution signature (64-bit lanes, carries folded at the
+**        tile and pack boundaries)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_blocked_ones(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_blk_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_ONES, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_intel_blocked_ones, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_intel_blocked_twos
+==============================================================================================================*/
+/*!
+** @brief Blocked MMM with a fused 2's complement execution signature
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_blocked_twos(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_blk_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_TWOS, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_intel_blocked_twos, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_intel_blocked_fletcher
+==============================================================================================================*/
+/*!
+** @brief Blocked MMM with a fused Fletcher execution signature. The position dependent Fletcher sums are kept
+**        per 32-bit lane (modulo 2^32) and folded with Fletcher32c_ui32 when the MMM finishes.
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_blocked_fletcher(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_blk_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_FLETCHER, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_intel_blocked_fletcher, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_intel_blocked_crc
+==============================================================================================================*/
+/*!
+** @brief Blocked MMM with a fused CRC32C execution signature (one hardware CRC chain over the packed panels
+**        of A and B and over the accumulator tiles of C)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_intel_blocked_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_blk_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_CRC, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_intel_blocked_crc, TARGET_AVX2)
+
+/*==============================================================================================================
+**									Name: smm_blk_gemm
+==============================================================================================================*/
+/*!
+** @brief Blocked GEMM engine shared by all the Experiment 5 techniques.
+**        The execution signature is fused into the data movement that the blocked GEMM already does:
+**        - A (scaled by alpha) and B are signed while they are copied into the packed panels.
+**        - C is signed from the accumulator registers each time a tile is written back (once per KC block).
+**        The hot loop of the micro-kernel is the same for every technique.
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] e_sig 		Execution signature checksum
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE)
+**
+** @return uint32_t  	Execution signature of the MMM (0u for e_BLK_SIG_NONE)
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 uint32_t smm_blk_gemm(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, e_blk_sig e_sig, const bool32_t b32_fma)
+{
+	DEF_ALIGN(32) float32_t af32_tile[BLK_MR * BLK_NR];
+	blk_sig_t sig;
+	uint32_t ui32_idx_jc,
+		ui32_idx_pc,
+		ui32_idx_ic,
+		ui32_idx_jr,
+		ui32_idx_ir,
+		ui32_idx_r,
+		ui32_idx_x,
+		ui32_nc,
+		ui32_kc,
+		ui32_mc,
+		ui32_mr,
+		ui32_nr;
+	float32_t *paf32_c;
+
+	// Verification of the input values
+	assert(paf32_ma != NULL);
+	assert(paf32_mb != NULL);
+	assert(paf32_mc != NULL);
+	assert(e_sig < e_BLK_SIG_MAX);
+
+	sig.e_sig = e_sig;
+	sig.ui32_a = 0u;
+	sig.ui32_a2 = 0u;
+	sig.ui64_a = 0u;
+	sig.ui32_crc = INITIAL_REMAINDER;
+	sig.m256i_b_lo = _mm256_setzero_si256();
+	sig.m256i_b_hi = _mm256_setzero_si256();
+	sig.m256i_c_lo = _mm256_setzero_si256();
+	sig.m256i_c_hi = _mm256_setzero_si256();
+
+	for (ui32_idx_jc = 0u; ui32_idx_jc < ui32_n; ui32_idx_jc += BLK_NC)
+	{
+		ui32_nc = ((ui32_n - ui32_idx_jc) < BLK_NC) ? (ui32_n - ui32_idx_jc) : BLK_NC;
+		for (ui32_idx_pc = 0u; ui32_idx_pc < ui32_k; ui32_idx_pc += BLK_KC)
+		{
+			ui32_kc = ((ui32_k - ui32_idx_pc) < BLK_KC) ? (ui32_k - ui32_idx_pc) : BLK_KC;
+			smm_blk_pack_b(ui32_kc, ui32_nc, ui32_n, &paf32_mb[(ui32_idx_pc * ui32_n) + ui32_idx_jc], &af32_blk_pack_b[0u], &sig);
+
+			for (ui32_idx_ic = 0u; ui32_idx_ic < ui32_m; ui32_idx_ic += BLK_MC)
+			{
+				ui32_mc = ((ui32_m - ui32_idx_ic) < BLK_MC) ? (ui32_m - ui32_idx_ic) : BLK_MC;
+				smm_blk_pack_a(ui32_mc, ui32_kc, ui32_k, f32_alpha, &paf32_ma[(ui32_idx_ic * ui32_k) + ui32_idx_pc], &af32_blk_pack_a[0u], &sig);
+
+				for (ui32_idx_jr = 0u; ui32_idx_jr < ui32_nc; ui32_idx_jr += BLK_NR)
+				{
+					ui32_nr = ((ui32_nc - ui32_idx_jr) < BLK_NR) ? (ui32_nc - ui32_idx_jr) : BLK_NR;
+					for (ui32_idx_ir = 0u; ui32_idx_ir < ui32_mc; ui32_idx_ir += BLK_MR)
+					{
+						ui32_mr = ((ui32_mc - ui32_idx_ir) < BLK_MR) ? (ui32_mc - ui32_idx_ir) : BLK_MR;
+						paf32_c = &paf32_mc[((ui32_idx_ic + ui32_idx_ir) * ui32_n) + ui32_idx_jc + ui32_idx_jr];
+
+						if ((ui32_mr == BLK_MR) && (ui32_nr == BLK_NR))
+						{
+							smm_blk_kernel_6x16(ui32_kc, &af32_blk_pack_a[ui32_idx_ir * ui32_kc], &af32_blk_pack_b[ui32_idx_jr * ui32_kc], paf32_c, ui32_n, &sig, b32_fma);
+						}
+						else
+						{
+							/* Partial tile: compute on a zero padded copy and write back only the valid part */
+							for (ui32_idx_r = 0u; ui32_idx_r < BLK_MR; ui32_idx_r++)
+							{
+								for (ui32_idx_x = 0u; ui32_idx_x < BLK_NR; ui32_idx_x++)
+								{
+									af32_tile[(ui32_idx_r * BLK_NR) + ui32_idx_x] = ((ui32_idx_r < ui32_mr) && (ui32_idx_x < ui32_nr)) ? paf32_c[(ui32_idx_r * ui32_n) + ui32_idx_x] : 0.0f;
+								}
+							}
+							smm_blk_kernel_6x16(ui32_kc, &af32_blk_pack_a[ui32_idx_ir * ui32_kc], &af32_blk_pack_b[ui32_idx_jr * ui32_kc], &af32_tile[0u], BLK_NR, &sig, b32_fma);
+							for (ui32_idx_r = 0u; ui32_idx_r < ui32_mr; ui32_idx_r++)
+							{
+								memcpy(&paf32_c[ui32_idx_r * ui32_n], &af32_tile[ui32_idx_r * BLK_NR], ui32_nr * sizeof(float32_t));
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+	return smm_blk_sig_finalize(&sig);
+}
+
+/*==============================================================================================================
+**									Name: smm_blk_pack_a
+==============================================================================================================*/
+/*!
+** @brief Pack a ui32_mc x ui32_kc block of A (scaled by alpha) into micro-panels of BLK_MR rows and update the
+**        A part of the execution signature. Inside a micro-panel the BLK_MR values of the same k are
+**        consecutive. Missing rows are padded with zeros.
+**
+** @param[in] ui32_mc 		Number of rows of the block
+** @param[in] ui32_kc 		Number of columns of the block
+** @param[in] ui32_lda 		Leading dimension of A
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first element of the block in A
+** @param[out] paf32_pack 	Pointer to the packed buffer (ceil(ui32_mc / BLK_MR) * BLK_MR * ui32_kc floats)
+** @param[in,out] p_sig 	Execution signature state
+==============================================================================================================*/
+static TARGET_AVX2 void_t smm_blk_pack_a(uint32_t ui32_mc, uint32_t ui32_kc, uint32_t ui32_lda, float32_t f32_alpha, const float32_t * const paf32_ma, float32_t * const paf32_pack, blk_sig_t * const p_sig)
+{
+	uint32_t ui32_idx_ir,
+		ui32_idx_r,
+		ui32_idx_p,
+		ui32_idx_pack = 0u,
+		ui32_a;
+	float32_t f32_a_part;
+
+	for (ui32_idx_ir = 0u; ui32_idx_ir < ui32_mc; ui32_idx_ir += BLK_MR)
+	{
+		for (ui32_idx_p = 0u; ui32_idx_p < ui32_kc; ui32_idx_p++)
+		{
+			for (ui32_idx_r = 0u; ui32_idx_r < BLK_MR; ui32_idx_r++, ui32_idx_pack++)
+			{
+				f32_a_part = ((ui32_idx_ir + ui32_idx_r) < ui32_mc) ? (f32_alpha * paf32_ma[((ui32_idx_ir + ui32_idx_r) * ui32_lda) + ui32_idx_p]) : 0.0f;
+				paf32_pack[ui32_idx_pack] = f32_a_part;
+
+				// Evaluation of the ES (A value)
+				ui32_a = (uint32_t) *((uint32_t*)&f32_a_part);
+				switch (p_sig->e_sig)
+				{
+				case e_BLK_SIG_XOR:
+					p_sig->ui32_a ^= ui32_a;
+					break;
+				case e_BLK_SIG_ONES:
+					p_sig->ui64_a += (uint64_t)ui32_a;
+					break;
+				case e_BLK_SIG_TWOS:
+					p_sig->ui32_a += ui32_a;
+					break;
+				case e_BLK_SIG_FLETCHER:
+					p_sig->ui32_a += ui32_a;
+					p_sig->ui32_a2 += p_sig->ui32_a;
+					break;
+				case e_BLK_SIG_CRC:
+					p_sig->ui32_crc = _mm_crc32_u32(p_sig->ui32_crc, ui32_a);
+					break;
+				default:
+					break;
+				}
+			}
+		}
+	}
+}
+
+/*==============================================================================================================
+**									Name: smm_blk_pack_b
+==============================================================================================================*/
+/*!
+** @brief Pack a ui32_kc x ui32_nc block of B into micro-panels of BLK_NR columns and update the B part of the
+**        execution signature from the packed rows. Inside a micro-panel the BLK_NR values of the same k are
+**        consecutive. Missing columns are padded with zeros.
+**
+** @param[in] ui32_kc 		Number of rows of the block
+** @param[in] ui32_nc 		Number of columns of the block
+** @param[in] ui32_ldb 		Leading dimension of B
+** @param[in] paf32_mb 		Pointer to the first element of the block in B
+** @param[out] paf32_pack 	Pointer to the packed buffer (ceil(ui32_nc / BLK_NR) * BLK_NR * ui32_kc floats)
+** @param[in,out] p_sig 	Execution signature state
+==============================================================================================================*/
+static TARGET_AVX2 void_t smm_blk_pack_b(uint32_t ui32_kc, uint32_t ui32_nc, uint32_t ui32_ldb, const float32_t * const paf32_mb, float32_t * const paf32_pack, blk_sig_t * const p_sig)
+{
+	uint32_t ui32_idx_jr,
+		ui32_idx_x,
+		ui32_idx_p,
+		ui32_nr,
+		ui32_idx_pack = 0u;
+	const float32_t *paf32_b;
+	__m256i m256i_b0, m256i_b1,
+		m256i_lo = p_sig->m256i_b_lo,
+		m256i_hi = p_sig->m256i_b_hi;
+	uint64_t ui64_crc = (uint64_t)p_sig->ui32_crc;
+	const uint64_t *pui64_pack;
+
+	for (ui32_idx_jr = 0u; ui32_idx_jr < ui32_nc; ui32_idx_jr += BLK_NR)
+	{
+		ui32_nr = ((ui32_nc - ui32_idx_jr) < BLK_NR) ? (ui32_nc - ui32_idx_jr) : BLK_NR;
+		for (ui32_idx_p = 0u; ui32_idx_p < ui32_kc; ui32_idx_p++, ui32_idx_pack += BLK_NR)
+		{
+			paf32_b = &paf32_mb[(ui32_idx_p * ui32_ldb) + ui32_idx_jr];
+			if (ui32_nr == BLK_NR)
+			{
+				_mm256_store_ps(&paf32_pack[ui32_idx_pack], _mm256_loadu_ps(&paf32_b[0u]));
+				_mm256_store_ps(&paf32_pack[ui32_idx_pack + 8u], _mm256_loadu_ps(&paf32_b[8u]));
+			}
+			else
+			{
+				for (ui32_idx_x = 0u; ui32_idx_x < BLK_NR; ui32_idx_x++)
+				{
+					paf32_pack[ui32_idx_pack + ui32_idx_x] = (ui32_idx_x < ui32_nr) ? paf32_b[ui32_idx_x] : 0.0f;
+				}
+			}
+
+			// Evaluation of the ES (packed B values)
+			m256i_b0 = _mm256_castps_si256(_mm256_load_ps(&paf32_pack[ui32_idx_pack]));
+			m256i_b1 = _mm256_castps_si256(_mm256_load_ps(&paf32_pack[ui32_idx_pack + 8u]));
+			switch (p_sig->e_sig)
+			{
+			case e_BLK_SIG_XOR:
+				BLK_SIG_XOR_V(m256i_lo, m256i_hi, m256i_b0)
+				BLK_SIG_XOR_V(m256i_lo, m256i_hi, m256i_b1)
+				break;
+			case e_BLK_SIG_ONES:
+				BLK_SIG_ONES_V(m256i_lo, m256i_hi, m256i_b0)
+				BLK_SIG_ONES_V(m256i_lo, m256i_hi, m256i_b1)
+				break;
+			case e_BLK_SIG_TWOS:
+				BLK_SIG_TWOS_V(m256i_lo, m256i_hi, m256i_b0)
+				BLK_SIG_TWOS_V(m256i_lo, m256i_hi, m256i_b1)
+				break;
+			case e_BLK_SIG_FLETCHER:
+				BLK_SIG_FLET_V(m256i_lo, m256i_hi, m256i_b0)
+				BLK_SIG_FLET_V(m256i_lo, m256i_hi, m256i_b1)
+				break;
+			case e_BLK_SIG_CRC:
+				pui64_pack = (const uint64_t*)&paf32_pack[ui32_idx_pack];
+				for (ui32_idx_x = 0u; ui32_idx_x < (BLK_NR / 2u); ui32_idx_x++)
+				{
+					ui64_crc = _mm_crc32_u64(ui64_crc, pui64_pack[ui32_idx_x]);
+				}
+				break;
+			default:
+				break;
+			}
+		}
+		if (p_sig->e_sig == e_BLK_SIG_ONES)
+		{
+			BLK_SIG_ONES_FOLD(m256i_lo)
+			BLK_SIG_ONES_FOLD(m256i_hi)
+		}
+	}
+	p_sig->m256i_b_lo = m256i_lo;
+	p_sig->m256i_b_hi = m256i_hi;
+	p_sig->ui32_crc = (uint32_t)ui64_crc;
+}
+
+/*==============================================================================================================
+**									Name: smm_blk_kernel_6x16
+==============================================================================================================*/
+/*!
+** @brief Register micro-kernel: C[6 x 16] += Pa[6 x kc] * Pb[kc x 16] with 12 __m256 accumulators. C is read
+**        once and written once per KC block instead of once per k as in the i-k-j AVX kernels. When the tile
+**        is written back the accumulators are also folded into the C part of the execution signature, so the
+**        signature costs a few ALU operations per tile and no extra memory traffic.
+**
+** @param[in] ui32_kc 		Depth of the packed panels
+** @param[in] paf32_pa 		Pointer to the packed A micro-panel (BLK_MR values per k)
+** @param[in] paf32_pb 		Pointer to the packed B micro-panel (BLK_NR values per k, 32 bytes aligned)
+** @param[in,out] paf32_mc 	Pointer to the first element of the C tile
+** @param[in] ui32_ldc 		Leading dimension of C
+** @param[in,out] p_sig 	Execution signature state
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE)
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX2 void_t smm_blk_kernel_6x16(uint32_t ui32_kc, const float32_t * const paf32_pa, const float32_t * const paf32_pb, float32_t * const paf32_mc, uint32_t ui32_ldc, blk_sig_t * const p_sig, const bool32_t b32_fma)
+{
+	__m256 c256_00, c256_01, c256_10, c256_11, c256_20, c256_21,
+		c256_30, c256_31, c256_40, c256_41, c256_50, c256_51;
+	__m256 a256, b256_0, b256_1;
+	DEF_ALIGN(32) uint64_t aui64_tile[(BLK_MR * BLK_NR) / 2u];
+	const float32_t *paf32_a = paf32_pa,
+		*paf32_b = paf32_pb;
+	uint64_t ui64_crc;
+	uint32_t ui32_idx_p;
+
+	c256_00 = _mm256_loadu_ps(&paf32_mc[0u]);
+	c256_01 = _mm256_loadu_ps(&paf32_mc[8u]);
+	c256_10 = _mm256_loadu_ps(&paf32_mc[ui32_ldc]);
+	c256_11 = _mm256_loadu_ps(&paf32_mc[ui32_ldc + 8u]);
+	c256_20 = _mm256_loadu_ps(&paf32_mc[2u * ui32_ldc]);
+	c256_21 = _mm256_loadu_ps(&paf32_mc[(2u * ui32_ldc) + 8u]);
+	c256_30 = _mm256_loadu_ps(&paf32_mc[3u * ui32_ldc]);
+	c256_31 = _mm256_loadu_ps(&paf32_mc[(3u * ui32_ldc) + 8u]);
+	c256_40 = _mm256_loadu_ps(&paf32_mc[4u * ui32_ldc]);
+	c256_41 = _mm256_loadu_ps(&paf32_mc[(4u * ui32_ldc) + 8u]);
+	c256_50 = _mm256_loadu_ps(&paf32_mc[5u * ui32_ldc]);
+	c256_51 = _mm256_loadu_ps(&paf32_mc[(5u * ui32_ldc) + 8u]);
+
+	for (ui32_idx_p = 0u; ui32_idx_p < ui32_kc; ui32_idx_p++, paf32_a += BLK_MR, paf32_b += BLK_NR)
+	{
+		b256_0 = _mm256_load_ps(&paf32_b[0u]);
+		b256_1 = _mm256_load_ps(&paf32_b[8u]);
+
+		// FMA or mul + add, with the same rounding as the golden implementation (see SMM_MADD_PS)
+		a256 = _mm256_broadcast_ss(&paf32_a[0u]);
+		c256_00 = SMM_MADD_PS(a256, b256_0, c256_00);
+		c256_01 = SMM_MADD_PS(a256, b256_1, c256_01);
+		a256 = _mm256_broadcast_ss(&paf32_a[1u]);
+		c256_10 = SMM_MADD_PS(a256, b256_0, c256_10);
+		c256_11 = SMM_MADD_PS(a256, b256_1, c256_11);
+		a256 = _mm256_broadcast_ss(&paf32_a[2u]);
+		c256_20 = SMM_MADD_PS(a256, b256_0, c256_20);
+		c256_21 = SMM_MADD_PS(a256, b256_1, c256_21);
+		a256 = _mm256_broadcast_ss(&paf32_a[3u]);
+		c256_30 = SMM_MADD_PS(a256, b256_0, c256_30);
+		c256_31 = SMM_MADD_PS(a256, b256_1, c256_31);
+		a256 = _mm256_broadcast_ss(&paf32_a[4u]);
+		c256_40 = SMM_MADD_PS(a256, b256_0, c256_40);
+		c256_41 = SMM_MADD_PS(a256, b256_1, c256_41);
+		a256 = _mm256_broadcast_ss(&paf32_a[5u]);
+		c256_50 = SMM_MADD_PS(a256, b256_0, c256_50);
+		c256_51 = SMM_MADD_PS(a256, b256_1, c256_51);
+	}
+
+	_mm256_storeu_ps(&paf32_mc[0u], c256_00);
+	_mm256_storeu_ps(&paf32_mc[8u], c256_01);
+	_mm256_storeu_ps(&paf32_mc[ui32_ldc], c256_10);
+	_mm256_storeu_ps(&paf32_mc[ui32_ldc + 8u], c256_11);
+	_mm256_storeu_ps(&paf32_mc[2u * ui32_ldc], c256_20);
+	_mm256_storeu_ps(&paf32_mc[(2u * ui32_ldc) + 8u], c256_21);
+	_mm256_storeu_ps(&paf32_mc[3u * ui32_ldc], c256_30);
+	_mm256_storeu_ps(&paf32_mc[(3u * ui32_ldc) + 8u], c256_31);
+	_mm256_storeu_ps(&paf32_mc[4u * ui32_ldc], c256_40);
+	_mm256_storeu_ps(&paf32_mc[(4u * ui32_ldc) + 8u], c256_41);
+	_mm256_storeu_ps(&paf32_mc[5u * ui32_ldc], c256_50);
+	_mm256_storeu_ps(&paf32_mc[(5u * ui32_ldc) + 8u], c256_51);
+
+	// Evaluation of the ES (C tile from the accumulator registers)
+	switch (p_sig->e_sig)
+	{
+	case e_BLK_SIG_XOR:
+		BLK_TILE_SIG(BLK_SIG_XOR_V, p_sig->m256i_c_lo, p_sig->m256i_c_hi)
+		break;
+	case e_BLK_SIG_ONES:
+		BLK_TILE_SIG(BLK_SIG_ONES_V, p_sig->m256i_c_lo, p_sig->m256i_c_hi)
+		BLK_SIG_ONES_FOLD(p_sig->m256i_c_lo)
+		BLK_SIG_ONES_FOLD(p_sig->m256i_c_hi)
+		break;
+	case e_BLK_SIG_TWOS:
+		BLK_TILE_SIG(BLK_SIG_TWOS_V, p_sig->m256i_c_lo, p_sig->m256i_c_hi)
+		break;
+	case e_BLK_SIG_FLETCHER:
+		BLK_TILE_SIG(BLK_SIG_FLET_V, p_sig->m256i_c_lo, p_sig->m256i_c_hi)
+		break;
+	case e_BLK_SIG_CRC:
+		_mm256_store_si256((__m256i*)&aui64_tile[0u], _mm256_castps_si256(c256_00));
+		_mm256_store_si256((__m256i*)&aui64_tile[4u], _mm256_castps_si256(c256_01));
+		_mm256_store_si256((__m256i*)&aui64_tile[8u], _mm256_castps_si256(c256_10));
+		_mm256_store_si256((__m256i*)&aui64_tile[12u], _mm256_castps_si256(c256_11));
+		_mm256_store_si256((__m256i*)&aui64_tile[16u], _mm256_castps_si256(c256_20));
+		_mm256_store_si256((__m256i*)&aui64_tile[20u], _mm256_castps_si256(c256_21));
+		_mm256_store_si256((__m256i*)&aui64_tile[24u], _mm256_castps_si256(c256_30));
+		_mm256_store_si256((__m256i*)&aui64_tile[28u], _mm256_castps_si256(c256_31));
+		_mm256_store_si256((__m256i*)&aui64_tile[32u], _mm256_castps_si256(c256_40));
+		_mm256_store_si256((__m256i*)&aui64_tile[36u], _mm256_castps_si256(c256_41));
+		_mm256_store_si256((__m256i*)&aui64_tile[40u], _mm256_castps_si256(c256_50));
+		_mm256_store_si256((__m256i*)&aui64_tile[44u], _mm256_castps_si256(c256_51));
+		ui64_crc = (uint64_t)p_sig->ui32_crc;
+		for (ui32_idx_p = 0u; ui32_idx_p < ((BLK_MR * BLK_NR) / 2u); ui32_idx_p++)
+		{
+			ui64_crc = _mm_crc32_u64(ui64_crc, aui64_tile[ui32_idx_p]);
+		}
+		p_sig->ui32_crc = (uint32_t)ui64_crc;
+		break;
+	default:
+		break;
+	}
+}
+
+/*==============================================================================================================
+**									Name: smm_blk_sig_finalize
+==============================================================================================================*/
+/*!
+** @brief Reduce the lane-wise state of the blocked GEMM execution signature to a 32-bit value
+**
+** @param[in] p_sig 	Execution signature state
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static TARGET_AVX2 uint32_t smm_blk_sig_finalize(const blk_sig_t * const p_sig)
+{
+	uint32_t val_lo[8], val_hi[8];
+	uint32_t ui32_idx,
+		ui32_es = 0u;
+	uint64_t ui64_ones;
+	ui32_to_ui16_t Fletcher;
+	__m256i m256i_lo, m256i_hi;
+
+	switch (p_sig->e_sig)
+	{
+	case e_BLK_SIG_XOR:
+		m256i_lo = _mm256_xor_si256(p_sig->m256i_b_lo, p_sig->m256i_c_lo);
+		memcpy(val_lo, &m256i_lo, sizeof(val_lo));
+		ui32_es = p_sig->ui32_a;
+		for (ui32_idx = 0u; ui32_idx < 8u; ui32_idx++)
+		{
+			ui32_es ^= val_lo[ui32_idx];
+		}
+		break;
+	case e_BLK_SIG_ONES:
+		m256i_lo = _mm256_add_epi64(p_sig->m256i_b_lo, p_sig->m256i_b_hi);
+		m256i_hi = _mm256_add_epi64(p_sig->m256i_c_lo, p_sig->m256i_c_hi);
+		m256i_lo = _mm256_add_epi64(m256i_lo, m256i_hi);
+		memcpy(val_lo, &m256i_lo, sizeof(val_lo));
+		ui64_ones = p_sig->ui64_a;
+		for (ui32_idx = 0u; ui32_idx < 8u; ui32_idx += 2u)
+		{
+			ui64_ones += ((uint64_t)val_lo[ui32_idx + 1u] << 32u) | (uint64_t)val_lo[ui32_idx];
+			ui64_ones = (ui64_ones & 0xFFFFFFFFu) + (ui64_ones >> 32u);
+		}
+		while ((ui64_ones >> 32u) != 0u)
+		{
+			ui64_ones = (ui64_ones & 0xFFFFFFFFu) + (ui64_ones >> 32u);
+		}
+		ui32_es = ~(uint32_t)ui64_ones;
+		break;
+	case e_BLK_SIG_TWOS:
+		m256i_lo = _mm256_add_epi32(p_sig->m256i_b_lo, p_sig->m256i_c_lo);
+		memcpy(val_lo, &m256i_lo, sizeof(val_lo));
+		ui32_es = p_sig->ui32_a;
+		for (ui32_idx = 0u; ui32_idx < 8u; ui32_idx++)
+		{
+			ui32_es += val_lo[ui32_idx];
+		}
+		ui32_es = (~ui32_es) + 1u;
+		break;
+	case e_BLK_SIG_FLETCHER:
+		Fletcher.ui32 = 0u;
+		Fletcher.ui32 = Fletcher32c_ui32(Fletcher, p_sig->ui32_a);
+		Fletcher.ui32 = Fletcher32c_ui32(Fletcher, p_sig->ui32_a2);
+		memcpy(val_lo, &p_sig->m256i_b_lo, sizeof(val_lo));
+		memcpy(val_hi, &p_sig->m256i_b_hi, sizeof(val_hi));
+		for (ui32_idx = 0u; ui32_idx < 8u; ui32_idx++)
+		{
+			Fletcher.ui32 = Fletcher32c_ui32(Fletcher, val_lo[ui32_idx]);
+			Fletcher.ui32 = Fletcher32c_ui32(Fletcher, val_hi[ui32_idx]);
+		}
+		memcpy(val_lo, &p_sig->m256i_c_lo, sizeof(val_lo));
+		memcpy(val_hi, &p_sig->m256i_c_hi, sizeof(val_hi));
+		for (ui32_idx = 0u; ui32_idx < 8u; ui32_idx++)
+		{
+			Fletcher.ui32 = Fletcher32c_ui32(Fletcher, val_lo[ui32_idx]);
+			Fletcher.ui32 = Fletcher32c_ui32(Fletcher, val_hi[ui32_idx]);
+		}
+		ui32_es = Fletcher.ui32;
+		break;
+	case e_BLK_SIG_CRC:
+		ui32_es = p_sig->ui32_crc;
+		break;
+	default:
+		break;
+	}
+	return ui32_es;
+}
+
+
+/*==============================================================================================================
+* 								 Experiment 6: AVX-512
+==============================================================================================================*/
+
+/*==============================================================================================================
+**									Name: smm_avx512_sig_update
+==============================================================================================================*/
+/*!
+** @brief Sign one B vector and the C vector computed with it (internal loop of smm_avx512_gemm)
+**
+** @param[in] e_sig 			Checksum technique
+** @param[in] m512i_b 			16 words of B
+** @param[in] m512i_c 			16 words of C (result of the multiply-accumulate)
+** @param[in,out] am512i_s		Signature lanes: XOR / 2's sum: [0]; 1's sum: [0] low words, [1] high words;
+** 								Fletcher: [0],[1] sums 1 and 2 of B, [2],[3] sums 1 and 2 of C; CRC: [0] B, [1] C
+** @param[in] m512i_crc_k 		CRC folding constants (ZMM_CRC_K_LO / ZMM_CRC_K_HI in every 128-bit lane)
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 void_t smm_avx512_sig_update(e_blk_sig e_sig, __m512i m512i_b, __m512i m512i_c, __m512i am512i_s[4], __m512i m512i_crc_k)
+{
+	const __m512i m512i_lo32 = _mm512_set1_epi64(0xFFFFFFFFll);
+
+	switch (e_sig)
+	{
+	case e_BLK_SIG_XOR:
+		/* B ^ C ^ state in one instruction */
+		am512i_s[0] = _mm512_ternarylogic_epi32(am512i_s[0], m512i_b, m512i_c, 0x96);
+		break;
+	case e_BLK_SIG_TWOS:
+		am512i_s[0] = _mm512_add_epi32(am512i_s[0], _mm512_add_epi32(m512i_b, m512i_c));
+		break;
+	case e_BLK_SIG_ONES:
+		/* 64-bit lanes keep the carries of the 32-bit words, they are folded back at the end */
+		am512i_s[0] = _mm512_add_epi64(am512i_s[0], _mm512_add_epi64(_mm512_and_si512(m512i_b, m512i_lo32), _mm512_and_si512(m512i_c, m512i_lo32)));
+		am512i_s[1] = _mm512_add_epi64(am512i_s[1], _mm512_add_epi64(_mm512_srli_epi64(m512i_b, 32), _mm512_srli_epi64(m512i_c, 32)));
+		break;
+	case e_BLK_SIG_FLETCHER:
+		am512i_s[0] = _mm512_add_epi32(am512i_s[0], m512i_b);
+		am512i_s[1] = _mm512_add_epi32(am512i_s[1], am512i_s[0]);
+		am512i_s[2] = _mm512_add_epi32(am512i_s[2], m512i_c);
+		am512i_s[3] = _mm512_add_epi32(am512i_s[3], am512i_s[2]);
+		break;
+	case e_BLK_SIG_CRC:
+		ZMM_CRC_FOLD(am512i_s[0], m512i_b, m512i_crc_k);
+		ZMM_CRC_FOLD(am512i_s[1], m512i_c, m512i_crc_k);
+		break;
+	default:
+		break;
+	}
+}
+
+/*==============================================================================================================
+**									Name: smm_avx512_crc_lanes
+==============================================================================================================*/
+/*!
+** @brief CRC32C of a folded 512-bit accumulator (ZMM_CRC_FOLD): equal to the CRC32C of the whole stream
+**
+** @param[in] m512i_acc 		Folded accumulator
+**
+** @return uint32_t  	CRC32C (initial value 0) of the stream
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_crc_lanes(__m512i m512i_acc)
+{
+	uint64_t aui64_lanes[8];
+	uint64_t ui64_crc = 0u;
+	uint32_t ui32_idx;
+
+	memcpy(aui64_lanes, &m512i_acc, sizeof(aui64_lanes));
+	for (ui32_idx = 0u; ui32_idx < 8u; ui32_idx++)
+	{
+		ui64_crc = _mm_crc32_u64(ui64_crc, aui64_lanes[ui32_idx]);
+	}
+	return (uint32_t)ui64_crc;
+}
+
+/*==============================================================================================================
+**									Name: smm_avx512_gemm
+==============================================================================================================*/
+/*!
+** @brief 512-bit matrix-matrix multiplication (MMM) with a fused execution signature. Same loop order as the AVX
+**        kernels (A value broadcast, ZMM_NR columns of B and C per vector). The N % 16 last columns are executed
+**        with a mask register instead of a scalar loop (inactive lanes are zero). Every B and C vector is signed
+**        with the inner technique (internal loop); for the mixed techniques, the outer technique signs the state
+**        of the inner one after every row of B (intermediate loop). A is signed with the inner technique.
+**        The wrappers pass constant techniques, so each one is compiled without the unused signature code.
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] e_inner 		Checksum of A, B and C (e_BLK_SIG_NONE: no execution signature)
+** @param[in] e_outer 		Checksum of the inner state: e_BLK_SIG_FLETCHER, e_BLK_SIG_CRC or e_BLK_SIG_NONE
+** @param[out] pst_sig 		Row shard (smm_par_shards): signature state of the MMM instead of its signature; NULL otherwise
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE)
+**
+** @return uint32_t  	Execution signature of the MMM (0 for a row shard)
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_gemm(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, e_blk_sig e_inner, e_blk_sig e_outer, smm_shard_sig_t * const pst_sig, const bool32_t b32_fma)
+{
+	const __mmask16 m16_tail = (__mmask16)((1u << (ui32_n % ZMM_NR)) - 1u);
+	const __m512i m512i_crc_k = _mm512_broadcast_i32x4(_mm_set_epi64x(ZMM_CRC_K_HI, ZMM_CRC_K_LO));
+	__m512 a512, b512, c512, result512;
+	__m512i am512i_s[4],
+		m512i_o1 = _mm512_setzero_si512(),
+		m512i_o2 = _mm512_setzero_si512();
+	smm_shard_sig_t st_sig;
+	smm_shard_sig_t * const pst_state = (pst_sig != NULL) ? pst_sig : &st_sig;
+	uint32_t ui32_idx,
+		ui32_n_state,
+		ui32_a_bits,
+		ui32_a = 0u,
+		ui32_crc_a = INITIAL_REMAINDER;
+	uint64_t ui64_a = 0u;
+	ui32_to_ui16_t Fletcher_a;
+	float32_t f32_a_part;
+
+	uint32_t ui32_idx_i = 0u,
+		ui32_idx_j = 0u,
+		ui32_idx_k = 0u,
+		ui32_idx_a = 0u,
+		ui32_idx_b_ref = 0u,
+		ui32_idx_c_ref = 0u;
+
+	Fletcher_a.ui32 = 0u;
+	for (ui32_idx = 0u; ui32_idx < 4u; ui32_idx++)
+	{
+		am512i_s[ui32_idx] = _mm512_setzero_si512();
+	}
+	/* Number of inner state vectors signed by the outer technique */
+	ui32_n_state = (e_inner == e_BLK_SIG_FLETCHER) ? 4u : ((e_inner == e_BLK_SIG_ONES) ? 2u : 1u);
+
+	for (ui32_idx_i = 0u; ui32_idx_i < ui32_m; ui32_idx_i++)
+	{
+		ui32_idx_b_ref = 0u;
+		for (ui32_idx_k = 0u; ui32_idx_k < ui32_k; ui32_idx_k++, ui32_idx_a++)
+		{
+			f32_a_part = f32_alpha * paf32_ma[ui32_idx_a];
+			a512 = _mm512_set1_ps(f32_a_part);
+
+			// Evaluation of the ES (A value)
+			memcpy(&ui32_a_bits, &f32_a_part, sizeof(ui32_a_bits));
+			switch (e_inner)
+			{
+			case e_BLK_SIG_XOR:      ui32_a ^= ui32_a_bits; break;
+			case e_BLK_SIG_TWOS:     ui32_a += ui32_a_bits; break;
+			case e_BLK_SIG_ONES:     ui64_a += ui32_a_bits; break;
+			case e_BLK_SIG_FLETCHER: Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, ui32_a_bits); break;
+			case e_BLK_SIG_CRC:      ui32_crc_a = _mm_crc32_u32(ui32_crc_a, ui32_a_bits); break;
+			default: break;
+			}
+
+			for (ui32_idx_j = 0u; (ui32_idx_j + ZMM_NR) <= ui32_n; ui32_idx_j += ZMM_NR)
+			{
+				b512 = _mm512_loadu_ps(&paf32_mb[ui32_idx_b_ref + ui32_idx_j]);
+				c512 = _mm512_loadu_ps(&paf32_mc[ui32_idx_c_ref + ui32_idx_j]);
+				result512 = SMM_MADD_PS512(a512, b512, c512);
+				_mm512_storeu_ps(&paf32_mc[ui32_idx_c_ref + ui32_idx_j], result512);
+
+				// Evaluation of the ES (B and C values)
+				smm_avx512_sig_update(e_inner, _mm512_castps_si512(b512), _mm512_castps_si512(result512), am512i_s, m512i_crc_k);
+			}
+
+			/* N % 16 columns: masked loads and store, inactive lanes are zero */
+			if (m16_tail != 0u)
+			{
+				b512 = _mm512_maskz_loadu_ps(m16_tail, &paf32_mb[ui32_idx_b_ref + ui32_idx_j]);
+				c512 = _mm512_maskz_loadu_ps(m16_tail, &paf32_mc[ui32_idx_c_ref + ui32_idx_j]);
+				result512 = _mm512_maskz_mov_ps(m16_tail, SMM_MADD_PS512(a512, b512, c512));
+				_mm512_mask_storeu_ps(&paf32_mc[ui32_idx_c_ref + ui32_idx_j], m16_tail, result512);
+
+				smm_avx512_sig_update(e_inner, _mm512_castps_si512(b512), _mm512_castps_si512(result512), am512i_s, m512i_crc_k);
+			}
+
+			// Evaluation of the outer ES (state of the inner one)
+			for (ui32_idx = 0u; (e_outer != e_BLK_SIG_NONE) && (ui32_idx < ui32_n_state); ui32_idx++)
+			{
+				if (e_outer == e_BLK_SIG_CRC)
+				{
+					ZMM_CRC_FOLD(m512i_o1, am512i_s[ui32_idx], m512i_crc_k);
+				}
+				else
+				{
+					m512i_o1 = _mm512_add_epi32(m512i_o1, am512i_s[ui32_idx]);
+					m512i_o2 = _mm512_add_epi32(m512i_o2, m512i_o1);
+				}
+			}
+			ui32_idx_b_ref += ui32_n;
+		}
+		ui32_idx_c_ref += ui32_n;
+	}
+
+	/* Signature state: returned for a row shard (smm_par_shards), finalized here otherwise */
+	memset(pst_state, 0, sizeof(*pst_state));
+	pst_state->e_inner = e_inner;
+	pst_state->e_outer = e_outer;
+	pst_state->ui64_a = (e_inner == e_BLK_SIG_ONES) ? ui64_a : (uint64_t)ui32_a;
+	pst_state->aui32_crc[e_CRC_STREAM_A] = ui32_crc_a;
+	pst_state->aui64_len[e_CRC_STREAM_A] = (uint64_t)ui32_m * ui32_k * sizeof(float32_t);
+	pst_state->aui64_len[e_CRC_STREAM_B] = (uint64_t)ui32_m * ui32_k * ((ui32_n + ZMM_NR - 1u) / ZMM_NR) * sizeof(__m512i);
+	pst_state->aui64_len[e_CRC_STREAM_C] = pst_state->aui64_len[e_CRC_STREAM_B];
+	if (e_inner == e_BLK_SIG_CRC)
+	{
+		pst_state->aui32_crc[e_CRC_STREAM_B] = smm_avx512_crc_lanes(am512i_s[0]);
+		pst_state->aui32_crc[e_CRC_STREAM_C] = smm_avx512_crc_lanes(am512i_s[1]);
+	}
+	else
+	{
+		memcpy(pst_state->aui32_s, am512i_s, sizeof(pst_state->aui32_s));
+	}
+	if (e_outer == e_BLK_SIG_CRC)
+	{
+		pst_state->ui32_crc_o = smm_avx512_crc_lanes(m512i_o1);
+	}
+	else if (e_outer == e_BLK_SIG_FLETCHER)
+	{
+		memcpy(pst_state->aui32_o[0], &m512i_o1, sizeof(pst_state->aui32_o[0]));
+		memcpy(pst_state->aui32_o[1], &m512i_o2, sizeof(pst_state->aui32_o[1]));
+	}
+	else
+	{
+		;
+	}
+	return (pst_sig != NULL) ? 0u : smm_avx512_sig_final(pst_state, Fletcher_a.ui32);
+}
+
+/*==============================================================================================================
+**									Name: smm_avx512_sig_final
+==============================================================================================================*/
+/*!
+** @brief Execution signature of the signature state of smm_avx512_gemm, of the whole MMM or of its merged shards
+**
+** @param[in] pst_sig 			Signature state of all the rows
+** @param[in] ui32_fletcher_a 	Fletcher checksum of A (e_BLK_SIG_FLETCHER inner technique, not kept in the state)
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static TARGET_AVX512 uint32_t smm_avx512_sig_final(const smm_shard_sig_t * const pst_sig, uint32_t ui32_fletcher_a)
+{
+	const e_blk_sig e_inner = pst_sig->e_inner;
+	uint64_t ui64_a = pst_sig->ui64_a;
+	uint32_t ui32_idx,
+		ui32_lane,
+		ui32_a,
+		ui32_es = 0u;
+	ui32_to_ui16_t Fletcher;
+
+	/* Signature of A reduced to 32 bits */
+	if (e_inner == e_BLK_SIG_ONES)
+	{
+		while ((ui64_a >> 32u) != 0u)
+		{
+			ui64_a = (ui64_a & 0xFFFFFFFFu) + (ui64_a >> 32u);
+		}
+		ui32_a = (uint32_t)ui64_a;
+	}
+	else if (e_inner == e_BLK_SIG_FLETCHER)
+	{
+		ui32_a = ui32_fletcher_a;
+	}
+	else
+	{
+		ui32_a = (uint32_t)ui64_a;
+	}
+
+	/* Final execution signature */
+	if (pst_sig->e_outer == e_BLK_SIG_CRC)
+	{
+		ui32_es = _mm_crc32_u32(pst_sig->ui32_crc_o, ui32_a);
+	}
+	else if (pst_sig->e_outer == e_BLK_SIG_FLETCHER)
+	{
+		Fletcher.ui32 = 0u;
+		Fletcher.ui32 = Fletcher32c_ui32(Fletcher, ui32_a);
+		for (ui32_idx = 0u; ui32_idx < 2u; ui32_idx++)
+		{
+			for (ui32_lane = 0u; ui32_lane < ZMM_NR; ui32_lane++)
+			{
+				Fletcher.ui32 = Fletcher32c_ui32(Fletcher, pst_sig->aui32_o[ui32_idx][ui32_lane]);
+			}
+		}
+		ui32_es = Fletcher.ui32;
+	}
+	else
+	{
+		switch (e_inner)
+		{
+		case e_BLK_SIG_XOR:
+			ui32_es = ui32_a;
+			for (ui32_lane = 0u; ui32_lane < ZMM_NR; ui32_lane++)
+			{
+				ui32_es ^= pst_sig->aui32_s[0][ui32_lane];
+			}
+			break;
+		case e_BLK_SIG_TWOS:
+			ui32_es = ui32_a;
+			for (ui32_lane = 0u; ui32_lane < ZMM_NR; ui32_lane++)
+			{
+				ui32_es += pst_sig->aui32_s[0][ui32_lane];
+			}
+			ui32_es = (~ui32_es) + 1u;
+			break;
+		case e_BLK_SIG_ONES:
+			ui64_a = (uint64_t)ui32_a;
+			for (ui32_idx = 0u; ui32_idx < 2u; ui32_idx++)
+			{
+				uint64_t aui64_lanes[8];
+				memcpy(aui64_lanes, pst_sig->aui32_s[ui32_idx], sizeof(aui64_lanes));
+				for (ui32_lane = 0u; ui32_lane < 8u; ui32_lane++)
+				{
+					ui64_a += (aui64_lanes[ui32_lane] & 0xFFFFFFFFu) + (aui64_lanes[ui32_lane] >> 32u);
+					ui64_a = (ui64_a & 0xFFFFFFFFu) + (ui64_a >> 32u);
+				}
+			}
+			while ((ui64_a >> 32u) != 0u)
+			{
+				ui64_a = (ui64_a & 0xFFFFFFFFu) + (ui64_a >> 32u);
+			}
+			ui32_es = ~(uint32_t)ui64_a;
+			break;
+		case e_BLK_SIG_FLETCHER:
+			Fletcher.ui32 = 0u;
+			Fletcher.ui32 = Fletcher32c_ui32(Fletcher, ui32_a);
+			for (ui32_idx = 0u; ui32_idx < 4u; ui32_idx++)
+			{
+				for (ui32_lane = 0u; ui32_lane < ZMM_NR; ui32_lane++)
+				{
+					Fletcher.ui32 = Fletcher32c_ui32(Fletcher, pst_sig->aui32_s[ui32_idx][ui32_lane]);
+				}
+			}
+			ui32_es = Fletcher.ui32;
+			break;
+		case e_BLK_SIG_CRC:
+			ui32_es = _mm_crc32_u32(pst_sig->aui32_crc[e_CRC_STREAM_A], pst_sig->aui32_crc[e_CRC_STREAM_B]);
+			ui32_es = _mm_crc32_u32(ui32_es, pst_sig->aui32_crc[e_CRC_STREAM_C]);
+			break;
+		default:
+			break;
+		}
+	}
+	return ui32_es;
+}
+
+/*==============================================================================================================
+**									Name: smm_avx512_shard_merge
+==============================================================================================================*/
+/*!
+** @brief Append the signature state of the next row shard to the state of the previous rows (e_SHARD_MERGE_AVX512).
+** 		  The shard started from a zero state; the result is the state of the serial kernel after both:
+** 		  - XOR / 2's / 1's complement lanes: XOR / sum of the lanes;
+** 		  - Fletcher lanes, L vectors signed by the shard: s1 = u1 + L x u0 + t1 (u: previous rows, t: shard);
+** 		  - CRC lanes: CRC of the concatenated B and C streams (crc32c_combine), A chain likewise;
+** 		  - outer CRC of the XOR lanes u: the R outer items of the shard are u ^ t_r, so the outer stream is
+** 		    the concatenation with the stream of the t_r XOR R copies of u (smm_crc32c_repeat);
+** 		  - outer Fletcher of the 2's complement lanes u, R items: o1 = U1 + R x u + T1,
+** 		    o2 = U2 + R x U1 + R (R + 1) / 2 x u + T2.
+** 		  The other mixed techniques have no closed form and are executed serially (e_SHARD_MERGE_SERIAL).
+**
+** @param[in,out] pst_acc 	Signature state of the previous rows
+** @param[in] pst_sig 		Signature state of the shard
+==============================================================================================================*/
+static TARGET_AVX512 void_t smm_avx512_shard_merge(smm_shard_sig_t * const pst_acc, const smm_shard_sig_t * const pst_sig)
+{
+	const uint64_t ui64_steps = pst_sig->aui64_len[e_CRC_STREAM_A] / sizeof(float32_t);
+	const __m512i m512i_vectors = _mm512_set1_epi32((int32_t)(uint32_t)(pst_sig->aui64_len[e_CRC_STREAM_B] / sizeof(__m512i)));
+	const __m512i m512i_steps = _mm512_set1_epi32((int32_t)(uint32_t)ui64_steps);
+	const __m512i m512i_tri = _mm512_set1_epi32((int32_t)(uint32_t)((ui64_steps * (ui64_steps + 1u)) / 2u));
+	__m512i am512i_u[4],
+		am512i_t[4],
+		m512i_o1,
+		m512i_o2;
+	uint32_t ui32_idx;
+
+	/* Empty shard: nothing to append */
+	if (ui64_steps == 0u)
+	{
+		return;
+	}
+	pst_acc->e_inner = pst_sig->e_inner;
+	pst_acc->e_outer = pst_sig->e_outer;
+	for (ui32_idx = 0u; ui32_idx < 4u; ui32_idx++)
+	{
+		am512i_u[ui32_idx] = _mm512_loadu_si512(pst_acc->aui32_s[ui32_idx]);
+		am512i_t[ui32_idx] = _mm512_loadu_si512(pst_sig->aui32_s[ui32_idx]);
+	}
+
+	/* Outer state: the items of the shard are its own inner lanes on top of the ones of the previous rows (u) */
+	if (pst_sig->e_outer == e_BLK_SIG_FLETCHER)
+	{
+		m512i_o1 = _mm512_loadu_si512(pst_acc->aui32_o[0]);
+		m512i_o2 = _mm512_loadu_si512(pst_acc->aui32_o[1]);
+		m512i_o2 = _mm512_add_epi32(_mm512_add_epi32(m512i_o2, _mm512_mullo_epi32(m512i_steps, m512i_o1)),
+			_mm512_add_epi32(_mm512_mullo_epi32(m512i_tri, am512i_u[0]), _mm512_loadu_si512(pst_sig->aui32_o[1])));
+		m512i_o1 = _mm512_add_epi32(_mm512_add_epi32(m512i_o1, _mm512_mullo_epi32(m512i_steps, am512i_u[0])), _mm512_loadu_si512(pst_sig->aui32_o[0]));
+		_mm512_storeu_si512(pst_acc->aui32_o[0], m512i_o1);
+		_mm512_storeu_si512(pst_acc->aui32_o[1], m512i_o2);
+	}
+	else if (pst_sig->e_outer == e_BLK_SIG_CRC)
+	{
+		pst_acc->ui32_crc_o = crc32c_combine_zero(pst_acc->ui32_crc_o, pst_sig->ui32_crc_o, ui64_steps * sizeof(__m512i))
+			^ smm_crc32c_repeat(smm_avx512_crc_lanes(am512i_u[0]), sizeof(__m512i), ui64_steps);
+	}
+	else
+	{
+		;
+	}
+
+	/* Inner state */
+	switch (pst_sig->e_inner)
+	{
+	case e_BLK_SIG_XOR:
+		am512i_u[0] = _mm512_xor_si512(am512i_u[0], am512i_t[0]);
+		pst_acc->ui64_a ^= pst_sig->ui64_a;
+		break;
+	case e_BLK_SIG_TWOS:
+		am512i_u[0] = _mm512_add_epi32(am512i_u[0], am512i_t[0]);
+		pst_acc->ui64_a = (uint32_t)(pst_acc->ui64_a + pst_sig->ui64_a);
+		break;
+	case e_BLK_SIG_ONES:
+		am512i_u[0] = _mm512_add_epi64(am512i_u[0], am512i_t[0]);
+		am512i_u[1] = _mm512_add_epi64(am512i_u[1], am512i_t[1]);
+		pst_acc->ui64_a += pst_sig->ui64_a;
+		break;
+	case e_BLK_SIG_FLETCHER:
+		am512i_u[1] = _mm512_add_epi32(_mm512_add_epi32(am512i_u[1], _mm512_mullo_epi32(m512i_vectors, am512i_u[0])), am512i_t[1]);
+		am512i_u[0] = _mm512_add_epi32(am512i_u[0], am512i_t[0]);
+		am512i_u[3] = _mm512_add_epi32(_mm512_add_epi32(am512i_u[3], _mm512_mullo_epi32(m512i_vectors, am512i_u[2])), am512i_t[3]);
+		am512i_u[2] = _mm512_add_epi32(am512i_u[2], am512i_t[2]);
+		break;
+	case e_BLK_SIG_CRC:
+		pst_acc->aui32_crc[e_CRC_STREAM_A] = crc32c_combine(pst_acc->aui32_crc[e_CRC_STREAM_A], pst_sig->aui32_crc[e_CRC_STREAM_A], pst_sig->aui64_len[e_CRC_STREAM_A]);
+		pst_acc->aui32_crc[e_CRC_STREAM_B] = crc32c_combine_zero(pst_acc->aui32_crc[e_CRC_STREAM_B], pst_sig->aui32_crc[e_CRC_STREAM_B], pst_sig->aui64_len[e_CRC_STREAM_B]);
+		pst_acc->aui32_crc[e_CRC_STREAM_C] = crc32c_combine_zero(pst_acc->aui32_crc[e_CRC_STREAM_C], pst_sig->aui32_crc[e_CRC_STREAM_C], pst_sig->aui64_len[e_CRC_STREAM_C]);
+		break;
+	default:
+		break;
+	}
+	for (ui32_idx = 0u; ui32_idx < 4u; ui32_idx++)
+	{
+		_mm512_storeu_si512(pst_acc->aui32_s[ui32_idx], am512i_u[ui32_idx]);
+	}
+}
+
+/*==============================================================================================================
+**									Name: smm_avx512_shard_final
+==============================================================================================================*/
+/*!
+** @brief Execution signature of the merged row shards of an AVX-512 technique (e_SHARD_MERGE_AVX512). The Fletcher
+** 		  checksum of A is not linear (16-bit sums folded modulo 255): it is computed again over all of A.
+**
+** @param[in] pst_acc 		Merged signature state of all the rows
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+**
+** @return uint32_t  	Execution signature of the MMM
+==============================================================================================================*/
+static TARGET_AVX512 uint32_t smm_avx512_shard_final(const smm_shard_sig_t * const pst_acc, uint32_t ui32_m, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma)
+{
+	ui32_to_ui16_t Fletcher_a;
+	uint32_t ui32_idx,
+		ui32_a_bits;
+	float32_t f32_a_part;
+
+	Fletcher_a.ui32 = 0u;
+	for (ui32_idx = 0u; (pst_acc->e_inner == e_BLK_SIG_FLETCHER) && (ui32_idx < (ui32_m * ui32_k)); ui32_idx++)
+	{
+		f32_a_part = f32_alpha * paf32_ma[ui32_idx];
+		memcpy(&ui32_a_bits, &f32_a_part, sizeof(ui32_a_bits));
+		Fletcher_a.ui32 = Fletcher32c_ui32(Fletcher_a, ui32_a_bits);
+	}
+	return smm_avx512_sig_final(pst_acc, Fletcher_a.ui32);
+}
+
+/*==============================================================================================================
+**									Name: smm_avx512_no_dc
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM without diagnostic coverage (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	0u	No execution signature
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_no_dc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_NONE, e_BLK_SIG_NONE, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_no_dc, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_xor
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with a fused XOR execution signature (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_xor(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_XOR, e_BLK_SIG_NONE, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_xor, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_ones
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with a fused 1's complement execution signature (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_ones(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_ONES, e_BLK_SIG_NONE, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_ones, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_ones_shard
+==============================================================================================================*/
+/*!
+** @brief Row shard of smm_avx512_ones executed with threads: signature state of its rows (see smm_avx512_shard_merge)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] pst_sig 		Signature state of the shard
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 void_t smm_avx512_ones_shard(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig, const bool32_t b32_fma)
+{
+	smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_ONES, e_BLK_SIG_NONE, pst_sig, b32_fma);
+}
+SMM_SHARD_VARIANTS(smm_avx512_ones_shard, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_twos
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with a fused 2's complement execution signature (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_twos(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_TWOS, e_BLK_SIG_NONE, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_twos, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_fletcher
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with a fused Fletcher execution signature (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_fletcher(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_FLETCHER, e_BLK_SIG_NONE, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_fletcher, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_fletcher_shard
+==============================================================================================================*/
+/*!
+** @brief Row shard of smm_avx512_fletcher executed with threads: signature state of its rows (see smm_avx512_shard_merge)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] pst_sig 		Signature state of the shard
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 void_t smm_avx512_fletcher_shard(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig, const bool32_t b32_fma)
+{
+	smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_FLETCHER, e_BLK_SIG_NONE, pst_sig, b32_fma);
+}
+SMM_SHARD_VARIANTS(smm_avx512_fletcher_shard, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_crc
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with a fused CRC32C execution signature (B and C folded with VPCLMULQDQ) (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_CRC, e_BLK_SIG_NONE, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_crc, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_crc_shard
+==============================================================================================================*/
+/*!
+** @brief Row shard of smm_avx512_crc executed with threads: signature state of its rows (see smm_avx512_shard_merge)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] pst_sig 		Signature state of the shard
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 void_t smm_avx512_crc_shard(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig, const bool32_t b32_fma)
+{
+	smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_CRC, e_BLK_SIG_NONE, pst_sig, b32_fma);
+}
+SMM_SHARD_VARIANTS(smm_avx512_crc_shard, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_xor_flet
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with XOR (internal) and Fletcher (intermediate) execution signatures (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_xor_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_XOR, e_BLK_SIG_FLETCHER, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_xor_flet, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_xor_crc
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with XOR (internal) and CRC32C (intermediate) execution signatures (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_xor_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_XOR, e_BLK_SIG_CRC, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_xor_crc, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_xor_crc_shard
+==============================================================================================================*/
+/*!
+** @brief Row shard of smm_avx512_xor_crc executed with threads: signature state of its rows (see smm_avx512_shard_merge)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] pst_sig 		Signature state of the shard
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 void_t smm_avx512_xor_crc_shard(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig, const bool32_t b32_fma)
+{
+	smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_XOR, e_BLK_SIG_CRC, pst_sig, b32_fma);
+}
+SMM_SHARD_VARIANTS(smm_avx512_xor_crc_shard, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_ones_flet
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with 1's complement (internal) and Fletcher (intermediate) execution signatures (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_ones_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_ONES, e_BLK_SIG_FLETCHER, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_ones_flet, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_ones_crc
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with 1's complement (internal) and CRC32C (intermediate) execution signatures (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_ones_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_ONES, e_BLK_SIG_CRC, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_ones_crc, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_twos_flet
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with 2's complement (internal) and Fletcher (intermediate) execution signatures (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_twos_flet(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_TWOS, e_BLK_SIG_FLETCHER, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_twos_flet, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_twos_flet_shard
+==============================================================================================================*/
+/*!
+** @brief Row shard of smm_avx512_twos_flet executed with threads: signature state of its rows (see smm_avx512_shard_merge)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[out] pst_sig 		Signature state of the shard
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 void_t smm_avx512_twos_flet_shard(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, smm_shard_sig_t * const pst_sig, const bool32_t b32_fma)
+{
+	smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_TWOS, e_BLK_SIG_FLETCHER, pst_sig, b32_fma);
+}
+SMM_SHARD_VARIANTS(smm_avx512_twos_flet_shard, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_twos_crc
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with 2's complement (internal) and CRC32C (intermediate) execution signatures (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_twos_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_TWOS, e_BLK_SIG_CRC, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_twos_crc, TARGET_AVX512)
+
+/*==============================================================================================================
+**									Name: smm_avx512_flet_crc
+==============================================================================================================*/
+/*!
+** @brief 512-bit MMM with Fletcher (internal) and CRC32C (intermediate) execution signatures (see smm_avx512_gemm)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+** @param[in] b32_fma 		Multiply-accumulate: FMA (TRUE) or mul + add (FALSE), constant of each variant
+**
+** @return uint32_t  	ui32_es	Return the Execution signature of the MMM
+==============================================================================================================*/
+static FORCE_INLINE TARGET_AVX512 uint32_t smm_avx512_flet_crc(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc, const bool32_t b32_fma)
+{
+	return smm_avx512_gemm(ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc, e_BLK_SIG_FLETCHER, e_BLK_SIG_CRC, NULL, b32_fma);
+}
+SMM_MADD_VARIANTS(smm_avx512_flet_crc, TARGET_AVX512)
+
+/*==============================================================================================================
+* 								 Experiment 7: parallel CRC
+==============================================================================================================*/
+
+/*==============================================================================================================
+**									Name: smm_par_crc_rows
+==============================================================================================================*/
+/*!
+** @brief Multi-threaded MMM with the execution signature of a serial CRC technique. The rows of A and C are
+** 		  split in shards of SMM_OMP_ROWS rows executed in parallel (OpenMP); each shard computes the CRC chains
+** 		  of its own part of the A, B and C streams, and the chains are merged in shard order with
+** 		  crc32c_combine. The result is the CRC of the whole streams: the same signature as the serial technique,
+** 		  whatever the number of threads.
+**
+** @param[in] ptr_fn 		MMM of a range of rows of the serial technique (CRC chains)
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+**
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+==============================================================================================================*/
+static uint32_t smm_par_crc_rows(ptr_fn_smm_crc_rows_t ptr_fn, uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+{
+	const uint32_t ui32_n_shards = (ui32_m + SMM_OMP_ROWS - 1u) / SMM_OMP_ROWS;
+	uint32_t aui32_crc[e_CRC_STREAM_MAX] = { INITIAL_REMAINDER, INITIAL_REMAINDER, INITIAL_REMAINDER };
+	uint32_t *paui32_crc;
+	uint32_t ui32_idx,
+		ui32_rows,
+		ui32_crc;
+	int32_t i32_shard,
+		i32_threads = 1;
+
+#ifdef _OPENMP
+	/* -threads=N, all the available threads otherwise */
+	i32_threads = (ui32_omp_threads != 0u) ? (int32_t)ui32_omp_threads : omp_get_max_threads();
+#endif
+
+	paui32_crc = (uint32_t*)malloc((ui32_n_shards + 1u) * e_CRC_STREAM_MAX * sizeof(uint32_t));
+	assert(paui32_crc != NULL);
+
+	/* 1. Shards: CRC chains of the A, B and C values of their rows, started at INITIAL_REMAINDER */
+#pragma omp parallel for schedule(dynamic, 1) num_threads(i32_threads)
+	for (i32_shard = 0; i32_shard < (int32_t)ui32_n_shards; i32_shard++)
+	{
+		uint32_t ui32_row = (uint32_t)i32_shard * SMM_OMP_ROWS;
+		uint32_t ui32_shard_rows = ((ui32_m - ui32_row) < SMM_OMP_ROWS) ? (ui32_m - ui32_row) : SMM_OMP_ROWS;
+		ptr_fn(ui32_shard_rows, ui32_n, ui32_k, f32_alpha, &paf32_ma[ui32_row * ui32_k], paf32_mb, &paf32_mc[ui32_row * ui32_n], &paui32_crc[(uint32_t)i32_shard * e_CRC_STREAM_MAX]);
+	}
+
+	/* 2. Merge in shard order: a shard adds one A value per (i, k) and n B / C values per (i, k) to the streams */
+	for (ui32_idx = 0u; ui32_idx < ui32_n_shards; ui32_idx++)
+	{
+		ui32_rows = ((ui32_m - (ui32_idx * SMM_OMP_ROWS)) < SMM_OMP_ROWS) ? (ui32_m - (ui32_idx * SMM_OMP_ROWS)) : SMM_OMP_ROWS;
+		aui32_crc[e_CRC_STREAM_A] = crc32c_combine(aui32_crc[e_CRC_STREAM_A], paui32_crc[(ui32_idx * e_CRC_STREAM_MAX) + e_CRC_STREAM_A],
+			(uint64_t)ui32_rows * ui32_k * sizeof(float32_t));
+		aui32_crc[e_CRC_STREAM_B] = crc32c_combine(aui32_crc[e_CRC_STREAM_B], paui32_crc[(ui32_idx * e_CRC_STREAM_MAX) + e_CRC_STREAM_B],
+			(uint64_t)ui32_rows * ui32_k * ui32_n * sizeof(float32_t));
+		aui32_crc[e_CRC_STREAM_C] = crc32c_combine(aui32_crc[e_CRC_STREAM_C], paui32_crc[(ui32_idx * e_CRC_STREAM_MAX) + e_CRC_STREAM_C],
+			(uint64_t)ui32_rows * ui32_k * ui32_n * sizeof(float32_t));
+	}
+	free(paui32_crc);
+
+	ui32_crc = singletable_crc32c_ui32(aui32_crc[e_CRC_STREAM_A], aui32_crc[e_CRC_STREAM_B]);
+	ui32_crc = singletable_crc32c_ui32(ui32_crc, aui32_crc[e_CRC_STREAM_C]);
+	return ui32_crc;
+}
+
+/*==============================================================================================================
+**									Name: smm_par_crc_internal
+==============================================================================================================*/
+/*!
+** @brief Multi-threaded CRC_INTERNAL: same execution signature as smm_crc_internal (see smm_par_crc_rows)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+**
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+==============================================================================================================*/
+static uint32_t smm_par_crc_internal(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+{
+	return smm_par_crc_rows(smm_crc_internal_rows, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+}
+
+/*==============================================================================================================
+**									Name: smm_par_intel_crc_internal_fma
+==============================================================================================================*/
+/*!
+** @brief Multi-threaded INTEL_CRC_INTERNAL with FMA: same execution signature as smm_intel_crc_internal_fma
+** 		  (see smm_par_crc_rows)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+**
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+==============================================================================================================*/
+static uint32_t smm_par_intel_crc_internal_fma(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+{
+	return smm_par_crc_rows(smm_intel_crc_internal_rows_fma, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+}
+
+/*==============================================================================================================
+**									Name: smm_par_intel_crc_internal_mul_add
+==============================================================================================================*/
+/*!
+** @brief Multi-threaded INTEL_CRC_INTERNAL with mul + add: same execution signature as smm_intel_crc_internal_mul_add
+** 		  (see smm_par_crc_rows)
+**
+** @param[in] ui32_m 		Number of matrix A rows 								[0…ui32_m]
+** @param[in] ui32_n 		Number of matrix B columns 								[0…ui32_n]
+** @param[in] ui32_k 		Number of matrix A columns / Number of matrix B rows 	[0…ui32_k]
+** @param[in] f32_alpha		Correction factor
+** @param[in] paf32_ma 		Pointer to the first position of an array of floats (A matrix direction)
+** @param[in] paf32_mb 		Pointer to the first position of an array of floats (B matrix direction)
+** @param[in] paf32_mc 		Pointer to the first position of an array of floats (C matrix direction)
+**
+** @return uint32_t  	ui32_crc	Return the Execution signature of the MMM
+==============================================================================================================*/
+static uint32_t smm_par_intel_crc_internal_mul_add(uint32_t ui32_m, uint32_t ui32_n, uint32_t ui32_k, float32_t f32_alpha, const float32_t * const paf32_ma, const float32_t * const paf32_mb, float32_t * const paf32_mc)
+{
+	return smm_par_crc_rows(smm_intel_crc_internal_rows_mul_add, ui32_m, ui32_n, ui32_k, f32_alpha, paf32_ma, paf32_mb, paf32_mc);
+}
@@ -0,0 +1,217 @@
+/* ==============================================================================================================
+* File:		fi_idx_reader.c
+* Brief:	Reader of the <tech>_fi_idx.bin files written by the single bit campaign of
+*			Parallelized_One_bit_error.c (-dc, -idx=bin). Each experiment (technique and size) of the file is a
+*			st_fi_idx_hdr_t header followed by the bitmap of the undetected faults in A and the bitmap of the
+*			undetected faults in B (bit i, LSB first: fault ui32_bit_first + i not detected).
+*			The reader prints the statistics of every experiment (undetected faults per matrix and per field of
+*			the float: sign, exponent, mantissa) and converts the file to the CSV file of -idx=csv.
+*
+*			gcc -O3 fi_idx_reader.c -o fi_idx_reader
+*			./fi_idx_reader INTEL_XOR_external_fi_idx.bin [-csv=INTEL_XOR_external_fi_idx.csv]
+* ============================================================================================================== */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+typedef uint32_t bool32_t;
+
+#ifndef TRUE
+#define TRUE  1u
+#define FALSE 0u
+#endif
+
+#define FI_IDX_MAGIC        ((uint32_t) 0x31424946u)  /*!< "FIB1" */
+#define FI_IDX_BUFFER       ((size_t) (1u << 20))     /*!< stdio buffer of the CSV file */
+
+typedef enum
+{
+	e_FI_FIELD_SIGN = 0u,
+	e_FI_FIELD_EXPONENT,
+	e_FI_FIELD_MANTISSA,
+	e_FI_FIELD_MAX
+} e_fi_field;
+
+/*! Header of each experiment; same layout as in Parallelized_One_bit_error.c */
+typedef struct
+{
+	uint32_t ui32_magic;
+	uint32_t ui32_interleaved;   /*!< 1: CSV with A and B interleaved per bit, 0: all A, new line, all B */
+	uint32_t ui32_m;
+	uint32_t ui32_n;
+	uint32_t ui32_k;
+	uint32_t ui32_bit_first;
+	uint32_t ui32_bits_a;
+	uint32_t ui32_bits_b;
+} st_fi_idx_hdr_t;
+
+/******************************************************************************
+**				Name:    bitmap_get
+******************************************************************************/
+/*!
+** @brief  Value of bit ui32_bit of the bitmap
+******************************************************************************/
+static bool32_t bitmap_get(const uint8_t *pau8_bitmap, uint32_t ui32_bit)
+{
+	return (bool32_t)((pau8_bitmap[ui32_bit >> 3] >> (ui32_bit & 7u)) & 1u);
+}
+
+/******************************************************************************
+**				Name:    bitmap_count
+******************************************************************************/
+/*!
+** @brief  Count the set bits of the bitmap per field of the float (bit index modulo 32)
+**
+** @param[in]  pau8_bitmap     Bitmap
+** @param[in]  ui32_bits       Number of bits of the bitmap
+** @param[in]  ui32_bit_first  Bit index of the first bit of the bitmap
+** @param[out] paui32_field    Set bits per field (e_FI_FIELD_MAX entries)
+**
+** @return  uint32_t Number of set bits
+**
+******************************************************************************/
+static uint32_t bitmap_count(const uint8_t *pau8_bitmap, uint32_t ui32_bits, uint32_t ui32_bit_first, uint32_t *paui32_field)
+{
+	uint32_t ui32_idx,
+		ui32_pos,
+		ui32_count = 0u;
+
+	memset(paui32_field, 0, e_FI_FIELD_MAX * sizeof(uint32_t));
+	for (ui32_idx = 0u; ui32_idx < ui32_bits; ui32_idx++)
+	{
+		if (pau8_bitmap[ui32_idx >> 3] == 0u)
+		{
+			ui32_idx |= 7u;  /* Skip the empty bytes */
+			continue;
+		}
+		if (bitmap_get(pau8_bitmap, ui32_idx))
+		{
+			ui32_pos = (ui32_bit_first + ui32_idx) % 32u;
+			paui32_field[(ui32_pos == 31u) ? e_FI_FIELD_SIGN : ((ui32_pos >= 23u) ? e_FI_FIELD_EXPONENT : e_FI_FIELD_MANTISSA)]++;
+			ui32_count++;
+		}
+	}
+	return ui32_count;
+}
+
+int main(int argc, char *argv[])
+{
+	st_fi_idx_hdr_t st_hdr;
+	FILE *p_file,
+		*p_file_csv = NULL;
+	uint8_t *pau8_bitmap_a,
+		*pau8_bitmap_b;
+	uint32_t ui32_idx,
+		ui32_record = 0u,
+		ui32_undetected_a,
+		ui32_undetected_b,
+		aui32_field_a[e_FI_FIELD_MAX],
+		aui32_field_b[e_FI_FIELD_MAX];
+	size_t size_a,
+		size_b;
+	e_fi_field e_field;
+	int i32_arg;
+
+	if (argc < 2)
+	{
+		printf("\n Usage: %s file_fi_idx.bin [-csv=file.csv]", argv[0]);
+		printf("\n\t Prints the undetected faults of every experiment of the file and, with -csv, converts it to the -idx=csv format\n");
+		return EXIT_FAILURE;
+	}
+	if ((p_file = fopen(argv[1], "rb")) == NULL)
+	{
+		fprintf(stderr, "cannot open file '%s'\n", argv[1]);
+		return EXIT_FAILURE;
+	}
+	for (i32_arg = 2; i32_arg < argc; i32_arg++)
+	{
+		if (strncmp(argv[i32_arg], "-csv=", 5u) == 0)
+		{
+			if ((p_file_csv = fopen(&argv[i32_arg][5u], "w")) == NULL)
+			{
+				fprintf(stderr, "cannot open file '%s'\n", &argv[i32_arg][5u]);
+				fclose(p_file);
+				return EXIT_FAILURE;
+			}
+			setvbuf(p_file_csv, NULL, _IOFBF, FI_IDX_BUFFER);
+		}
+	}
+
+	printf("experiment,M,N,K,bit_first,faults,undetected_a,undetected_b,dc,undetected_sign,undetected_exponent,undetected_mantissa");
+	while (fread(&st_hdr, sizeof(st_hdr), 1u, p_file) == 1u)
+	{
+		if (st_hdr.ui32_magic != FI_IDX_MAGIC)
+		{
+			fprintf(stderr, "\n'%s': experiment %u is not a fault index record\n", argv[1], ui32_record);
+			break;
+		}
+		size_a = (st_hdr.ui32_bits_a + 7u) / 8u;
+		size_b = (st_hdr.ui32_bits_b + 7u) / 8u;
+		pau8_bitmap_a = (uint8_t*)malloc(size_a + 1u);
+		pau8_bitmap_b = (uint8_t*)malloc(size_b + 1u);
+		if ((pau8_bitmap_a == NULL) || (pau8_bitmap_b == NULL) ||
+			(fread(pau8_bitmap_a, 1u, size_a, p_file) != size_a) || (fread(pau8_bitmap_b, 1u, size_b, p_file) != size_b))
+		{
+			fprintf(stderr, "\n'%s': experiment %u is truncated\n", argv[1], ui32_record);
+			free(pau8_bitmap_a);
+			free(pau8_bitmap_b);
+			break;
+		}
+
+		/* 1. Statistics */
+		ui32_undetected_a = bitmap_count(pau8_bitmap_a, st_hdr.ui32_bits_a, st_hdr.ui32_bit_first, &aui32_field_a[0u]);
+		ui32_undetected_b = bitmap_count(pau8_bitmap_b, st_hdr.ui32_bits_b, st_hdr.ui32_bit_first, &aui32_field_b[0u]);
+		printf("\n%u,%u,%u,%u,%u,%u,%u,%u,%.6f", ui32_record, st_hdr.ui32_m, st_hdr.ui32_n, st_hdr.ui32_k, st_hdr.ui32_bit_first,
+			st_hdr.ui32_bits_a + st_hdr.ui32_bits_b, ui32_undetected_a, ui32_undetected_b,
+			100.0 * (1.0 - ((double)(ui32_undetected_a + ui32_undetected_b) / (double)(st_hdr.ui32_bits_a + st_hdr.ui32_bits_b))));
+		for (e_field = e_FI_FIELD_SIGN; e_field < e_FI_FIELD_MAX; e_field++)
+		{
+			printf(",%u", aui32_field_a[e_field] + aui32_field_b[e_field]);
+		}
+
+		/* 2. CSV, same text as the campaign with -idx=csv */
+		if (p_file_csv != NULL)
+		{
+			if (st_hdr.ui32_interleaved != 0u)
+			{
+				for (ui32_idx = 0u; ui32_idx < st_hdr.ui32_bits_a; ui32_idx++)
+				{
+					if (bitmap_get(pau8_bitmap_a, ui32_idx)) {
+						fprintf(p_file_csv, "%u,", st_hdr.ui32_bit_first + ui32_idx);
+					}
+					if ((ui32_idx < st_hdr.ui32_bits_b) && bitmap_get(pau8_bitmap_b, ui32_idx)) {
+						fprintf(p_file_csv, "%u,", st_hdr.ui32_bit_first + ui32_idx);
+					}
+				}
+			}
+			else
+			{
+				for (ui32_idx = 0u; ui32_idx < st_hdr.ui32_bits_a; ui32_idx++)
+				{
+					if (bitmap_get(pau8_bitmap_a, ui32_idx)) {
+						fprintf(p_file_csv, "%u,", st_hdr.ui32_bit_first + ui32_idx);
+					}
+				}
+				fprintf(p_file_csv, "\n");
+				for (ui32_idx = 0u; ui32_idx < st_hdr.ui32_bits_b; ui32_idx++)
+				{
+					if (bitmap_get(pau8_bitmap_b, ui32_idx)) {
+						fprintf(p_file_csv, "%u,", st_hdr.ui32_bit_first + ui32_idx);
+					}
+				}
+			}
+		}
+		free(pau8_bitmap_a);
+		free(pau8_bitmap_b);
+		ui32_record++;
+	}
+	printf("\n");
+
+	fclose(p_file);
+	if (p_file_csv != NULL)
+	{
+		fclose(p_file_csv);
+	}
+	return EXIT_SUCCESS;
+}